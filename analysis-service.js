@@ -0,0 +1,256 @@
+/**
+ * @module AnalysisService
+ * @description Worker-hosted analysis engines with an async request/response API
+ * @exports class AnalysisService
+ * @exports createAnalysisHandlers (shared by analysis-worker.js and the main-thread fallback)
+ * @feature Container chord search, chord substitutions, voice leading and context parsing (including its scale-physics selection) off the main thread
+ * @feature Per-channel cancellation: a newer request on a channel drops the in-flight one
+ * @feature Falls back to running the same handlers on the main thread when Workers are unavailable (file://)
+ */
+
+(function(root) {
+    'use strict';
+
+    /**
+     * Request handlers keyed by method name. `engines` is a lazy provider so the
+     * worker (and the fallback) only construct what is actually requested.
+     */
+    function createAnalysisHandlers(engines) {
+        return {
+            ping() {
+                return { ok: true };
+            },
+            findAllContainerChords({ notes, scaleNotes, options }) {
+                return engines.musicTheory().findAllContainerChords(notes || [], scaleNotes || [], options || {});
+            },
+            generateSubstitutions({ chord, key, scale, exhaustive, gradingMode }) {
+                const explorer = engines.chordExplorer();
+                // Tier labels and colors follow the caller's grading mode
+                if (gradingMode) explorer.musicTheory.setGradingMode(gradingMode);
+                explorer.state.currentKey = key || 'C';
+                explorer.state.currentScale = scale || 'major';
+                explorer.state.exhaustiveMode = !!exhaustive;
+                return explorer.generateSubstitutions(chord);
+            },
+            generateVoiceLeading({ chordSymbols, options }) {
+                return engines.voiceLeading().generateVoiceLeading(chordSymbols || [], options || {});
+            },
+            parseInput({ input, options }) {
+                return engines.context().parseInput(input, options || {});
+            }
+        };
+    }
+
+    /**
+     * Lazy engine provider; reuses engines passed in by the host when available.
+     */
+    function createEngineProvider(provided = {}) {
+        const cache = {};
+        return {
+            musicTheory() {
+                if (!cache.musicTheory) cache.musicTheory = provided.musicTheory || new MusicTheoryEngine();
+                return cache.musicTheory;
+            },
+            voiceLeading() {
+                if (!cache.voiceLeading) {
+                    cache.voiceLeading = provided.voiceLeading || new VoiceLeadingEngine(this.musicTheory());
+                    cache.voiceLeading.debug = false;
+                }
+                return cache.voiceLeading;
+            },
+            context() {
+                if (!cache.context) cache.context = provided.context || new ContextEngine();
+                return cache.context;
+            },
+            chordExplorer() {
+                // Substitution logic only; the app's explorer owns the DOM and its own key/scale state
+                if (!cache.chordExplorer) cache.chordExplorer = new UnifiedChordExplorer(this.musicTheory(), { headless: true });
+                return cache.chordExplorer;
+            }
+        };
+    }
+
+    class AnalysisService {
+        /**
+         * @param {Object} options - { workerUrl, musicTheory, voiceLeading, context, useWorker }
+         */
+        constructor(options = {}) {
+            this.workerUrl = options.workerUrl || 'analysis-worker.js';
+            this.localEngines = createEngineProvider(options);
+            this.localHandlers = createAnalysisHandlers(this.localEngines);
+
+            this.nextId = 1;
+            this.pending = new Map();   // id -> { resolve, reject, channel, method, params }
+            this.channels = new Map();  // channel -> id of the latest request
+            this.stats = { requests: 0, completed: 0, cancelled: 0, failed: 0, fallback: 0 };
+
+            this.worker = null;
+            if (options.useWorker !== false) this._startWorker();
+        }
+
+        _startWorker() {
+            if (typeof Worker === 'undefined') return;
+            try {
+                this.worker = new Worker(this.workerUrl);
+            } catch (err) {
+                // file:// and some embedded browsers refuse workers; run in-thread instead
+                console.warn('[AnalysisService] Worker unavailable, using main thread:', err && err.message);
+                this.worker = null;
+                return;
+            }
+            this.worker.onmessage = (e) => this._onWorkerMessage(e.data || {});
+            this.worker.onerror = (e) => {
+                console.warn('[AnalysisService] Worker failed, falling back to main thread:', e && e.message);
+                if (e && typeof e.preventDefault === 'function') e.preventDefault();
+                this._abandonWorker();
+            };
+        }
+
+        /**
+         * Stop using the worker and replay anything still pending on the main thread
+         */
+        _abandonWorker() {
+            if (this.worker) {
+                try { this.worker.terminate(); } catch (_) {}
+            }
+            this.worker = null;
+            for (const [id, job] of this.pending) {
+                this._runLocal(id, job);
+            }
+        }
+
+        isWorkerBacked() {
+            return !!this.worker;
+        }
+
+        /**
+         * Queue an analysis request.
+         * @param {string} method - handler name (see createAnalysisHandlers)
+         * @param {Object} params - structured-cloneable arguments
+         * @param {Object} options - { channel } newer requests on the same channel cancel older ones
+         * @returns {Promise} resolves with the handler result; rejects with err.cancelled === true when superseded
+         */
+        request(method, params = {}, options = {}) {
+            const id = this.nextId++;
+            const channel = options.channel || null;
+            this.stats.requests++;
+
+            if (channel) this.cancel(channel);
+
+            return new Promise((resolve, reject) => {
+                const job = { resolve, reject, channel, method, params };
+                this.pending.set(id, job);
+                if (channel) this.channels.set(channel, id);
+
+                if (this.worker) {
+                    try {
+                        this.worker.postMessage({ id, method, params });
+                    } catch (err) {
+                        // Params that can't be structured-cloned still run, just not off-thread
+                        this._runLocal(id, job);
+                    }
+                } else {
+                    this._runLocal(id, job);
+                }
+            });
+        }
+
+        /**
+         * Drop the in-flight request on a channel (its promise rejects with cancelled: true)
+         */
+        cancel(channel) {
+            const id = this.channels.get(channel);
+            if (id === undefined) return false;
+            this.channels.delete(channel);
+            const job = this.pending.get(id);
+            if (!job) return false;
+            this.pending.delete(id);
+            this.stats.cancelled++;
+            if (this.worker) this.worker.postMessage({ id, method: 'cancel' });
+            const err = new Error(`Analysis request ${job.method} cancelled`);
+            err.cancelled = true;
+            job.reject(err);
+            return true;
+        }
+
+        _runLocal(id, job) {
+            this.stats.fallback++;
+            // Defer so callers see the same async ordering as the worker path
+            this._loadLocalScripts(job.method).then(() => setTimeout(() => {
+                if (!this.pending.has(id)) return;
+                const handler = this.localHandlers[job.method];
+                try {
+                    if (!handler) throw new Error(`Unknown analysis method: ${job.method}`);
+                    this._settle(id, { result: handler(job.params || {}) });
+                } catch (err) {
+                    this._settle(id, { error: err && err.message ? err.message : String(err) });
+                }
+            }, 0));
+        }
+
+        /**
+         * The worker imports every engine script up front; on the main thread the
+         * optional ones (AnalysisService.LOCAL_MODULES) load through ModuleLoader first.
+         */
+        _loadLocalScripts(method) {
+            const moduleId = AnalysisService.LOCAL_MODULES[method];
+            const loader = root && root.moduleLoader;
+            if (!moduleId || !loader) return Promise.resolve();
+            return loader.load(moduleId).catch(err => {
+                console.warn(`[AnalysisService] ${moduleId} unavailable, running ${method} without it:`, err && err.message);
+            });
+        }
+
+        _onWorkerMessage(msg) {
+            if (msg.type === 'fatal') {
+                console.warn('[AnalysisService] Worker could not start:', msg.error);
+                this._abandonWorker();
+                return;
+            }
+            if (msg.id === undefined) return;
+            this._settle(msg.id, msg);
+        }
+
+        _settle(id, msg) {
+            const job = this.pending.get(id);
+            if (!job) return; // cancelled or already settled
+            this.pending.delete(id);
+            if (job.channel && this.channels.get(job.channel) === id) this.channels.delete(job.channel);
+
+            if (msg.error) {
+                this.stats.failed++;
+                job.reject(new Error(msg.error));
+            } else {
+                this.stats.completed++;
+                job.resolve(msg.result);
+            }
+        }
+
+        getStats() {
+            return { ...this.stats, pending: this.pending.size, workerBacked: this.isWorkerBacked() };
+        }
+
+        terminate() {
+            for (const channel of Array.from(this.channels.keys())) this.cancel(channel);
+            if (this.worker) {
+                try { this.worker.terminate(); } catch (_) {}
+                this.worker = null;
+            }
+        }
+    }
+
+    // ModuleLoader ids a handler needs before it can run on the main thread
+    AnalysisService.LOCAL_MODULES = {
+        parseInput: 'nlp'
+    };
+
+    AnalysisService.createAnalysisHandlers = createAnalysisHandlers;
+    AnalysisService.createEngineProvider = createEngineProvider;
+
+    if (typeof module !== 'undefined' && module.exports) {
+        module.exports = AnalysisService;
+    }
+    if (root) {
+        root.AnalysisService = AnalysisService;
+    }
+})(typeof window !== 'undefined' ? window : (typeof self !== 'undefined' ? self : null));
@@ -0,0 +1,71 @@
+/**
+ * analysis-worker.js
+ * Worker side of AnalysisService: loads the analysis engines once and answers
+ * { id, method, params } messages with { id, result } or { id, error }.
+ *
+ * Requests are queued and drained one per task so that 'cancel' messages that
+ * arrive while a job is running can still drop queued work before it starts.
+ */
+
+// Engines and loaders guard on `typeof window`; the worker global stands in for it.
+self.window = self;
+
+try {
+    importScripts(
+        'scales-data-packed.js',
+        'scale-taxonomy.js',
+        'scales-loader-embedded.js',
+        'music-theory-engine.js',
+        'voice-leading-engine.js',
+        'unified-chord-explorer.js',
+        'compromise.min.js',
+        'nrc-lexicon.js',
+        'lexicon-index.js',
+        'word-database.js',
+        'context-engine.js',
+        'analysis-service.js'
+    );
+} catch (err) {
+    self.postMessage({ type: 'fatal', error: err && err.message ? err.message : String(err) });
+    throw err;
+}
+
+const engines = AnalysisService.createEngineProvider();
+const handlers = AnalysisService.createAnalysisHandlers(engines);
+
+const queue = [];
+let draining = false;
+
+function drain() {
+    draining = false;
+    const job = queue.shift();
+    if (!job) return;
+
+    const handler = handlers[job.method];
+    try {
+        if (!handler) throw new Error(`Unknown analysis method: ${job.method}`);
+        self.postMessage({ id: job.id, result: handler(job.params || {}) });
+    } catch (err) {
+        self.postMessage({ id: job.id, error: err && err.message ? err.message : String(err) });
+    }
+
+    scheduleDrain();
+}
+
+function scheduleDrain() {
+    if (draining || queue.length === 0) return;
+    draining = true;
+    setTimeout(drain, 0);
+}
+
+self.onmessage = (e) => {
+    const msg = e.data || {};
+    if (msg.method === 'cancel') {
+        // A job not in the queue has already run; its late result is ignored by the client
+        const idx = queue.findIndex(job => job.id === msg.id);
+        if (idx >= 0) queue.splice(idx, 1);
+        return;
+    }
+    queue.push(msg);
+    scheduleDrain();
+};
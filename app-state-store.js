@@ -0,0 +1,140 @@
+/**
+ * @module AppStateStore
+ * @description Shared workspace state with batched transactions and per-frame notification
+ * @exports class AppStateStore
+ * @feature set()/transaction() record changed fields; commits are coalesced into one flush per animation frame
+ * @feature Subscribers name the fields they depend on and receive only those changes, once per flush
+ * @feature Stats for sets, commits, flushes and notifications to see how much fan-out was saved
+ */
+
+class AppStateStore {
+    constructor(initialState = {}) {
+        this.state = { ...initialState };
+        this.subscribers = [];
+        this.dirty = new Map();  // field -> previous value (first one seen since last flush)
+        this.depth = 0;          // transaction nesting
+        this.flushPending = false;
+        this.flushing = false;
+        this.stats = { sets: 0, commits: 0, flushes: 0, notifications: 0 };
+    }
+
+    get(field) {
+        return this.state[field];
+    }
+
+    getState() {
+        return { ...this.state };
+    }
+
+    /**
+     * Merge a patch; unchanged fields (shallow/array-equal) are ignored
+     */
+    set(patch, options = {}) {
+        if (!patch) return this;
+        this.stats.sets++;
+        let changed = false;
+        Object.keys(patch).forEach(field => {
+            const next = patch[field];
+            const prev = this.state[field];
+            if (AppStateStore.isEqual(prev, next)) return;
+            if (!this.dirty.has(field)) this.dirty.set(field, prev);
+            this.state[field] = next;
+            changed = true;
+        });
+        if (changed && options.source) this.lastSource = options.source;
+        if (changed && this.depth === 0) this._commit();
+        return this;
+    }
+
+    /**
+     * Group several set() calls into one commit
+     */
+    transaction(fn) {
+        this.depth++;
+        try {
+            return fn(this);
+        } finally {
+            this.depth--;
+            if (this.depth === 0 && this.dirty.size > 0) this._commit();
+        }
+    }
+
+    /**
+     * @param {string[]} fields - fields this subscriber depends on
+     * @param {Function} callback - (changes, state) where changes = { field: { value, previous } }
+     * @returns {Function} unsubscribe
+     */
+    subscribe(fields, callback, options = {}) {
+        const sub = { fields: new Set(fields || []), callback, id: options.id || null };
+        this.subscribers.push(sub);
+        return () => {
+            const idx = this.subscribers.indexOf(sub);
+            if (idx > -1) this.subscribers.splice(idx, 1);
+        };
+    }
+
+    _commit() {
+        this.stats.commits++;
+        if (this.flushPending || this.flushing) return;
+        this.flushPending = true;
+        const schedule = (typeof requestAnimationFrame === 'function')
+            ? requestAnimationFrame
+            : (fn) => setTimeout(fn, 0);
+        schedule(() => this.flush());
+    }
+
+    /**
+     * Notify subscribers of everything committed since the last flush.
+     * Changes made by subscribers during the flush are delivered in a follow-up pass.
+     */
+    flush() {
+        this.flushPending = false;
+        if (this.dirty.size === 0) return;
+        this.flushing = true;
+        this.stats.flushes++;
+        try {
+            let guard = 0;
+            while (this.dirty.size > 0 && guard++ < 10) {
+                const dirty = this.dirty;
+                this.dirty = new Map();
+                const snapshot = this.getState();
+                this.subscribers.slice().forEach(sub => {
+                    let changes = null;
+                    dirty.forEach((previous, field) => {
+                        if (!sub.fields.has(field)) return;
+                        if (!changes) changes = {};
+                        changes[field] = { value: this.state[field], previous };
+                    });
+                    if (!changes) return;
+                    this.stats.notifications++;
+                    try {
+                        sub.callback(changes, snapshot);
+                    } catch (error) {
+                        console.error(`[AppStateStore] subscriber ${sub.id || ''} failed:`, error);
+                    }
+                });
+            }
+        } finally {
+            this.flushing = false;
+        }
+    }
+
+    getStats() {
+        return { ...this.stats, subscribers: this.subscribers.length };
+    }
+
+    static isEqual(a, b) {
+        if (a === b) return true;
+        if (Array.isArray(a) && Array.isArray(b)) {
+            if (a.length !== b.length) return false;
+            for (let i = 0; i < a.length; i++) if (a[i] !== b[i]) return false;
+            return true;
+        }
+        return false;
+    }
+}
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = AppStateStore;
+}
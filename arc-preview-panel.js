@@ -164,9 +164,19 @@ class ArcPreviewPanel {
     }
     
     // Parse input with source-seed variation so regenerate can shift context-level parameters.
-    this.currentContext = this.contextEngine.parseInput(text, {
-      variationSeed: this.seedAnchor
-    });
+    const options = { variationSeed: this.seedAnchor };
+    this.pendingText = text;
+    const context = typeof this.contextEngine.parseInputIncremental === 'function'
+      ? this.contextEngine.parseInputIncremental(text, options, (settled) => {
+          // Scale selection was debounced; apply the final context if the text is unchanged
+          if (this.pendingText === text) this._applyContext(settled);
+        })
+      : this.contextEngine.parseInput(text, options);
+    this._applyContext(context);
+  }
+
+  _applyContext(context) {
+    this.currentContext = context;
 
     // Generate arc using seed derived from base seed + current parameters.
     this.currentSeed = this._deriveActiveSeed();
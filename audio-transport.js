@@ -0,0 +1,198 @@
+/**
+ * @module AudioTransport
+ * @description Lookahead scheduler shared by EnhancedAudioEngine and PianoSampleEngine
+ * @exports class AudioTransport
+ * @feature Timer tops up a short window of future events against the AudioContext clock
+ * @feature Tempo changes, looping and seek take effect mid-phrase
+ * @feature stop()/seek() cancel events that have not sounded yet
+ *
+ * Event times and durations are in beats; at the default tempo of 60 BPM one beat
+ * is one second, so callers that think in seconds can pass seconds unchanged.
+ */
+
+class AudioTransport {
+    /**
+     * @param {AudioContext|Function} clock - context (uses currentTime) or () => seconds
+     * @param {Object} options - { tempo, lookahead, interval, loop }
+     */
+    constructor(clock, options = {}) {
+        this.now = typeof clock === 'function' ? clock : () => clock.currentTime;
+        this.tempo = options.tempo || 60;
+        this.lookahead = options.lookahead || 0.1;  // seconds scheduled ahead of the clock
+        this.interval = options.interval || 25;     // ms between top-ups
+        this.loop = !!options.loop;
+
+        this.events = [];      // sorted by beat
+        this.length = 0;       // beats; loop point
+        this.cursor = 0;       // next event index
+        this.onEvent = null;   // (event, when, durationSeconds) => handle
+        this.onCancel = null;  // (handles) => void, silences already-dispatched future notes
+        this.onEnd = null;
+
+        this.playing = false;
+        this.anchorTime = 0;   // clock time at which anchorBeat sounds
+        this.anchorBeat = 0;
+        this.scheduledUntil = 0; // beat up to which events have been dispatched (unwrapped)
+        this.cycleOffset = 0;    // beats added per completed loop
+        this.pendingHandles = []; // { when, handle } dispatched but not yet sounding
+        this.timer = null;
+    }
+
+    /**
+     * Load a sequence. Events: { beat, duration, ...payload }
+     * @param {Array} events
+     * @param {Object} options - { length, loop, onEvent, onCancel, onEnd }
+     */
+    setSequence(events, options = {}) {
+        this.stop();
+        this.events = (events || []).slice().sort((a, b) => a.beat - b.beat);
+        const last = this.events[this.events.length - 1];
+        this.length = options.length || (last ? last.beat + (last.duration || 0) : 0);
+        if (options.loop !== undefined) this.loop = !!options.loop;
+        if (options.onEvent) this.onEvent = options.onEvent;
+        if (options.onCancel) this.onCancel = options.onCancel;
+        if (options.onEnd !== undefined) this.onEnd = options.onEnd;
+        return this;
+    }
+
+    secondsPerBeat() {
+        return 60 / this.tempo;
+    }
+
+    /** Current transport position in (unwrapped) beats */
+    position() {
+        if (!this.playing) return this.anchorBeat;
+        return this.anchorBeat + (this.now() - this.anchorTime) / this.secondsPerBeat();
+    }
+
+    start(fromBeat = this.anchorBeat) {
+        if (this.playing) this.stop();
+        this._reanchor(fromBeat, this.now() + 0.02);
+        this.playing = true;
+        this._tick();
+        this.timer = setInterval(() => this._tick(), this.interval);
+        return this;
+    }
+
+    /** Stop playback and cancel anything dispatched but not yet sounding */
+    stop() {
+        if (this.timer) clearInterval(this.timer);
+        this.timer = null;
+        if (this.playing) this.anchorBeat = this._wrap(this.position());
+        this.playing = false;
+        this._cancelPending();
+        return this;
+    }
+
+    seek(beat) {
+        const wasPlaying = this.playing;
+        this.stop();
+        this.anchorBeat = Math.max(0, beat);
+        if (wasPlaying) this.start(this.anchorBeat);
+        return this;
+    }
+
+    /** Change tempo without jumping: the current position is kept and re-timed */
+    setTempo(bpm) {
+        const next = Math.max(1, Number(bpm) || this.tempo);
+        if (this.playing) {
+            const t = this.now();
+            const beat = this.position();
+            this._cancelPending();
+            this.tempo = next;
+            // Events at exactly this beat have already been dispatched
+            this._reanchor(beat, t, false);
+        } else {
+            this.tempo = next;
+        }
+        return this;
+    }
+
+    setLoop(loop) {
+        this.loop = !!loop;
+        return this;
+    }
+
+    isPlaying() {
+        return this.playing;
+    }
+
+    _wrap(beat) {
+        if (!this.length) return beat;
+        return this.loop ? beat % this.length : Math.min(beat, this.length);
+    }
+
+    /**
+     * Pin `beat` (unwrapped) to clock `time` and point the cursor at the next event
+     */
+    _reanchor(beat, time, inclusive = true) {
+        this.cycleOffset = (this.loop && this.length > 0) ? Math.floor(beat / this.length) * this.length : 0;
+        const local = beat - this.cycleOffset;
+        this.anchorTime = time;
+        this.anchorBeat = beat;
+        this.scheduledUntil = beat;
+        this.cursor = this.events.findIndex(ev => inclusive ? ev.beat >= local : ev.beat > local);
+        if (this.cursor < 0) this.cursor = this.events.length;
+    }
+
+    _tick() {
+        if (!this.playing) return;
+        const spb = this.secondsPerBeat();
+        const now = this.now();
+        const horizon = this.anchorBeat + (now + this.lookahead - this.anchorTime) / spb;
+
+        if (this.pendingHandles.length) {
+            this.pendingHandles = this.pendingHandles.filter(p => p.when > now);
+        }
+
+        while (this.scheduledUntil < horizon) {
+            if (this.cursor >= this.events.length) {
+                if (this.loop && this.length > 0 && this.events.length) {
+                    this.cycleOffset += this.length;
+                    this.cursor = 0;
+                    continue;
+                }
+                if (now >= this.anchorTime + (this.cycleOffset + this.length - this.anchorBeat) * spb) {
+                    this._finish();
+                }
+                return;
+            }
+            const ev = this.events[this.cursor];
+            const beat = ev.beat + this.cycleOffset;
+            if (beat >= horizon) {
+                this.scheduledUntil = horizon;
+                return;
+            }
+            this.cursor++;
+            this.scheduledUntil = beat;
+            const when = this.anchorTime + (beat - this.anchorBeat) * spb;
+            if (this.onEvent) {
+                const handle = this.onEvent(ev, Math.max(when, now), (ev.duration || 0) * spb);
+                if (handle !== undefined && when > now) this.pendingHandles.push({ when, handle });
+            }
+        }
+    }
+
+    _cancelPending() {
+        if (this.pendingHandles.length && this.onCancel) {
+            const now = this.now();
+            const future = this.pendingHandles.filter(p => p.when > now).map(p => p.handle);
+            if (future.length) this.onCancel(future);
+        }
+        this.pendingHandles = [];
+    }
+
+    _finish() {
+        if (this.timer) clearInterval(this.timer);
+        this.timer = null;
+        this.playing = false;
+        this.anchorBeat = 0;
+        this.pendingHandles = [];
+        if (typeof this.onEnd === 'function') this.onEnd();
+    }
+}
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = AudioTransport;
+}
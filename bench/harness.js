@@ -0,0 +1,115 @@
+// Shared benchmark harness: browser-script loading, property-generated inputs,
+// warmup + percentile timing, and baseline comparison.
+// Used by bench/hot-paths-bench.js; see that file for usage.
+
+const fs = require('fs');
+const { ROOT, loadBrowserScripts, compileScript } = require('../scripts/engine-sandbox.js');
+
+/**
+ * fast-check is a declared dependency; the bench refuses to run without it rather than
+ * timing inputs from a different generator. Baselines record the version that produced them.
+ */
+function loadPropertyGenerator() {
+  let fc;
+  try {
+    fc = require('fast-check');
+  } catch (_) {
+    console.error('[bench] fast-check is not installed; run `npm install` first');
+    process.exit(1);
+  }
+  return { fc, source: `fast-check@${fc.__version || 'unknown'}` };
+}
+
+function percentile(sorted, p) {
+  if (!sorted.length) return 0;
+  return sorted[Math.min(sorted.length - 1, Math.floor(p * sorted.length))];
+}
+
+/**
+ * Time `fn(input)` once per measured input after warming up on separate inputs.
+ * Warmup and measured inputs come from different seeds, so samples aren't replays of the
+ * warmup, but they are not cache-cold: caches over a small domain fill anyway. parseInput's
+ * word-entry, sentence-parse and physics-selection caches warm over the fixed vocabulary
+ * (and repeated sentences hit outright), so that case reports warm-cache steady state.
+ * `passes` is a list of { inputs, warmupInputs }; samples from all passes are pooled.
+ */
+function measure(name, fn, passes) {
+  const samples = [];
+  for (const { inputs, warmupInputs = [] } of passes) {
+    warmupInputs.forEach(input => fn(input));
+    for (const input of inputs) {
+      const t0 = process.hrtime.bigint();
+      fn(input);
+      samples.push(Number(process.hrtime.bigint() - t0) / 1e6);
+    }
+  }
+  samples.sort((a, b) => a - b);
+  const total = samples.reduce((sum, ms) => sum + ms, 0);
+  return {
+    name,
+    samples: samples.length,
+    meanMs: total / (samples.length || 1),
+    p50Ms: percentile(samples, 0.5),
+    p90Ms: percentile(samples, 0.9),
+    p99Ms: percentile(samples, 0.99),
+    maxMs: samples[samples.length - 1] || 0
+  };
+}
+
+/**
+ * A case regresses when its median exceeds the baseline median by more than `threshold`
+ * (fraction) and by more than `minDeltaMs`, which keeps sub-microsecond jitter from failing runs.
+ */
+function compareToBaseline(results, baseline, { threshold, minDeltaMs }) {
+  return results.map(result => {
+    const base = baseline && baseline.cases ? baseline.cases[result.name] : null;
+    if (!base) return { ...result, status: 'new' };
+    const ratio = base.p50Ms > 0 ? result.p50Ms / base.p50Ms : 1;
+    const regressed = ratio > 1 + threshold && (result.p50Ms - base.p50Ms) > minDeltaMs;
+    return { ...result, baseP50Ms: base.p50Ms, ratio, status: regressed ? 'regressed' : 'ok' };
+  });
+}
+
+function readBaseline(file) {
+  try {
+    return JSON.parse(fs.readFileSync(file, 'utf8'));
+  } catch (_) {
+    return null;
+  }
+}
+
+/**
+ * Write results as the new baseline; cases not measured this run (--only) keep their old entries
+ */
+function writeBaseline(file, results, meta, previous = null) {
+  const cases = previous && previous.cases ? { ...previous.cases } : {};
+  results.forEach(r => {
+    cases[r.name] = { p50Ms: round(r.p50Ms), p90Ms: round(r.p90Ms), p99Ms: round(r.p99Ms), samples: r.samples };
+  });
+  fs.writeFileSync(file, JSON.stringify({ ...meta, cases }, null, 2) + '\n');
+}
+
+function round(ms) {
+  return Math.round(ms * 10000) / 10000;
+}
+
+function formatRow(r) {
+  const fmt = (ms) => `${ms.toFixed(3)}ms`.padStart(10);
+  let line = `  ${r.name.padEnd(46)} p50 ${fmt(r.p50Ms)}  p90 ${fmt(r.p90Ms)}  p99 ${fmt(r.p99Ms)}  (${r.samples} runs)`;
+  if (r.status === 'new') line += '  [no baseline]';
+  else if (r.status) line += `  ${(r.ratio * 100 - 100).toFixed(1).padStart(6)}% vs baseline${r.status === 'regressed' ? '  REGRESSED' : ''}`;
+  return line;
+}
+
+module.exports = {
+  ROOT,
+  loadBrowserScripts,
+  compileScript,
+  loadPropertyGenerator,
+  measure,
+  percentile,
+  compareToBaseline,
+  readBaseline,
+  writeBaseline,
+  formatRow
+};
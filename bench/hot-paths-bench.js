@@ -0,0 +1,167 @@
+// Engine hot-path benchmark suite with a regression gate.
+// Usage: `npm run bench` (compare against bench/baseline.json, exit 1 on regression)
+//        `npm run bench -- --update-baseline`   record the current machine as the baseline
+//        `npm run bench -- --only=parseInput --threshold=0.4 --runs=100 --passes=5 --seed=7`
+//
+// Inputs are property-generated (fast-check) from a fixed seed, so every run times the same
+// inputs. Without a baseline the run only reports timings (exit 0); record one with
+// --update-baseline on the machine that gates and commit it to turn the gate on.
+
+const path = require('path');
+const {
+  loadBrowserScripts, compileScript, loadPropertyGenerator, measure,
+  compareToBaseline, readBaseline, writeBaseline, formatRow
+} = require('./harness.js');
+const { CATALOG_FILES, ENGINE_FILES } = require('../scripts/engine-sandbox.js');
+
+const BASELINE_FILE = path.join(__dirname, 'baseline.json');
+const NOTES = ['C', 'C#', 'Db', 'D', 'Eb', 'E', 'F', 'F#', 'G', 'Ab', 'A', 'Bb', 'B'];
+const ROOTS = ['C', 'D', 'E', 'F', 'G', 'A', 'B', 'Bb', 'Eb', 'Ab', 'F#', 'Db'];
+const CHORD_TYPES = ['', 'm', '7', 'maj7', 'm7', 'm7b5', 'dim', 'aug', 'sus4', '6', 'm9', '9', '13', 'add9'];
+const KEYS = ['C', 'G', 'D', 'F', 'Bb', 'Eb', 'A', 'E'];
+// Catalog ids only: unknown names fall back to major without a warning
+const SCALES = ['major', 'aeolian', 'dorian', 'mixolydian', 'harmonic_minor', 'melodic_minor'];
+const WORDS = [
+  'tomorrow', 'night', 'dark', 'bright', 'joyful', 'sadness', 'storm', 'hope', 'morning', 'light',
+  'angry', 'calm', 'river', 'lonely', 'dance', 'fear', 'love', 'cold', 'warm', 'rising', 'falling',
+  'very', 'not', 'slowly', 'suddenly', 'and', 'but', 'in', 'the', 'a', 'happy', 'grief', 'triumph'
+];
+
+function parseArgs(argv) {
+  const args = { updateBaseline: false, only: null, threshold: null, runs: null, passes: 3, seed: 20240601, minDeltaMs: 0.005 };
+  argv.forEach(arg => {
+    const [flag, value] = arg.replace(/^--/, '').split('=');
+    if (flag === 'update-baseline') args.updateBaseline = true;
+    else if (flag === 'only') args.only = value;
+    else if (flag === 'threshold') args.threshold = Number(value);
+    else if (flag === 'runs') args.runs = Number(value);
+    else if (flag === 'seed') args.seed = Number(value);
+    else if (flag === 'passes') args.passes = Math.max(1, Number(value) || 1);
+    else if (flag === 'min-delta') args.minDeltaMs = Number(value);
+  });
+  return args;
+}
+
+/**
+ * Each case: name, runs (measured inputs), arbitrary(fc) producing one input, setup(env) -> fn(input)
+ */
+function defineCases(fc) {
+  const chordSymbol = fc.tuple(fc.constantFrom(...ROOTS), fc.constantFrom(...CHORD_TYPES)).map(([r, t]) => r + t);
+  const noteSet = (min, max) => fc.uniqueArray(fc.constantFrom(...NOTES), { minLength: min, maxLength: max });
+  return [
+    {
+      name: 'findAllContainerChords',
+      runs: 400,
+      arbitrary: fc.tuple(noteSet(1, 4), fc.constantFrom(...KEYS), fc.constantFrom(...SCALES)),
+      setup: ({ theory }) => ([notes, key, scale]) => theory.findAllContainerChords(notes, theory.getScaleNotes(key, scale))
+    },
+    {
+      name: 'VoiceLeadingEngine.generateVoiceLeading',
+      runs: 60,
+      arbitrary: fc.array(chordSymbol, { minLength: 4, maxLength: 16 }),
+      setup: ({ voiceLeading }) => (progression) => voiceLeading.generateVoiceLeading(progression)
+    },
+    {
+      name: 'ScaleRelationshipExplorer.findContainingScales',
+      runs: 200,
+      arbitrary: noteSet(3, 5),
+      setup: ({ explorer }) => (notes) => explorer.findContainingScales(notes)
+    },
+    {
+      name: 'ContextEngine.parseInput',
+      runs: 200,
+      arbitrary: fc.array(fc.constantFrom(...WORDS), { minLength: 2, maxLength: 14 }).map(words => words.join(' ')),
+      setup: ({ context }) => (text) => context.parseInput(text)
+    },
+    {
+      name: 'ChordAttributeEngine.findSimilarChords',
+      runs: 200,
+      arbitrary: fc.tuple(chordSymbol, fc.uniqueArray(chordSymbol, { minLength: 20, maxLength: 120 })),
+      setup: ({ attributes }) => ([target, candidates]) => attributes.findSimilarChords(target, candidates, { topK: 8 })
+    },
+    {
+      name: 'scale catalog load',
+      runs: 20,
+      arbitrary: fc.integer({ min: 0, max: 1000 }),
+      setup: () => () => {
+        // Fresh sandbox per run: parse the packed catalog, build the index, construct an engine
+        const ctx = loadBrowserScripts([...CATALOG_FILES, 'music-theory-engine.js']);
+        const Engine = ctx.get('MusicTheoryEngine');
+        new Engine();
+      }
+    }
+  ];
+}
+
+function createEnvironment() {
+  const ctx = loadBrowserScripts(ENGINE_FILES);
+  const MusicTheoryEngine = ctx.get('MusicTheoryEngine');
+  const theory = new MusicTheoryEngine();
+  const voiceLeading = new (ctx.get('VoiceLeadingEngine'))(theory);
+  voiceLeading.debug = false;
+  return {
+    theory,
+    voiceLeading,
+    explorer: new (ctx.get('ScaleRelationshipExplorer'))(theory),
+    context: new (ctx.get('ContextEngine'))(),
+    attributes: new (ctx.get('ChordAttributeEngine'))()
+  };
+}
+
+function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const { fc, source } = loadPropertyGenerator();
+  const baseline = args.updateBaseline ? null : readBaseline(BASELINE_FILE);
+  if (!baseline && !args.updateBaseline) {
+    console.warn(`[bench] no baseline at ${path.relative(process.cwd(), BASELINE_FILE)}; reporting only (record one with \`npm run bench -- --update-baseline\`)`);
+  }
+  const threshold = args.threshold != null ? args.threshold : (baseline && baseline.threshold) || 0.25;
+
+  // Compile once up front so script parsing isn't charged to the first case
+  ENGINE_FILES.forEach(compileScript);
+  const env = createEnvironment();
+
+  const cases = defineCases(fc).filter(c => !args.only || c.name.toLowerCase().includes(args.only.toLowerCase()));
+  console.log(`[bench] ${cases.length} hot paths, inputs from ${source} (seed ${args.seed})`);
+
+  const results = cases.map(c => {
+    const runs = args.runs || c.runs;
+    const fn = c.setup(env);
+    // Several passes over differently seeded inputs; percentiles are taken over the pooled samples
+    const passes = [];
+    for (let pass = 0; pass < args.passes; pass++) {
+      passes.push({
+        inputs: fc.sample(c.arbitrary, { numRuns: runs, seed: args.seed + pass * 2 }),
+        warmupInputs: fc.sample(c.arbitrary, { numRuns: Math.max(3, Math.ceil(runs / 4)), seed: args.seed + pass * 2 + 1 })
+      });
+    }
+    return measure(c.name, fn, passes);
+  });
+
+  const meta = { version: 1, inputs: source, seed: args.seed, passes: args.passes, threshold, node: process.version, recorded: new Date().toISOString() };
+  const comparable = baseline && baseline.inputs === source && baseline.seed === args.seed && baseline.passes === args.passes;
+  if (baseline && !comparable) {
+    console.warn(`[bench] baseline was recorded with ${baseline.inputs} inputs (seed ${baseline.seed}, ${baseline.passes} passes); not gating this run`);
+  }
+
+  const rows = comparable ? compareToBaseline(results, baseline, { threshold, minDeltaMs: args.minDeltaMs }) : results;
+  rows.forEach(r => console.log(formatRow(r)));
+
+  if (args.updateBaseline) {
+    const previous = readBaseline(BASELINE_FILE);
+    const keep = previous && previous.inputs === source && previous.seed === args.seed && previous.passes === args.passes ? previous : null;
+    writeBaseline(BASELINE_FILE, results, meta, keep);
+    console.log(`[bench] baseline written to ${path.relative(process.cwd(), BASELINE_FILE)}`);
+    return;
+  }
+
+  const regressed = rows.filter(r => r.status === 'regressed');
+  if (regressed.length) {
+    console.error(`[bench] ${regressed.length} hot path(s) regressed beyond ${(threshold * 100).toFixed(0)}%: ${regressed.map(r => r.name).join(', ')}`);
+    process.exitCode = 1;
+  } else if (comparable) {
+    console.log(`[bench] no regressions beyond ${(threshold * 100).toFixed(0)}%`);
+  }
+}
+
+main();
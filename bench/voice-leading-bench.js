@@ -0,0 +1,65 @@
+// Voice-leading search benchmark: compares the greedy chord-by-chord path against
+// the pruned (branch-and-bound) and viterbi (whole-progression) search modes.
+// Usage: `npm run bench:voice-leading` (or `node bench/voice-leading-bench.js [bars] [iterations]`)
+
+const MusicTheoryEngine = require('../music-theory-engine.js');
+const VoiceLeadingEngine = require('../voice-leading-engine.js');
+
+const BARS = Number(process.argv[2]) || 32;
+const ITERATIONS = Number(process.argv[3]) || 20;
+const MODES = ['greedy', 'pruned', 'viterbi'];
+
+// Deterministic progression built from common jazz/pop chord types
+function buildProgression(length, seed = 7) {
+  const roots = ['C', 'D', 'E', 'F', 'G', 'A', 'B', 'Bb', 'Eb', 'Ab'];
+  const types = ['maj7', 'm7', '7', 'm7b5', 'm9', '13', '6', 'dim', 'aug', ''];
+  let state = seed;
+  const next = () => {
+    state = (state * 1103515245 + 12345) & 0x7fffffff;
+    return state;
+  };
+  const out = [];
+  for (let i = 0; i < length; i++) {
+    out.push(roots[next() % roots.length] + types[next() % types.length]);
+  }
+  return out;
+}
+
+function timeMode(engine, progression, mode) {
+  const samples = [];
+  let result = null;
+  // Warmup so the JIT has settled before measuring
+  for (let i = 0; i < 3; i++) engine.generateVoiceLeading(progression, { search: mode });
+  for (let i = 0; i < ITERATIONS; i++) {
+    const t0 = process.hrtime.bigint();
+    result = engine.generateVoiceLeading(progression, { search: mode });
+    samples.push(Number(process.hrtime.bigint() - t0) / 1e6);
+  }
+  samples.sort((a, b) => a - b);
+  const pct = (p) => samples[Math.min(samples.length - 1, Math.floor(p * samples.length))];
+  return {
+    mode,
+    medianMs: pct(0.5),
+    p95Ms: pct(0.95),
+    pathCost: engine.calculatePathCost(result)
+  };
+}
+
+function main() {
+  const engine = new VoiceLeadingEngine(new MusicTheoryEngine());
+  engine.debug = false;
+  const progression = buildProgression(BARS);
+
+  console.log(`[bench] voice leading: ${BARS} chords, ${ITERATIONS} iterations per mode`);
+  const rows = MODES.map(mode => timeMode(engine, progression, mode));
+  const greedy = rows.find(r => r.mode === 'greedy');
+  rows.forEach(r => {
+    const speedup = (greedy.medianMs / r.medianMs).toFixed(2);
+    console.log(
+      `  ${r.mode.padEnd(8)} median ${r.medianMs.toFixed(2)}ms  p95 ${r.p95Ms.toFixed(2)}ms  ` +
+      `path cost ${r.pathCost}  (x${speedup} vs greedy)`
+    );
+  });
+}
+
+main();
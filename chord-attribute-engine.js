@@ -14,6 +14,7 @@
  * @feature Emotional quality mapping
  * @feature Functional harmony classification
  * @feature Chord-to-chord similarity scoring
+ * @feature Per-symbol feature-vector cache and bounded top-K search over a chord-type index
  */
 
 class ChordAttributeEngine {
@@ -79,6 +80,11 @@ class ChordAttributeEngine {
             'chromatic': { stability: 0.3, resolution: 'color', progressionWeight: 0.6 },
             'passing': { stability: 0.5, resolution: 'movement', progressionWeight: 0.4 }
         };
+
+        // symbol -> { analysis, vector } (vector = [tension, brightness, stability, density])
+        this.featureCache = new Map();
+        this.featureCacheLimit = 2048;
+        this.typeIndex = null;
     }
 
     /**
@@ -355,20 +361,38 @@ class ChordAttributeEngine {
     }
 
     /**
-     * Calculate similarity between two chords (0-1 scale)
+     * Cached analysis + attribute vector for a symbol (treat as read-only)
      */
-    calculateSimilarity(chord1Symbol, chord2Symbol) {
-        const c1 = this.analyzeChord(chord1Symbol);
-        const c2 = this.analyzeChord(chord2Symbol);
-
-        const attr1 = c1.attributes;
-        const attr2 = c2.attributes;
+    getFeatures(chordSymbol) {
+        const key = chordSymbol || '';
+        const cached = this.featureCache.get(key);
+        if (cached) return cached;
+
+        const analysis = this.analyzeChord(chordSymbol);
+        const attr = analysis.attributes;
+        const vector = new Float64Array(ChordAttributeEngine.VECTOR_DIMS);
+        vector[0] = attr.tension;
+        vector[1] = attr.brightness;
+        vector[2] = attr.stability;
+        vector[3] = attr.density;
+
+        const entry = { analysis, vector };
+        if (this.featureCache.size >= this.featureCacheLimit) {
+            this.featureCache.delete(this.featureCache.keys().next().value);
+        }
+        this.featureCache.set(key, entry);
+        return entry;
+    }
 
-        // Calculate Euclidean distance in attribute space
-        const tensionDiff = Math.abs(attr1.tension - attr2.tension);
-        const brightnessDiff = Math.abs(attr1.brightness - attr2.brightness);
-        const stabilityDiff = Math.abs(attr1.stability - attr2.stability);
-        const densityDiff = Math.abs(attr1.density - attr2.density);
+    /**
+     * Similarity (0-1) between two attribute vectors; 1 is identical
+     */
+    _vectorSimilarity(v1, v2) {
+        // Euclidean distance in attribute space
+        const tensionDiff = Math.abs(v1[0] - v2[0]);
+        const brightnessDiff = Math.abs(v1[1] - v2[1]);
+        const stabilityDiff = Math.abs(v1[2] - v2[2]);
+        const densityDiff = Math.abs(v1[3] - v2[3]);
 
         const distance = Math.sqrt(
             tensionDiff ** 2 +
@@ -379,37 +403,112 @@ class ChordAttributeEngine {
 
         // Convert distance to similarity (0-1, where 1 is identical)
         const maxDistance = Math.sqrt(4); // Max possible distance
-        const similarity = 1 - (distance / maxDistance);
+        return 1 - (distance / maxDistance);
+    }
+
+    /**
+     * Calculate similarity between two chords (0-1 scale)
+     */
+    calculateSimilarity(chord1Symbol, chord2Symbol) {
+        const f1 = this.getFeatures(chord1Symbol);
+        const f2 = this.getFeatures(chord2Symbol);
 
         return {
-            similarity,
-            sharedQualities: this._findSharedQualities(c1, c2),
-            differences: this._findDifferences(c1, c2)
+            similarity: this._vectorSimilarity(f1.vector, f2.vector),
+            sharedQualities: this._findSharedQualities(f1.analysis, f2.analysis),
+            differences: this._findDifferences(f1.analysis, f2.analysis)
         };
     }
 
     /**
      * Find chords with similar attributes
+     * @param {Object} options - { topK } keep only the best K (bounded heap instead of a full sort)
      */
-    findSimilarChords(targetSymbol, candidateSymbols) {
-        const results = [];
-        
-        for (const candidate of candidateSymbols) {
-            const similarity = this.calculateSimilarity(targetSymbol, candidate);
-            results.push({
-                chord: candidate,
-                similarity: similarity.similarity,
-                sharedQualities: similarity.sharedQualities
-            });
+    findSimilarChords(targetSymbol, candidateSymbols, options = {}) {
+        const target = this.getFeatures(targetSymbol);
+        const count = candidateSymbols.length;
+        const scores = new Float64Array(count);
+        for (let i = 0; i < count; i++) {
+            scores[i] = this._vectorSimilarity(target.vector, this.getFeatures(candidateSymbols[i]).vector);
+        }
+
+        const k = options.topK > 0 ? Math.min(options.topK, count) : count;
+        return this._topK(scores, k).map(i => ({
+            chord: candidateSymbols[i],
+            similarity: scores[i],
+            sharedQualities: this._findSharedQualities(target.analysis, this.getFeatures(candidateSymbols[i]).analysis)
+        }));
+    }
+
+    /**
+     * Indices of the k highest scores, best first; ties keep input order (same as a stable sort)
+     */
+    _topK(scores, k) {
+        const count = scores.length;
+        if (k >= count) {
+            const all = Array.from({ length: count }, (_, i) => i);
+            return all.sort((a, b) => scores[b] - scores[a]);
         }
 
-        return results.sort((a, b) => b.similarity - a.similarity);
+        // Min-heap of the best k so far; root is the current worst
+        const heap = [];
+        const worse = (a, b) => scores[a] < scores[b] || (scores[a] === scores[b] && a > b);
+        const siftUp = (pos) => {
+            while (pos > 0) {
+                const parent = (pos - 1) >> 1;
+                if (!worse(heap[pos], heap[parent])) break;
+                [heap[pos], heap[parent]] = [heap[parent], heap[pos]];
+                pos = parent;
+            }
+        };
+        const siftDown = (pos) => {
+            for (;;) {
+                const left = pos * 2 + 1;
+                const right = left + 1;
+                let top = pos;
+                if (left < heap.length && worse(heap[left], heap[top])) top = left;
+                if (right < heap.length && worse(heap[right], heap[top])) top = right;
+                if (top === pos) break;
+                [heap[pos], heap[top]] = [heap[top], heap[pos]];
+                pos = top;
+            }
+        };
+        for (let i = 0; i < count && k > 0; i++) {
+            if (heap.length < k) {
+                heap.push(i);
+                siftUp(heap.length - 1);
+            } else if (worse(heap[0], i)) {
+                heap[0] = i;
+                siftDown(0);
+            }
+        }
+        return heap.sort((a, b) => (scores[b] - scores[a]) || (a - b));
+    }
+
+    /**
+     * Attribute vectors for every chord type in CHORD_TYPES. Attributes do not
+     * depend on the root, so one row per type covers all roots x types.
+     */
+    getTypeIndex() {
+        if (this.typeIndex) return this.typeIndex;
+        const types = ChordAttributeEngine.CHORD_TYPES;
+        const dims = ChordAttributeEngine.VECTOR_DIMS;
+        const vectors = new Float64Array(types.length * dims);
+        types.forEach((type, row) => {
+            // Any root parses the same; C keeps quality detection from reading the type as a root
+            vectors.set(this.getFeatures('C' + type).vector, row * dims);
+        });
+        this.typeIndex = { types, vectors };
+        return this.typeIndex;
     }
 
     /**
      * Generate chord suggestions based on desired attributes
+     * @param {Object} options - { topK, root }: with topK, return the nearest chord types from
+     *   the prebuilt type index (optionally spelled on `root`) instead of the rule-based list
      */
-    suggestChords(desiredAttributes) {
+    suggestChords(desiredAttributes, options = {}) {
+        if (options.topK > 0) return this._suggestFromIndex(desiredAttributes, options);
         const { tension, brightness, density, stability } = desiredAttributes;
         const suggestions = [];
 
@@ -448,6 +547,34 @@ class ChordAttributeEngine {
         return suggestions.sort((a, b) => b.confidence - a.confidence);
     }
 
+    _suggestFromIndex(desiredAttributes, options) {
+        const { types, vectors } = this.getTypeIndex();
+        const dims = ChordAttributeEngine.VECTOR_DIMS;
+        const axes = ['tension', 'brightness', 'stability', 'density'];
+        // Only the attributes that were asked for take part in the distance
+        const wanted = axes.map(axis => (typeof desiredAttributes[axis] === 'number' ? desiredAttributes[axis] : null));
+        const used = wanted.filter(v => v !== null).length || 1;
+        const maxDistance = Math.sqrt(used);
+
+        const scores = new Float64Array(types.length);
+        for (let row = 0; row < types.length; row++) {
+            let sum = 0;
+            for (let d = 0; d < dims; d++) {
+                if (wanted[d] === null) continue;
+                const diff = vectors[row * dims + d] - wanted[d];
+                sum += diff * diff;
+            }
+            scores[row] = 1 - Math.sqrt(sum) / maxDistance;
+        }
+
+        const root = options.root || '';
+        return this._topK(scores, Math.min(options.topK, types.length)).map(row => ({
+            symbol: root + types[row],
+            reason: 'nearest attributes',
+            confidence: scores[row]
+        }));
+    }
+
     /**
      * Helper: Build chord type string for matching
      */
@@ -535,6 +662,14 @@ class ChordAttributeEngine {
     }
 }
 
+ChordAttributeEngine.VECTOR_DIMS = 4;
+// Chord types covered by the suggestion index (appended to a root)
+ChordAttributeEngine.CHORD_TYPES = [
+    '', 'm', 'dim', 'aug', 'sus2', 'sus4', '6', 'm6', '7', 'maj7', 'm7', 'mMaj7',
+    'm7b5', 'dim7', '7sus4', 'add9', 'madd9', '9', 'maj9', 'm9', '11', 'm11', '13', 'maj13',
+    '7b5', '7#5', '7b9', '7#9', '7#11', '7b13', '7alt', 'maj7#11'
+];
+
 // Export for browser and Node.js
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = ChordAttributeEngine;
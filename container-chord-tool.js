@@ -35,6 +35,7 @@ class ContainerChordTool {
 
         this.listeners = new Map();
         this.containerElement = null;
+        this.analysisService = null;
 
         // Subscribe to shared grading mode changes
         if (this.musicTheory.subscribe) {
@@ -159,22 +160,30 @@ class ContainerChordTool {
         }
 
         const scaleNotes = this.musicTheory.getScaleNotes(this.state.currentKey, this.state.currentScale);
-        // Expand search set to include enharmonic equivalents so the engine can match by name
+        // Expand search set to include enharmonic equivalents so role labels cover every spelling
         const expanded = Array.from(new Set(input.flatMap(n => this.getEnharmonics(n))));
-        let results = this.musicTheory.findAllContainerChords(expanded, scaleNotes) || [];
-        // Ensure multi-note queries only keep chords that contain ALL requested notes
-        if (input.length > 1) {
-            // Compare by semitone value to respect enharmonic equivalence
-            results = results.filter(ch => {
-                if (!Array.isArray(ch.chordNotes)) return false;
-                const chordSemis = new Set(ch.chordNotes.map(n => this.noteToSemi(n)));
-                return input.every(n => {
-                    const enh = this.getEnharmonics(n);
-                    return enh.some(e => chordSemis.has(this.noteToSemi(e)));
+        // Multi-note queries only keep chords that contain ALL requested pitch classes
+        const match = input.length > 1 ? 'all' : 'any';
+
+        if (this.analysisService) {
+            // Off-thread search; a newer analyze() supersedes this one via the channel
+            this.analysisService.request('findAllContainerChords', {
+                notes: expanded, scaleNotes, options: { match }
+            }, { channel: 'container-chord-tool' })
+                .then(results => this._applyResults(results))
+                .catch(err => {
+                    if (err && err.cancelled) return;
+                    console.warn('[ContainerChordTool] Analysis service failed, searching locally:', err && err.message);
+                    this._applyResults(this.musicTheory.findAllContainerChords(expanded, scaleNotes, { match }));
                 });
-            });
+            return;
         }
-        this.state.results = results;
+
+        this._applyResults(this.musicTheory.findAllContainerChords(expanded, scaleNotes, { match }));
+    }
+
+    _applyResults(results) {
+        this.state.results = results || [];
         
         // Sort by complexity and scale match
         this.state.results.sort((a, b) => this.rankChord(b) - this.rankChord(a));
@@ -183,6 +192,13 @@ class ContainerChordTool {
         this.render();
     }
 
+    /**
+     * Route container searches through an AnalysisService (worker-backed when available)
+     */
+    connectAnalysisService(service) {
+        this.analysisService = service || null;
+    }
+
     /**
      * Change multi-note grouping mode
      */
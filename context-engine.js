@@ -64,6 +64,18 @@ class ContextEngine {
         this.scalePhysicsCache = null;
         this.defaultRoot = 'C';
 
+        // Incremental analysis caches (see parseInputIncremental). Entries depend only on
+        // their key and the loaded lexicon/catalog, so cached and fresh results are identical.
+        this.incrementalCacheLimit = 2000;
+        this.wordEntryCache = new Map();       // word -> { emotion, fallback, category }
+        this.wordEntryCacheDb = null;
+        this.sentenceParseCache = new Map();   // sentence -> compromise terms/POS
+        this.physicsSelectionCache = new Map(); // target key -> interval-physics selection
+        this.physicsSelectionSource = null;
+        this.lastPhysicsSelection = null;
+        this.scaleSelectionDelay = 150;        // ms the scale-selection stage waits for typing to pause
+        this.scaleSelectionTimer = null;
+
         this.debug = false;
     }
 
@@ -156,6 +168,55 @@ class ContextEngine {
         return profile;
     }
 
+    /**
+     * Live-typing variant of parseInput. Word lookups, sentence parses and scale
+     * selections are cached, so only edited sentences/words are re-analyzed. When the
+     * scale-selection stage has not seen these lexical values before, it is debounced:
+     * the returned profile reuses the previous selection (harmonicProfile.provisional)
+     * and onSettled receives the final profile once typing pauses. The settled profile
+     * is exactly what parseInput(input, options) returns.
+     * @param {string} input
+     * @param {Object} options - same as parseInput
+     * @param {Function} onSettled - (profile) => void, called only when a provisional profile was returned
+     * @return {Object} Context profile
+     */
+    parseInputIncremental(input, options = {}, onSettled = null) {
+        if (this.scaleSelectionTimer) {
+            clearTimeout(this.scaleSelectionTimer);
+            this.scaleSelectionTimer = null;
+        }
+
+        const profile = this.parseInput(input, { ...options, deferScaleSelection: true });
+        if (!profile.harmonicProfile || !profile.harmonicProfile.provisional) {
+            return profile;
+        }
+
+        this.scaleSelectionTimer = setTimeout(() => {
+            this.scaleSelectionTimer = null;
+            const settled = this.parseInput(input, options);
+            if (typeof onSettled === 'function') onSettled(settled);
+        }, this.scaleSelectionDelay);
+        return profile;
+    }
+
+    /**
+     * Drop cached word, sentence and scale-selection analysis
+     */
+    clearIncrementalCaches() {
+        this.wordEntryCache.clear();
+        this.sentenceParseCache.clear();
+        this.physicsSelectionCache.clear();
+        this.lastPhysicsSelection = null;
+    }
+
+    _cacheSet(cache, key, value) {
+        if (cache.size >= this.incrementalCacheLimit) {
+            cache.delete(cache.keys().next().value);
+        }
+        cache.set(key, value);
+        return value;
+    }
+
     _createSeededRng(seed) {
         let t = (Number(seed) >>> 0) + 0x6D2B79F5;
         return () => {
@@ -775,11 +836,17 @@ class ContextEngine {
         }
 
         if (window.EMBEDDED_SCALES_DATA && Array.isArray(window.EMBEDDED_SCALES_DATA.scales)) {
+            // Keep one map per data object so the physics cache below can be reused
+            if (this.embeddedIntervalsMap && this.embeddedIntervalsSource === window.EMBEDDED_SCALES_DATA) {
+                return this.embeddedIntervalsMap;
+            }
             const map = {};
             window.EMBEDDED_SCALES_DATA.scales.forEach((scale) => {
                 if (!scale || !scale.id || !Array.isArray(scale.intervals)) return;
                 map[String(scale.id).toLowerCase()] = scale.intervals.slice();
             });
+            this.embeddedIntervalsSource = window.EMBEDDED_SCALES_DATA;
+            this.embeddedIntervalsMap = map;
             return map;
         }
 
@@ -874,23 +941,205 @@ class ContextEngine {
             return this.scalePhysicsCache;
         }
 
-        const entries = [];
+        const names = [];
+        const sources = [];
         for (const [name, intervals] of Object.entries(intervalsMap)) {
             if (!Array.isArray(intervals) || !intervals.length) continue;
-            entries.push({
-                name: String(name).toLowerCase(),
-                physics: this._extractScalePhysics(intervals)
-            });
+            names.push(String(name).toLowerCase());
+            sources.push(intervals);
         }
 
+        const snapshot = (typeof window !== 'undefined' && window.derivedIndexSnapshot) || null;
+        const signature = snapshot ? this._scalePhysicsSignature() : '';
+        const restored = snapshot ? this._restoreScalePhysicsEntries(snapshot.take('scalePhysics', signature), names) : null;
+        const entries = restored || names.map((name, i) => ({ name, physics: this._extractScalePhysics(sources[i]) }));
+
         this.scalePhysicsCache = {
             sourceRef: intervalsMap,
-            entries
+            entries,
+            columns: this._buildScalePhysicsColumns(entries)
         };
+        if (snapshot && !restored) {
+            snapshot.put('scalePhysics', signature, () => this._encodeScalePhysicsEntries(entries));
+        }
 
         return this.scalePhysicsCache;
     }
 
+    _scalePhysicsSignature() {
+        return 'physics-v1:' + ContextEngine.PHYSICS_AXES.join(',');
+    }
+
+    /**
+     * Snapshot form of the physics entries: names, interval masks, axis values and the two
+     * step densities. Everything else in a physics record follows from the mask.
+     */
+    _encodeScalePhysicsEntries(entries) {
+        const axes = ContextEngine.PHYSICS_AXES;
+        const masks = new Uint16Array(entries.length);
+        const values = new Float64Array(entries.length * axes.length);
+        const densities = new Float64Array(entries.length * 2);
+        entries.forEach((entry, i) => {
+            const p = entry.physics;
+            masks[i] = p.intervals.reduce((mask, n) => mask | (1 << n), 0);
+            for (let a = 0; a < axes.length; a++) values[i * axes.length + a] = p[axes[a]];
+            densities[i * 2] = p.semitoneDensity;
+            densities[i * 2 + 1] = p.leapDensity;
+        });
+        return { names: DerivedIndexSnapshot.joinStrings(entries.map(entry => entry.name)), masks, values, densities };
+    }
+
+    /**
+     * Physics entries from a snapshot payload, or null unless it covers exactly `names` in order
+     */
+    _restoreScalePhysicsEntries(payload, names) {
+        if (!payload) return null;
+        const stored = DerivedIndexSnapshot.splitStrings(payload.names);
+        if (stored.length !== names.length || stored.some((name, i) => name !== names[i])) return null;
+
+        const axes = ContextEngine.PHYSICS_AXES;
+        return stored.map((name, i) => {
+            const mask = payload.masks[i];
+            const has = (semi) => (mask & (1 << semi)) ? 1 : 0;
+            const intervals = [];
+            for (let semi = 0; semi < 12; semi++) if (has(semi)) intervals.push(semi);
+            const physics = {
+                noteCount: intervals.length,
+                intervals,
+                hasb2: has(1),
+                hasb3: has(3),
+                has3: has(4),
+                hasSharp4: has(6),
+                hasb6: has(8),
+                has6: has(9),
+                hasb7: has(10),
+                has7: has(11),
+                semitoneDensity: payload.densities[i * 2],
+                leapDensity: payload.densities[i * 2 + 1]
+            };
+            for (let a = 0; a < axes.length; a++) physics[axes[a]] = payload.values[i * axes.length + a];
+            return { name, physics };
+        });
+    }
+
+    /**
+     * Struct-of-arrays view of the physics cache for the scoring loop. Axis values
+     * stay double precision so scores match _scoreScalePhysics exactly.
+     */
+    _buildScalePhysicsColumns(entries) {
+        const count = entries.length;
+        const axes = ContextEngine.PHYSICS_AXES;
+        const values = new Float64Array(count * axes.length); // row-major: scale i, axis a
+        const flags = new Uint8Array(count);                  // ContextEngine.PHYSICS_FLAGS bits
+        const noteCount = new Uint8Array(count);
+        const indexByName = new Map();
+        const F = ContextEngine.PHYSICS_FLAGS;
+
+        entries.forEach((entry, i) => {
+            const p = entry.physics;
+            for (let a = 0; a < axes.length; a++) values[i * axes.length + a] = p[axes[a]] || 0;
+            flags[i] = (p.hasb7 ? F.b7 : 0) | (p.hasb6 ? F.b6 : 0) | (p.hasSharp4 ? F.sharp4 : 0)
+                | ((p.has7 || p.hasb2) ? F.pull : 0) | ((p.hasb3 || p.hasb2) ? F.dark : 0)
+                | ((p.has3 || p.has6) ? F.bright : 0);
+            noteCount[i] = p.noteCount;
+            if (!indexByName.has(entry.name)) indexByName.set(entry.name, i);
+        });
+
+        return { count, values, flags, noteCount, indexByName };
+    }
+
+    /**
+     * Score every cached scale against one target and keep the best k
+     * (score descending, catalog order on ties, as a stable full sort would).
+     * @return {Array} [{ index, score }]
+     */
+    _rankScalePhysics(columns, target, suggestedScale, k) {
+        const axes = ContextEngine.PHYSICS_AXES;
+        const weights = ContextEngine.PHYSICS_AXIS_WEIGHTS;
+        const axisCount = axes.length;
+        const weightSum = Math.max(0.0001, ContextEngine.PHYSICS_WEIGHT_SUM);
+        const F = ContextEngine.PHYSICS_FLAGS;
+        const { count, values, flags, noteCount } = columns;
+
+        const t = new Float64Array(axisCount);
+        for (let a = 0; a < axisCount; a++) t[a] = target[axes[a]] || 0;
+
+        // Bonus terms that depend only on the target, resolved once per target
+        const rel = target.release > 0.55;
+        const sha = target.shadow > 0.55;
+        const exp = target.expansion > 0.55;
+        const pul = target.pull > 0.55;
+        const drk = target.darkness > 0.55;
+        const brt = target.brightness > 0.55;
+        const desiredNotes = 5 + Math.round(target.complexity * 4);
+
+        let suggestedIndex = -1;
+        if (suggestedScale) {
+            const key = String(suggestedScale).toLowerCase().replace(/\s+/g, '_');
+            if (columns.indexByName.has(key)) suggestedIndex = columns.indexByName.get(key);
+        }
+
+        // Fixed-size min-heap on (score, -index): heap[0] is the weakest kept entry
+        const heapScore = new Float64Array(k);
+        const heapIndex = new Int32Array(k);
+        let size = 0;
+        const weaker = (sa, ia, sb, ib) => sa < sb || (sa === sb && ia > ib);
+
+        for (let i = 0; i < count; i++) {
+            const row = i * axisCount;
+            let diff = 0;
+            for (let a = 0; a < axisCount; a++) {
+                diff += Math.abs(t[a] - values[row + a]) * weights[a];
+            }
+            let score = 1 - (diff / weightSum);
+            score = score < 0 ? 0 : (score > 1 ? 1 : score);
+
+            const f = flags[i];
+            if (rel) score += (f & F.b7) ? 0.07 : -0.03;
+            if (sha) score += (f & F.b6) ? 0.07 : -0.03;
+            if (exp) score += (f & F.sharp4) ? 0.06 : -0.02;
+            if (pul) score += (f & F.pull) ? 0.06 : -0.02;
+            if (drk) score += (f & F.dark) ? 0.06 : -0.02;
+            if (brt) score += (f & F.bright) ? 0.06 : -0.03;
+            score -= Math.abs(noteCount[i] - desiredNotes) * 0.012;
+            if (i === suggestedIndex) score += 0.03;
+            score = score < 0 ? 0 : (score > 1 ? 1 : score);
+
+            if (size < k) {
+                // sift up
+                let c = size++;
+                while (c > 0) {
+                    const parent = (c - 1) >> 1;
+                    if (!weaker(score, i, heapScore[parent], heapIndex[parent])) break;
+                    heapScore[c] = heapScore[parent];
+                    heapIndex[c] = heapIndex[parent];
+                    c = parent;
+                }
+                heapScore[c] = score;
+                heapIndex[c] = i;
+            } else if (weaker(heapScore[0], heapIndex[0], score, i)) {
+                // replace root, sift down
+                let c = 0;
+                for (;;) {
+                    const l = 2 * c + 1;
+                    if (l >= size) break;
+                    const r = l + 1;
+                    const m = (r < size && weaker(heapScore[r], heapIndex[r], heapScore[l], heapIndex[l])) ? r : l;
+                    if (!weaker(heapScore[m], heapIndex[m], score, i)) break;
+                    heapScore[c] = heapScore[m];
+                    heapIndex[c] = heapIndex[m];
+                    c = m;
+                }
+                heapScore[c] = score;
+                heapIndex[c] = i;
+            }
+        }
+
+        const ranked = [];
+        for (let j = 0; j < size; j++) ranked.push({ index: heapIndex[j], score: heapScore[j] });
+        return ranked.sort((a, b) => (b.score - a.score) || (a.index - b.index));
+    }
+
     _buildScalePhysicsTarget(lexicalHint, emotionalTone) {
         const valence = lexicalHint.avgValence || 0;
         const arousal = lexicalHint.avgArousal || 0;
@@ -932,23 +1181,18 @@ class ContextEngine {
         };
     }
 
+    /**
+     * Reference scorer for one scale; _rankScalePhysics is the batched equivalent
+     */
     _scoreScalePhysics(target, scalePhysics, lexicalHint, scaleName = '') {
-        const w = {
-            darkness: 0.2,
-            brightness: 0.17,
-            pull: 0.14,
-            release: 0.14,
-            expansion: 0.11,
-            shadow: 0.11,
-            stability: 0.08,
-            complexity: 0.05
-        };
+        const axes = ContextEngine.PHYSICS_AXES;
+        const weights = ContextEngine.PHYSICS_AXIS_WEIGHTS;
 
         let diff = 0;
         let weightSum = 0;
-        for (const [axis, weight] of Object.entries(w)) {
-            weightSum += weight;
-            diff += Math.abs((target[axis] || 0) - (scalePhysics[axis] || 0)) * weight;
+        for (let a = 0; a < axes.length; a++) {
+            weightSum += weights[a];
+            diff += Math.abs((target[axes[a]] || 0) - (scalePhysics[axes[a]] || 0)) * weights[a];
         }
 
         let score = this._clamp(1 - (diff / Math.max(0.0001, weightSum)), 0, 1);
@@ -975,34 +1219,64 @@ class ContextEngine {
         return this._clamp(score, 0, 1);
     }
 
-    _selectScaleByIntervalPhysics(lexicalHint, emotionalTone) {
+    _selectScaleByIntervalPhysics(lexicalHint, emotionalTone, options = {}) {
         const cache = this._buildScalePhysicsCache();
         if (!cache || !Array.isArray(cache.entries) || !cache.entries.length) {
             return null;
         }
 
+        if (this.physicsSelectionSource !== cache) {
+            this.physicsSelectionCache.clear();
+            this.physicsSelectionSource = cache;
+        }
+
         const target = this._buildScalePhysicsTarget(lexicalHint, emotionalTone);
-        const scored = cache.entries.map((entry) => {
-            const score = this._scoreScalePhysics(target, entry.physics, lexicalHint, entry.name);
-            return {
-                name: entry.name,
-                score,
-                physics: entry.physics
-            };
-        }).sort((a, b) => b.score - a.score);
+        const memoKey = Object.keys(target).map((axis) => target[axis]).join(',') + '|' + (lexicalHint.suggestedScale || '');
+        const hit = this.physicsSelectionCache.get(memoKey);
+        if (hit) return { ...hit, alternatives: hit.alternatives.slice() };
+        if (options.peek) return null;
+
+        const selection = this._selectionFromRanking(
+            cache,
+            this._rankScalePhysics(cache.columns, target, lexicalHint.suggestedScale, ContextEngine.PHYSICS_TOP_K),
+            target
+        );
+        this._cacheSet(this.physicsSelectionCache, memoKey, selection);
+        this.lastPhysicsSelection = selection;
+        return { ...selection, alternatives: selection.alternatives.slice() };
+    }
 
-        const recommendedScale = scored[0] ? scored[0].name : null;
-        const selectedPhysics = scored[0] ? scored[0].physics : null;
-        const alternatives = scored
-            .slice(1, 6)
-            .map((item) => item.name)
-            .filter(Boolean);
+    /**
+     * Score many targets in one pass over the cache (e.g. one per arc segment).
+     * @param {Array} requests - [{ lexicalHint, emotionalTone }] or [{ target, suggestedScale }]
+     * @param {Object} options - { k } number of ranked scales to keep per request (default 6)
+     * @return {Array} one selection per request, same shape as _selectScaleByIntervalPhysics,
+     *                 plus ranked: [{ name, score }]
+     */
+    selectScalesByIntervalPhysicsBatch(requests, options = {}) {
+        const cache = this._buildScalePhysicsCache();
+        if (!cache || !cache.entries.length || !Array.isArray(requests)) {
+            return (requests || []).map(() => null);
+        }
+        const k = Math.max(1, Math.min(cache.entries.length, options.k || ContextEngine.PHYSICS_TOP_K));
+        return requests.map((req) => {
+            if (!req) return null;
+            const target = req.target || this._buildScalePhysicsTarget(req.lexicalHint || {}, req.emotionalTone);
+            const suggested = req.target ? req.suggestedScale : (req.lexicalHint && req.lexicalHint.suggestedScale);
+            const ranking = this._rankScalePhysics(cache.columns, target, suggested, k);
+            const selection = this._selectionFromRanking(cache, ranking, target);
+            selection.ranked = ranking.map((item) => ({ name: cache.entries[item.index].name, score: item.score }));
+            return selection;
+        });
+    }
 
+    _selectionFromRanking(cache, ranking, target) {
+        const best = ranking[0] ? cache.entries[ranking[0].index] : null;
         return {
-            recommendedScale,
-            alternatives,
-            score: scored[0] ? scored[0].score : 0,
-            selectedPhysics,
+            recommendedScale: best ? best.name : null,
+            alternatives: ranking.slice(1, 6).map((item) => cache.entries[item.index].name).filter(Boolean),
+            score: ranking[0] ? ranking[0].score : 0,
+            selectedPhysics: best ? best.physics : null,
             target
         };
     }
@@ -1150,14 +1424,21 @@ class ContextEngine {
     _analyzeWithCompromise(text) {
         if (typeof nlp === 'undefined') return {};
         try {
-            const doc = nlp(text);
             const result = {};
 
-            // Build POS weight map
-            const adjSet  = new Set(doc.adjectives().out('array').map(w => w.toLowerCase()));
-            const verbSet  = new Set(doc.verbs().out('array').map(w => w.toLowerCase()));
-            const nounSet  = new Set(doc.nouns().out('array').map(w => w.toLowerCase()));
-            const allTerms = doc.terms().out('array').map(w => w.toLowerCase());
+            // Build POS weight map from per-sentence parses (cached, so an edit
+            // only re-parses the sentence it touched)
+            const adjSet  = new Set();
+            const verbSet = new Set();
+            const nounSet = new Set();
+            const allTerms = [];
+            for (const sentence of this._splitSentences(text)) {
+                const parsed = this._parseSentence(sentence);
+                parsed.adjectives.forEach(w => adjSet.add(w));
+                parsed.verbs.forEach(w => verbSet.add(w));
+                parsed.nouns.forEach(w => nounSet.add(w));
+                for (const term of parsed.terms) allTerms.push(term);
+            }
 
             for (const w of allTerms) {
                 if (!result[w]) result[w] = { weight: 0.8, negated: false, intensified: false };
@@ -1199,6 +1480,73 @@ class ContextEngine {
         }
     }
 
+    _splitSentences(text) {
+        return String(text || '')
+            .split(/(?<=[.!?])\s+|\n+/)
+            .map((sentence) => sentence.trim())
+            .filter(Boolean);
+    }
+
+    _parseSentence(sentence) {
+        const cached = this.sentenceParseCache.get(sentence);
+        if (cached) return cached;
+        const doc = nlp(sentence);
+        const lower = (list) => list.map(w => w.toLowerCase());
+        return this._cacheSet(this.sentenceParseCache, sentence, {
+            adjectives: lower(doc.adjectives().out('array')),
+            verbs: lower(doc.verbs().out('array')),
+            nouns: lower(doc.nouns().out('array')),
+            terms: lower(doc.terms().out('array'))
+        });
+    }
+
+    /**
+     * Lexicon lookups for one word before sentence-level modifiers are applied.
+     * `indexed` is the word's LexiconIndex entry from db.lookupMany (null = unknown);
+     * when omitted the database is queried per word.
+     */
+    _lexicalWordEntry(word, db, indexed) {
+        if (this.wordEntryCacheDb !== db) {
+            this.wordEntryCache.clear();
+            this.wordEntryCacheDb = db;
+        }
+        const cached = this.wordEntryCache.get(word);
+        if (cached) return cached;
+
+        let emotion = { valence: 0, arousal: 0, dominance: 0 };
+        const hasDirectLexiconEntry = !!(db && db.emotions && db.emotions[word]);
+
+        const hasIndexed = indexed !== undefined;
+        const indexedEmotion = hasIndexed && indexed && indexed.mask !== null ? indexed : null;
+        if (hasIndexed) {
+            if (indexedEmotion) {
+                emotion = { valence: indexedEmotion.valence, arousal: indexedEmotion.arousal, dominance: indexedEmotion.dominance };
+            }
+        } else if (db && typeof db.getEmotionalValence === 'function') {
+            emotion = db.getEmotionalValence(word) || emotion;
+        }
+
+        const fallback = this._fallbackLexicalEmotion(word);
+        if (((this._isNeutralEmotion(emotion) || !hasDirectLexiconEntry) || !db) && fallback) {
+            emotion = {
+                valence:   fallback.valence   || 0,
+                arousal:   fallback.arousal   || 0,
+                dominance: fallback.dominance || 0
+            };
+        }
+
+        let category = null;
+        if (hasIndexed) {
+            if (indexedEmotion) {
+                category = { name: indexedEmotion.category, scales: indexedEmotion.scale ? [indexedEmotion.scale] : [] };
+            }
+        } else if (db && typeof db.getSemanticCategory === 'function') {
+            category = db.getSemanticCategory(word);
+        }
+
+        return this._cacheSet(this.wordEntryCache, word, { emotion: { ...emotion }, fallback, category });
+    }
+
     _analyzeLexicalSemantics(input, normalized) {
         const words = this._tokenizeWords(normalized);
         if (!words.length) {
@@ -1226,22 +1574,24 @@ class ContextEngine {
         const categories = {};
         let suggestedScale = null;
 
-        for (const word of words) {
-            let emotion = { valence: 0, arousal: 0, dominance: 0 };
-            const hasDirectLexiconEntry = !!(db && db.emotions && db.emotions[word]);
-
-            if (db && typeof db.getEmotionalValence === 'function') {
-                emotion = db.getEmotionalValence(word) || emotion;
+        // Resolve every uncached word in one index pass
+        const indexed = new Map();
+        if (db && typeof db.lookupMany === 'function') {
+            if (this.wordEntryCacheDb !== db) {
+                this.wordEntryCache.clear();
+                this.wordEntryCacheDb = db;
             }
-
-            const fallback = this._fallbackLexicalEmotion(word);
-            if (((this._isNeutralEmotion(emotion) || !hasDirectLexiconEntry) || !db) && fallback) {
-                emotion = {
-                    valence:   fallback.valence   || 0,
-                    arousal:   fallback.arousal   || 0,
-                    dominance: fallback.dominance || 0
-                };
+            const missing = [...new Set(words.filter(w => !this.wordEntryCache.has(w)))];
+            if (missing.length) {
+                const found = db.lookupMany(missing);
+                missing.forEach((w, i) => indexed.set(w, found[i] || null));
             }
+        }
+
+        for (const word of words) {
+            const entry = this._lexicalWordEntry(word, db, indexed.has(word) ? indexed.get(word) : undefined);
+            const fallback = entry.fallback;
+            let emotion = { ...entry.emotion };
 
             // Apply compromise modifiers
             const meta = compMeta[word] || {};
@@ -1258,14 +1608,11 @@ class ContextEngine {
 
             values.push(emotion);
 
-            let category = null;
-            if (db && typeof db.getSemanticCategory === 'function') {
-                category = db.getSemanticCategory(word);
-                if (category && category.name) {
-                    categories[category.name] = (categories[category.name] || 0) + 1;
-                    if (!suggestedScale && category.name !== 'other' && Array.isArray(category.scales) && category.scales.length) {
-                        suggestedScale = category.scales[0];
-                    }
+            const category = entry.category;
+            if (category && category.name) {
+                categories[category.name] = (categories[category.name] || 0) + 1;
+                if (!suggestedScale && category.name !== 'other' && Array.isArray(category.scales) && category.scales.length) {
+                    suggestedScale = category.scales[0];
                 }
             }
 
@@ -1299,7 +1646,7 @@ class ContextEngine {
             .map(([name]) => name);
 
         if (!suggestedScale && db && typeof db.getSemanticCategory === 'function') {
-            const firstCategory = db.getSemanticCategory(words[0]);
+            const firstCategory = this._lexicalWordEntry(words[0], db).category;
             if (firstCategory && firstCategory.name !== 'other' && Array.isArray(firstCategory.scales) && firstCategory.scales.length) {
                 suggestedScale = firstCategory.scales[0];
             }
@@ -1440,7 +1787,12 @@ class ContextEngine {
         const normalizedName = String(scaleName || '').toLowerCase().replace(/\s+/g, '_');
         let intervals = null;
 
-        if (typeof window !== 'undefined' && window.EMBEDDED_SCALES_DATA && Array.isArray(window.EMBEDDED_SCALES_DATA.scales)) {
+        if (typeof window !== 'undefined' && window.ScaleCatalogPacked) {
+            const match = window.ScaleCatalogPacked.findByIdOrName(normalizedName);
+            if (match && Array.isArray(match.intervals) && match.intervals.length) {
+                intervals = match.intervals;
+            }
+        } else if (typeof window !== 'undefined' && window.EMBEDDED_SCALES_DATA && Array.isArray(window.EMBEDDED_SCALES_DATA.scales)) {
             const match = window.EMBEDDED_SCALES_DATA.scales.find((scale) => {
                 if (!scale) return false;
                 const byId = String(scale.id || '').toLowerCase() === normalizedName;
@@ -1493,7 +1845,18 @@ class ContextEngine {
         let physicsScore = 0;
         let intervalPhysics = null;
 
-        const physicsSelection = this._selectScaleByIntervalPhysics(lexicalHint, emotionalTone);
+        let provisional = false;
+        let physicsSelection;
+        if (options.deferScaleSelection) {
+            // Live typing: use a cached selection, or the previous one until typing pauses
+            physicsSelection = this._selectScaleByIntervalPhysics(lexicalHint, emotionalTone, { peek: true });
+            if (!physicsSelection && this._buildScalePhysicsCache()) {
+                physicsSelection = this.lastPhysicsSelection;
+                provisional = true;
+            }
+        } else {
+            physicsSelection = this._selectScaleByIntervalPhysics(lexicalHint, emotionalTone);
+        }
         if (physicsSelection && physicsSelection.recommendedScale) {
             recommendedScale = physicsSelection.recommendedScale;
             alternatives = physicsSelection.alternatives || [];
@@ -1539,7 +1902,7 @@ class ContextEngine {
             || this._deriveApproachScale(recommendedScale, emotionalTone, lexicalHint);
         const scaleNotes = this._resolveScaleNotes(recommendedScale, root);
 
-        return {
+        const profile = {
             root,
             recommendedScale,
             approachScale,
@@ -1552,10 +1915,19 @@ class ContextEngine {
             verticalPressure: lexicalHint.verticalPressure,
             harmonicComplexity: this._clamp(0.3 + (lexicalHint.semanticWeight * 0.45) + (lexicalHint.polaritySpread * 0.2), 0, 1)
         };
+        if (provisional) profile.provisional = true;
+        return profile;
     }
 
 }
 
+// Interval-physics scoring axes, in the order their weighted differences are summed
+ContextEngine.PHYSICS_AXES = ['darkness', 'brightness', 'pull', 'release', 'expansion', 'shadow', 'stability', 'complexity'];
+ContextEngine.PHYSICS_AXIS_WEIGHTS = new Float64Array([0.2, 0.17, 0.14, 0.14, 0.11, 0.11, 0.08, 0.05]);
+ContextEngine.PHYSICS_WEIGHT_SUM = ContextEngine.PHYSICS_AXIS_WEIGHTS.reduce((sum, w) => sum + w, 0);
+ContextEngine.PHYSICS_FLAGS = { b7: 1, b6: 2, sharp4: 4, pull: 8, dark: 16, bright: 32 };
+ContextEngine.PHYSICS_TOP_K = 6; // winner + 5 alternatives
+
 // Export for Node.js and browser
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = ContextEngine;
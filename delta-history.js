@@ -0,0 +1,205 @@
+/**
+ * @module DeltaHistory
+ * @description Capped ring buffer of number-sequence snapshots stored as diffs
+ * @exports class DeltaHistory
+ * @feature Fixed capacity: pushing past it evicts the oldest entry, no array copies
+ * @feature Entries are patches against the previous entry, with a full keyframe every few entries,
+ *          so reading any entry applies at most `keyframeInterval` patches
+ * @feature Compact JSON form for persistence (toJSON/fromJSON)
+ *
+ * Index 0 is the oldest entry; push/pop work on the newest end (stack order).
+ */
+
+class DeltaHistory {
+    constructor(capacity = 50, options = {}) {
+        this.capacity = Math.max(1, capacity | 0);
+        this.keyframeInterval = options.keyframeInterval || 8;
+        this.slots = new Array(this.capacity);
+        this.head = 0;      // slot of the oldest entry
+        this.count = 0;
+        this.tailNumbers = null; // materialized numbers of the newest entry
+    }
+
+    get length() {
+        return this.count;
+    }
+
+    _slot(index) {
+        return (this.head + index) % this.capacity;
+    }
+
+    /**
+     * Append a record { numbers, type, timestamp }; evicts the oldest when full
+     */
+    push(record) {
+        if (this.count === this.capacity) this.shift();
+        const numbers = Array.isArray(record.numbers) ? record.numbers : [];
+        const prev = this.count > 0 ? this.slots[this._slot(this.count - 1)] : null;
+
+        let entry = null;
+        if (prev && prev.depth + 1 < this.keyframeInterval) {
+            const base = this._tail();
+            const changes = DeltaHistory.diff(base, numbers);
+            // A patch that rewrites most of the sequence is no smaller than a keyframe
+            if (changes.length / 2 <= numbers.length / 2) {
+                entry = { numbers: null, patch: { length: numbers.length, changes }, depth: prev.depth + 1 };
+            }
+        }
+        if (!entry) entry = { numbers: numbers.slice(), patch: null, depth: 0 };
+        entry.type = record.type;
+        entry.timestamp = record.timestamp;
+
+        this.slots[this._slot(this.count)] = entry;
+        this.count++;
+        this.tailNumbers = numbers.slice();
+        return this;
+    }
+
+    /**
+     * Remove and return the newest record (materialized)
+     */
+    pop() {
+        if (this.count === 0) return null;
+        const record = this.get(this.count - 1);
+        const slot = this._slot(this.count - 1);
+        this.slots[slot] = undefined;
+        this.count--;
+        this.tailNumbers = null;
+        return record;
+    }
+
+    /**
+     * Remove the oldest entry; its successor becomes a keyframe if it was a patch
+     */
+    shift() {
+        if (this.count === 0) return null;
+        const record = this.get(0);
+        this.slots[this.head] = undefined;
+        this.head = (this.head + 1) % this.capacity;
+        this.count--;
+        if (this.count === 0) {
+            this.tailNumbers = null;
+        } else {
+            const first = this.slots[this.head];
+            if (first.patch) {
+                first.numbers = DeltaHistory.apply(record.numbers, first.patch);
+                first.patch = null;
+                first.depth = 0;
+            }
+        }
+        return record;
+    }
+
+    peekLast() {
+        return this.count > 0 ? this.get(this.count - 1) : null;
+    }
+
+    /**
+     * Materialize entry `index` (0 = oldest): walk back to its keyframe, then apply patches
+     */
+    get(index) {
+        if (index < 0 || index >= this.count) return null;
+        let start = index;
+        while (!this.slots[this._slot(start)].numbers) start--;
+        let numbers = this.slots[this._slot(start)].numbers.slice();
+        for (let i = start + 1; i <= index; i++) {
+            numbers = DeltaHistory.apply(numbers, this.slots[this._slot(i)].patch);
+        }
+        const entry = this.slots[this._slot(index)];
+        return { numbers, type: entry.type, timestamp: entry.timestamp };
+    }
+
+    _tail() {
+        if (!this.tailNumbers) {
+            const last = this.get(this.count - 1);
+            this.tailNumbers = last ? last.numbers : [];
+        }
+        return this.tailNumbers;
+    }
+
+    clear() {
+        this.slots = new Array(this.capacity);
+        this.head = 0;
+        this.count = 0;
+        this.tailNumbers = null;
+        return this;
+    }
+
+    /**
+     * All records, oldest first
+     */
+    toArray() {
+        const out = new Array(this.count);
+        let numbers = null;
+        for (let i = 0; i < this.count; i++) {
+            const entry = this.slots[this._slot(i)];
+            numbers = entry.numbers ? entry.numbers.slice() : DeltaHistory.apply(numbers, entry.patch);
+            out[i] = { numbers, type: entry.type, timestamp: entry.timestamp };
+        }
+        return out;
+    }
+
+    /**
+     * Compact persisted form: keyframes carry `n`, patches carry `p` ([length, i, v, i, v...])
+     */
+    toJSON() {
+        const entries = [];
+        for (let i = 0; i < this.count; i++) {
+            const entry = this.slots[this._slot(i)];
+            const out = { y: entry.type, t: entry.timestamp };
+            if (entry.numbers) out.n = entry.numbers;
+            else out.p = [entry.patch.length, ...entry.patch.changes];
+            entries.push(out);
+        }
+        return { v: 2, entries };
+    }
+
+    static fromJSON(data, capacity, options) {
+        const history = new DeltaHistory(capacity, options);
+        const entries = data && Array.isArray(data.entries) ? data.entries : [];
+        let numbers = null;
+        entries.forEach(entry => {
+            if (Array.isArray(entry.n)) numbers = entry.n.slice();
+            else if (Array.isArray(entry.p) && numbers) {
+                numbers = DeltaHistory.apply(numbers, { length: entry.p[0], changes: entry.p.slice(1) });
+            } else return;
+            history.push({ numbers, type: entry.y, timestamp: entry.t });
+        });
+        return history;
+    }
+
+    /**
+     * Records given oldest first
+     */
+    static fromArray(records, capacity, options) {
+        const history = new DeltaHistory(capacity, options);
+        (records || []).forEach(record => {
+            if (record && Array.isArray(record.numbers)) history.push(record);
+        });
+        return history;
+    }
+
+    /**
+     * Flat [index, value, ...] list of positions where `next` differs from `base`
+     */
+    static diff(base, next) {
+        const changes = [];
+        for (let i = 0; i < next.length; i++) {
+            if (base[i] !== next[i]) changes.push(i, next[i]);
+        }
+        return changes;
+    }
+
+    static apply(base, patch) {
+        const numbers = base.slice(0, patch.length);
+        for (let i = numbers.length; i < patch.length; i++) numbers.push(undefined);
+        const changes = patch.changes;
+        for (let i = 0; i < changes.length; i += 2) numbers[changes[i]] = changes[i + 1];
+        return numbers;
+    }
+}
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = DeltaHistory;
+}
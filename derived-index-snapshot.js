@@ -0,0 +1,265 @@
+/**
+ * @module DerivedIndexSnapshot
+ * @description IndexedDB cache for indexes derived from the scale catalog, so warm visits skip rebuilding them
+ * @exports class DerivedIndexSnapshot
+ * @feature One record per section (scale catalog, scale physics, chord tables), stored as typed arrays plus string tables
+ * @feature Records are keyed by a content hash of the packed scale data and the manual taxonomy overrides; any mismatch is dropped and rebuilt
+ * @feature Loads asynchronously at script time; owners call take() when they would build and put() after they did
+ * @feature Writes are deferred to idle time and payloads are encoded lazily; ?nosnapshot or localStorage 'derived-snapshot' = 'off' disables it
+ */
+
+class DerivedIndexSnapshot {
+    constructor(options = {}) {
+        this.dbName = options.dbName || 'derived-index-snapshot';
+        this.storeName = options.storeName || 'sections';
+        this.hash = options.hash || null;   // null disables the cache (take() misses, put() is dropped)
+        this.loadTimeout = options.loadTimeout || 1500;
+        this.saveDelay = options.saveDelay || 2000;
+        this.loaded = false;
+        this.sections = new Map();          // name -> { signature, payload } restored for this hash
+        this.pending = new Map();           // name -> { signature, encode } waiting for the idle write
+        this.saveTimer = null;
+        this.stats = { hits: 0, misses: 0, stale: 0, writes: 0 };
+        this.ready = null;
+    }
+
+    /**
+     * Instance hashed over the page's scale data and taxonomy overrides; starts loading right away
+     */
+    static fromEnvironment(options = {}) {
+        let disabled = typeof indexedDB === 'undefined';
+        try {
+            disabled = disabled || /[?&]nosnapshot(=1|&|$)/.test(window.location.search)
+                || window.localStorage.getItem('derived-snapshot') === 'off';
+        } catch (_) {}
+        const snapshot = new DerivedIndexSnapshot({
+            ...options,
+            hash: disabled ? null : DerivedIndexSnapshot.contentHash(window)
+        });
+        snapshot.load();
+        return snapshot;
+    }
+
+    /**
+     * Hash of the catalog sources that every section is derived from, or null when none is present.
+     * Reads the packed catalog when it's there; EMBEDDED_SCALES_DATA is then a lazy getter and must not be touched.
+     */
+    static contentHash(scope) {
+        const packed = scope.EMBEDDED_SCALES_PACKED || null;
+        let source = null;
+        if (packed) {
+            source = [packed.format, packed.count, JSON.stringify(packed.defaults), packed.strings, packed.records.join(',')];
+        } else if (scope.EMBEDDED_SCALES_DATA) {
+            source = [JSON.stringify(scope.EMBEDDED_SCALES_DATA)];
+        }
+        if (!source) return null;
+        source.push(JSON.stringify(scope.MANUAL_TAXONOMY_REVIEWS || null), String(DerivedIndexSnapshot.VERSION));
+        return DerivedIndexSnapshot.hashStrings(source);
+    }
+
+    /**
+     * Two FNV-1a passes with different offsets, as 16 hex digits
+     */
+    static hashStrings(parts) {
+        let a = 0x811c9dc5;
+        let b = 0x01000193 ^ 0x5bd1e995;
+        parts.forEach(part => {
+            const text = String(part);
+            for (let i = 0; i < text.length; i++) {
+                const c = text.charCodeAt(i);
+                a = Math.imul(a ^ c, 0x01000193);
+                b = Math.imul(b ^ c, 0x01000193) ^ (b >>> 15);
+            }
+            a = Math.imul(a ^ 0x1f, 0x01000193); // part separator
+            b = Math.imul(b ^ 0x1f, 0x01000193);
+        });
+        const hex = (n) => (n >>> 0).toString(16).padStart(8, '0');
+        return hex(a) + hex(b);
+    }
+
+    // --- String tables (section payloads store strings as one joined text plus integer ids) ---
+
+    static joinStrings(list) {
+        return list.join(DerivedIndexSnapshot.STRING_SEPARATOR);
+    }
+
+    static splitStrings(text) {
+        return text ? text.split(DerivedIndexSnapshot.STRING_SEPARATOR) : [];
+    }
+
+    /**
+     * Interning pool: id(value) returns a stable small integer, text() the joined table
+     */
+    static createStringPool() {
+        const ids = new Map();
+        const list = [];
+        return {
+            id(value) {
+                const key = String(value);
+                if (!ids.has(key)) { ids.set(key, list.length); list.push(key); }
+                return ids.get(key);
+            },
+            text() { return DerivedIndexSnapshot.joinStrings(list); }
+        };
+    }
+
+    // --- Lifecycle ---
+
+    load() {
+        if (this.ready) return this.ready;
+        if (!this.hash) {
+            this.loaded = true;
+            this.ready = Promise.resolve(this);
+            return this.ready;
+        }
+        this.ready = new Promise(resolve => {
+            const finish = () => {
+                if (this.loaded) return;
+                this.loaded = true;
+                resolve(this);
+            };
+            // A blocked or very slow open must not hold anything up; owners just build as before
+            setTimeout(finish, this.loadTimeout);
+            this._readAll().then(records => {
+                if (this.loaded) return;
+                const stale = [];
+                records.forEach(record => {
+                    if (record && record.hash === this.hash && record.version === DerivedIndexSnapshot.VERSION) {
+                        this.sections.set(record.name, { signature: record.signature, payload: record.payload });
+                    } else if (record) {
+                        stale.push(record.name);
+                    }
+                });
+                this.stats.stale += stale.length;
+                if (stale.length) this._delete(stale);
+                finish();
+            }).catch(err => {
+                console.warn('DerivedIndexSnapshot: could not read snapshot, rebuilding indexes', err);
+                finish();
+            });
+        });
+        return this.ready;
+    }
+
+    /**
+     * Restored payload for a section built with this signature, or null (not loaded yet, missing or stale).
+     * Payloads are shared between callers, so owners decode them into fresh structures.
+     */
+    take(name, signature = '') {
+        const section = this.sections.get(name);
+        if (!section || section.signature !== signature) {
+            if (this.hash) this.stats.misses++;
+            return null;
+        }
+        this.stats.hits++;
+        return section.payload;
+    }
+
+    /**
+     * Queue a freshly built section; encode() runs at write time so cold starts don't pay for it
+     */
+    put(name, signature, encode) {
+        if (!this.hash || typeof encode !== 'function') return;
+        this.pending.set(name, { signature: signature || '', encode });
+        this._scheduleSave();
+    }
+
+    async flush() {
+        if (this.saveTimer) { clearTimeout(this.saveTimer); this.saveTimer = null; }
+        if (!this.pending.size) return;
+        const records = [];
+        this.pending.forEach(({ signature, encode }, name) => {
+            try {
+                const payload = encode();
+                if (payload) records.push({ name, hash: this.hash, version: DerivedIndexSnapshot.VERSION, signature, savedAt: Date.now(), payload });
+            } catch (err) {
+                console.warn(`DerivedIndexSnapshot: could not encode ${name}`, err);
+            }
+        });
+        this.pending.clear();
+        if (!records.length) return;
+        try {
+            await this._transaction('readwrite', store => records.forEach(record => store.put(record)));
+            this.stats.writes += records.length;
+        } catch (err) {
+            console.warn('DerivedIndexSnapshot: could not write snapshot', err);
+        }
+    }
+
+    async clear() {
+        this.sections.clear();
+        this.pending.clear();
+        if (!this.hash) return;
+        try {
+            await this._transaction('readwrite', store => store.clear());
+        } catch (err) {
+            console.warn('DerivedIndexSnapshot: could not clear snapshot', err);
+        }
+    }
+
+    getStats() {
+        return { ...this.stats, hash: this.hash, loaded: this.loaded, sections: Array.from(this.sections.keys()) };
+    }
+
+    // --- IndexedDB plumbing ---
+
+    _scheduleSave() {
+        if (this.saveTimer) return;
+        this.saveTimer = setTimeout(() => {
+            this.saveTimer = null;
+            const run = () => this.flush();
+            if (typeof requestIdleCallback === 'function') requestIdleCallback(run, { timeout: 5000 });
+            else run();
+        }, this.saveDelay);
+    }
+
+    _open() {
+        if (!this.dbPromise) {
+            this.dbPromise = new Promise((resolve, reject) => {
+                const request = indexedDB.open(this.dbName, 1);
+                request.onupgradeneeded = () => {
+                    const db = request.result;
+                    if (!db.objectStoreNames.contains(this.storeName)) db.createObjectStore(this.storeName, { keyPath: 'name' });
+                };
+                request.onsuccess = () => resolve(request.result);
+                request.onerror = () => reject(request.error);
+                request.onblocked = () => reject(new Error('snapshot database blocked'));
+            });
+        }
+        return this.dbPromise;
+    }
+
+    async _transaction(mode, work) {
+        const db = await this._open();
+        return new Promise((resolve, reject) => {
+            const tx = db.transaction(this.storeName, mode);
+            const result = work(tx.objectStore(this.storeName));
+            tx.oncomplete = () => resolve(result && 'result' in result ? result.result : undefined);
+            tx.onerror = () => reject(tx.error);
+            tx.onabort = () => reject(tx.error);
+        });
+    }
+
+    async _readAll() {
+        const records = await this._transaction('readonly', store => store.getAll());
+        return Array.isArray(records) ? records : [];
+    }
+
+    _delete(names) {
+        this._transaction('readwrite', store => names.forEach(name => store.delete(name)))
+            .catch(err => console.warn('DerivedIndexSnapshot: could not drop stale sections', err));
+    }
+}
+
+DerivedIndexSnapshot.VERSION = 1;             // bump when any section's encoding changes
+DerivedIndexSnapshot.STRING_SEPARATOR = '\u001f';
+
+// Start reading as early as possible; the scale loader and engines pick sections up once it lands
+if (typeof window !== 'undefined' && typeof document !== 'undefined' && !window.derivedIndexSnapshot) {
+    window.derivedIndexSnapshot = DerivedIndexSnapshot.fromEnvironment();
+}
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = DerivedIndexSnapshot;
+}
@@ -1,12 +1,25 @@
 // Minimal static dev server for the Music Theory Studio.
 // Usage: `npm start` (defaults to http://localhost:8000/modular-music-theory.html)
+//
+// Production mode (`npm run start:prod`, or NODE_ENV=production / --prod) is meant
+// for serving on a LAN: files are cached in memory with gzip/brotli variants,
+// responses carry ETags (If-None-Match -> 304), `?v=` assets are cached for a
+// year, and large files are streamed. Set HOST=0.0.0.0 to listen beyond localhost.
 
 const http = require('http');
 const fs = require('fs');
 const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
 
 const PORT = Number(process.env.PORT) || 8000;
+const HOST = process.env.HOST || '127.0.0.1';
 const ROOT = process.cwd();
+const PRODUCTION = process.env.NODE_ENV === 'production' || process.argv.includes('--prod');
+
+const MAX_CACHED_BYTES = 4 * 1024 * 1024;   // larger files are streamed, not held in memory
+const STAT_RECHECK_MS = 2000;               // how often a cached file is re-validated against disk
+const MIN_COMPRESS_BYTES = 1024;
 
 const MIME = {
   '.html': 'text/html; charset=utf-8',
@@ -20,15 +33,23 @@ const MIME = {
   '.gif': 'image/gif',
   '.webp': 'image/webp',
   '.ico': 'image/x-icon',
-  '.txt': 'text/plain; charset=utf-8'
+  '.txt': 'text/plain; charset=utf-8',
+  '.mp3': 'audio/mpeg'
 };
 
+function isCompressible(contentType) {
+  return /^text\/|javascript|json|svg/.test(contentType);
+}
+
+// Request path -> file under ROOT, or null when it would leave ROOT (sibling dirs like
+// ROOT-other included) or touch a dot-segment (.git, .env, ...). Throws on bad %-encoding.
 function safeResolve(urlPath) {
-  const decoded = decodeURIComponent(urlPath);
-  const cleaned = decoded.split('?')[0].split('#')[0];
-  const rel = cleaned.startsWith('/') ? cleaned.slice(1) : cleaned;
-  const abs = path.resolve(ROOT, rel);
-  if (!abs.startsWith(path.resolve(ROOT))) return null;
+  const decoded = decodeURIComponent(urlPath.split('?')[0].split('#')[0]);
+  if (decoded.indexOf('\0') >= 0) return null;
+  if (decoded.split(/[\\/]/).some(segment => segment.startsWith('.'))) return null;
+  const abs = path.resolve(ROOT, decoded.replace(/^[\\/]+/, ''));
+  const rel = path.relative(ROOT, abs);
+  if (rel.startsWith('..') || path.isAbsolute(rel)) return null;
   return abs;
 }
 
@@ -37,20 +58,135 @@ function send(res, status, headers, body) {
   res.end(body);
 }
 
-const server = http.createServer((req, res) => {
-  const url = req.url || '/';
+// ---------- production mode ----------
 
-  // Default route
-  let requestPath = url;
-  if (url === '/' || url === '') {
-    requestPath = '/modular-music-theory.html';
-  }
+// absPath -> { path, mtimeMs, size, checkedAt, etag, contentType, body, gzip, br }
+const fileCache = new Map();
 
-  const absPath = safeResolve(requestPath);
-  if (!absPath) {
-    return send(res, 400, { 'Content-Type': 'text/plain; charset=utf-8' }, 'Bad request');
-  }
+function statFile(absPath, callback) {
+  fs.stat(absPath, (err, stat) => {
+    if (err || !stat) return callback(err || new Error('not found'));
+    if (!stat.isDirectory()) return callback(null, absPath, stat);
+    const indexPath = path.join(absPath, 'index.html');
+    fs.stat(indexPath, (indexErr, indexStat) => callback(indexErr, indexPath, indexStat));
+  });
+}
+
+function buildEntry(finalPath, stat, callback) {
+  const ext = path.extname(finalPath).toLowerCase();
+  const contentType = MIME[ext] || 'application/octet-stream';
+  const entry = {
+    path: finalPath,
+    mtimeMs: stat.mtimeMs,
+    size: stat.size,
+    checkedAt: Date.now(),
+    contentType,
+    etag: `W/"${stat.size.toString(16)}-${Math.floor(stat.mtimeMs).toString(16)}"`,
+    body: null,
+    gzip: null,
+    br: null
+  };
+  if (stat.size > MAX_CACHED_BYTES) return callback(null, entry);
+
+  fs.readFile(finalPath, (err, data) => {
+    if (err) return callback(err);
+    entry.body = data;
+    entry.etag = `"${crypto.createHash('sha1').update(data).digest('base64').slice(0, 27)}"`;
+    if (isCompressible(contentType) && data.length >= MIN_COMPRESS_BYTES) {
+      // Computed once per file version; only kept when it actually saves bytes
+      const gzip = zlib.gzipSync(data, { level: 9 });
+      const br = zlib.brotliCompressSync(data, {
+        params: {
+          [zlib.constants.BROTLI_PARAM_QUALITY]: 10,
+          [zlib.constants.BROTLI_PARAM_SIZE_HINT]: data.length
+        }
+      });
+      if (gzip.length < data.length) entry.gzip = gzip;
+      if (br.length < data.length) entry.br = br;
+    }
+    callback(null, entry);
+  });
+}
+
+function getEntry(absPath, callback) {
+  const cached = fileCache.get(absPath);
+  if (cached && Date.now() - cached.checkedAt < STAT_RECHECK_MS) return callback(null, cached);
+
+  statFile(absPath, (err, finalPath, stat) => {
+    if (err || !stat) {
+      fileCache.delete(absPath);
+      return callback(err || new Error('not found'));
+    }
+    if (cached && cached.path === finalPath && cached.mtimeMs === stat.mtimeMs && cached.size === stat.size) {
+      cached.checkedAt = Date.now();
+      return callback(null, cached);
+    }
+    buildEntry(finalPath, stat, (buildErr, entry) => {
+      if (buildErr) return callback(buildErr);
+      fileCache.set(absPath, entry);
+      callback(null, entry);
+    });
+  });
+}
+
+function pickEncoding(acceptEncoding, entry) {
+  const accept = String(acceptEncoding || '');
+  if (entry.br && /\bbr\b/.test(accept)) return 'br';
+  if (entry.gzip && /\bgzip\b/.test(accept)) return 'gzip';
+  return null;
+}
+
+// Strong validators must differ per content-coding, so compressed bodies get a suffixed tag
+function etagFor(entry, encoding) {
+  return encoding ? entry.etag.replace(/"$/, `-${encoding}"`) : entry.etag;
+}
 
+function etagMatches(ifNoneMatch, etag) {
+  if (!ifNoneMatch) return false;
+  const strip = (tag) => tag.trim().replace(/^W\//, '');
+  return ifNoneMatch === '*' || ifNoneMatch.split(',').some(tag => strip(tag) === strip(etag));
+}
+
+function serveProduction(req, res, absPath, versioned) {
+  getEntry(absPath, (err, entry) => {
+    if (err) {
+      return send(res, 404, { 'Content-Type': 'text/plain; charset=utf-8' }, 'Not found');
+    }
+
+    const encoding = pickEncoding(req.headers['accept-encoding'], entry);
+    const headers = {
+      'Content-Type': entry.contentType,
+      'ETag': etagFor(entry, encoding),
+      'Last-Modified': new Date(entry.mtimeMs).toUTCString(),
+      // Versioned URLs change whenever their contents do; everything else revalidates
+      'Cache-Control': versioned ? 'public, max-age=31536000, immutable' : 'no-cache'
+    };
+    if (isCompressible(entry.contentType)) headers['Vary'] = 'Accept-Encoding';
+
+    if (etagMatches(req.headers['if-none-match'], headers['ETag'])) {
+      return send(res, 304, headers);
+    }
+
+    if (!entry.body) {
+      // Too large to cache: stream from disk
+      headers['Content-Length'] = entry.size;
+      res.writeHead(200, headers);
+      if (req.method === 'HEAD') return res.end();
+      const stream = fs.createReadStream(entry.path);
+      stream.on('error', () => res.destroy());
+      return stream.pipe(res);
+    }
+
+    const body = encoding ? entry[encoding] : entry.body;
+    if (encoding) headers['Content-Encoding'] = encoding;
+    headers['Content-Length'] = body.length;
+    send(res, 200, headers, req.method === 'HEAD' ? undefined : body);
+  });
+}
+
+// ---------- dev mode ----------
+
+function serveDev(req, res, absPath) {
   fs.stat(absPath, (err, stat) => {
     if (err || !stat) {
       return send(res, 404, { 'Content-Type': 'text/plain; charset=utf-8' }, 'Not found');
@@ -67,9 +203,38 @@ const server = http.createServer((req, res) => {
       send(res, 200, { 'Content-Type': contentType, 'Cache-Control': 'no-cache' }, data);
     });
   });
+}
+
+const server = http.createServer((req, res) => {
+  const url = req.url || '/';
+
+  // Default route
+  let requestPath = url;
+  if (url === '/' || url === '') {
+    requestPath = '/modular-music-theory.html';
+  }
+
+  let absPath;
+  try {
+    absPath = safeResolve(requestPath);
+  } catch (_) {
+    absPath = null; // malformed percent-encoding
+  }
+  if (!absPath) {
+    return send(res, 400, { 'Content-Type': 'text/plain; charset=utf-8' }, 'Bad request');
+  }
+
+  if (PRODUCTION) {
+    if (req.method !== 'GET' && req.method !== 'HEAD') {
+      return send(res, 405, { 'Content-Type': 'text/plain; charset=utf-8', 'Allow': 'GET, HEAD' }, 'Method not allowed');
+    }
+    const versioned = /[?&]v=/.test(url);
+    return serveProduction(req, res, absPath, versioned);
+  }
+  serveDev(req, res, absPath);
 });
 
-server.listen(PORT, '127.0.0.1', () => {
-  console.log(`[dev-server] Serving ${ROOT}`);
-  console.log(`[dev-server] Open: http://localhost:${PORT}/modular-music-theory.html`);
+server.listen(PORT, HOST, () => {
+  console.log(`[dev-server] Serving ${ROOT}${PRODUCTION ? ' (production mode)' : ''}`);
+  console.log(`[dev-server] Open: http://${HOST === '0.0.0.0' ? 'localhost' : HOST}:${PORT}/modular-music-theory.html`);
 });
@@ -5,6 +5,8 @@
  * - Optional reverb convolver effect
  * - Master volume control
  * - Multiple oscillator types for richer tone
+ * - Progressions/arpeggios run on a lookahead AudioTransport (tempo, loop, stop mid-phrase)
+ * - Pooled voices (VoicePool) with a polyphony cap and voice stealing
  */
 class EnhancedAudioEngine {
     constructor(options = {}) {
@@ -14,6 +16,7 @@ class EnhancedAudioEngine {
         this.wetGain = null;
         this.convolver = null;
         this.activeVoices = new Map();
+        this.transport = null;
         
         // Configuration
         this.config = {
@@ -27,8 +30,11 @@ class EnhancedAudioEngine {
             // For progressions (voice leading examples)
             progressionAttackTime: options.progressionAttackTime || 0.05,
             progressionSustainTime: options.progressionSustainTime || 1.2,
-            progressionReleaseTime: options.progressionReleaseTime || 0.4
+            progressionReleaseTime: options.progressionReleaseTime || 0.4,
+            // Voice pool size; notes past it steal the oldest/quietest voice
+            polyphony: options.polyphony || 32
         };
+        this.voicePool = null;
     }
 
     init() {
@@ -114,28 +120,35 @@ class EnhancedAudioEngine {
             velocity = 1.0
         } = typeof options === 'number' ? { duration: options } : options;
         
-        // Create oscillator and gain
+        // Oscillators are one-shot; the gain/send pair comes from a pooled slot
         const osc = this.ctx.createOscillator();
-        const gain = this.ctx.createGain();
-        
         osc.type = type;
         osc.frequency.value = 440 * Math.pow(2, (midi - 69) / 12);
-        
-        // Route through either dry or wet path
-        osc.connect(gain);
-        if (isDry) {
-            gain.connect(this.dryGain);
+
+        const now = this.ctx.currentTime + time;
+        const pool = this.getVoicePool();
+        let slot = null;
+        let gain;
+        let start = now;
+        if (pool) {
+            slot = pool.acquire(midi, velocity, now);
+            gain = slot.nodes.gain;
+            // A stolen slot is fading out; begin after the fade
+            if (slot.stolen) start = Math.max(now, this.ctx.currentTime + VoicePool.STEAL_FADE + 0.001);
+            gain.gain.cancelScheduledValues(start);
+            // Route through either dry or dry + wet (with reverb)
+            slot.nodes.send.gain.setValueAtTime(isDry ? 0 : 1, start);
         } else {
-            // Split signal: dry + wet (with reverb)
+            gain = this.ctx.createGain();
             gain.connect(this.dryGain);
-            gain.connect(this.wetGain);
+            if (!isDry) gain.connect(this.wetGain);
         }
+        osc.connect(gain);
         
         // Envelope: Attack -> Sustain -> Release
-        const now = this.ctx.currentTime + time;
-        const attackEnd = now + attackTime;
+        const attackEnd = start + attackTime;
         
-        gain.gain.setValueAtTime(0, now);
+        gain.gain.setValueAtTime(0, start);
         gain.gain.linearRampToValueAtTime(velocity, attackEnd);
         
         // If duration is effectively infinite (like MIDI), don't schedule the release yet
@@ -144,11 +157,11 @@ class EnhancedAudioEngine {
             const releaseEnd = sustainEnd + releaseTime;
             gain.gain.setValueAtTime(velocity, sustainEnd);
             gain.gain.exponentialRampToValueAtTime(0.001, releaseEnd);
-            osc.start(now);
+            osc.start(start);
             osc.stop(releaseEnd + 0.05);
         } else {
             // MIDI mode: hold volume until stopNote(midi) is called
-            osc.start(now);
+            osc.start(start);
         }
 
         // Track active voice
@@ -156,14 +169,84 @@ class EnhancedAudioEngine {
         if (!this.activeVoices.has(voiceKey)) {
             this.activeVoices.set(voiceKey, []);
         }
-        this.activeVoices.get(voiceKey).push({
+        const voice = {
             osc,
             gain,
-            startTime: now,
-            midi
-        });
+            startTime: start,
+            midi,
+            slot,
+            generation: slot ? slot.generation : 0
+        };
+        if (slot) slot.voice = voice;
+        this.activeVoices.get(voiceKey).push(voice);
+
+        osc.onended = () => {
+            this._forgetVoice(voice);
+            if (slot) pool.release(slot, voice.generation);
+        };
+
+        return voice;
+    }
 
-        return { osc, gain };
+    /**
+     * Lazily build the voice pool (null when voice-pool.js is not loaded)
+     */
+    getVoicePool() {
+        if (!this.voicePool && typeof VoicePool !== 'undefined' && this.ctx) {
+            this.voicePool = new VoicePool({
+                polyphony: this.config.polyphony,
+                now: () => this.ctx.currentTime,
+                createSlotNodes: () => {
+                    const gain = this.ctx.createGain();
+                    const send = this.ctx.createGain();
+                    gain.gain.value = 0;
+                    gain.connect(this.dryGain);
+                    gain.connect(send);
+                    send.connect(this.wetGain);
+                    return { gain, send };
+                },
+                silence: (slot, when) => this._silenceSlot(slot, when)
+            });
+        }
+        return this.voicePool;
+    }
+
+    /**
+     * Fast fade of a slot's gain and stop of its oscillator (voice stealing / panic)
+     */
+    _silenceSlot(slot, when) {
+        const g = slot.nodes.gain.gain;
+        g.cancelScheduledValues(when);
+        g.setValueAtTime(g.value, when);
+        g.linearRampToValueAtTime(0, when + VoicePool.STEAL_FADE);
+        const voice = slot.voice;
+        if (voice) {
+            try { voice.osc.stop(when + VoicePool.STEAL_FADE); } catch (_) {}
+            this._forgetVoice(voice);
+        }
+    }
+
+    _forgetVoice(voice) {
+        const list = this.activeVoices.get(`${voice.midi}`);
+        if (!list) return;
+        const idx = list.indexOf(voice);
+        if (idx > -1) list.splice(idx, 1);
+    }
+
+    /**
+     * Active/stolen voice counts
+     */
+    getVoiceStats() {
+        const pool = this.voicePool;
+        return pool ? pool.getStats() : { active: 0, stolen: 0, allocated: 0, peakActive: 0, polyphony: this.config.polyphony, slots: 0 };
+    }
+
+    /**
+     * Set the polyphony cap (voices beyond it steal the oldest/quietest)
+     */
+    setPolyphony(n) {
+        this.config.polyphony = Math.max(1, parseInt(n, 10) || this.config.polyphony);
+        if (this.voicePool) this.voicePool.setPolyphony(this.config.polyphony);
     }
 
     /**
@@ -177,6 +260,7 @@ class EnhancedAudioEngine {
         const voice = voices.pop();
         const now = this.ctx.currentTime;
         const releaseTime = this.config.releaseTime || 0.3;
+        if (voice.slot && this.voicePool) this.voicePool.markReleasing(voice.slot, voice.generation);
 
         voice.gain.gain.cancelScheduledValues(now);
         voice.gain.gain.setValueAtTime(voice.gain.gain.value, now);
@@ -204,38 +288,51 @@ class EnhancedAudioEngine {
         });
     }
 
+    /**
+     * Shared lookahead transport (created on first use; null if audio-transport.js is not loaded)
+     */
+    getTransport() {
+        this.resume();
+        if (!this.transport && typeof AudioTransport !== 'undefined') {
+            this.transport = new AudioTransport(this.ctx);
+        }
+        return this.transport;
+    }
+
     /**
      * Play a sequence of chords with timing
      * Useful for voice leading and progression examples
      * @param {Array} progression - [{ notes: [60, 64, 67], duration: 1.0 }, ...]
-     * @param {Object} options - { sustainTime, ... }
+     * @param {Object} options - { sustainTime, tempo, loop, onEnd, ... } durations are beats (seconds at 60 BPM)
+     * @returns {AudioTransport|null} transport driving playback (stop/seek/setTempo mid-phrase)
      */
     playProgression(progression, options = {}) {
         this.resume();
         
+        const { tempo, loop, onEnd, ...noteOptions } = options;
         // Use progression timing settings by default
         const optionsObj = {
             attackTime: this.config.progressionAttackTime,
             sustainTime: this.config.progressionSustainTime,
             releaseTime: this.config.progressionReleaseTime,
-            ...options
+            ...noteOptions
         };
         
         let currentTime = 0;
-        progression.forEach((chord, idx) => {
+        const events = progression.map(chord => {
             const notes = Array.isArray(chord.notes) ? chord.notes : [chord.notes];
             const duration = chord.duration || 1.0;
-            
-            notes.forEach(midi => {
-                this.playNote(midi, { ...optionsObj, time: currentTime, duration });
-            });
-            
+            const event = { beat: currentTime, duration, notes };
             currentTime += duration;
+            return event;
         });
+
+        return this._runSequence(events, optionsObj, { tempo, loop, onEnd });
     }
 
     /**
      * Play an arpeggio (notes in sequence, not simultaneously)
+     * @returns {AudioTransport|null}
      */
     playArpeggio(notes, options = {}) {
         this.resume();
@@ -245,33 +342,92 @@ class EnhancedAudioEngine {
             delay = 0.15,
             sustainTime = this.config.sustainTime,
             attackTime = this.config.attackTime,
-            releaseTime = this.config.releaseTime
+            releaseTime = this.config.releaseTime,
+            tempo,
+            loop,
+            onEnd
         } = typeof options === 'number' ? { noteDuration: options } : options;
         
+        const events = [];
         notes.forEach((note, idx) => {
             let midi = note;
             if (typeof note === 'string') {
                 midi = this.noteToMidi(note);
             }
-            if (midi) {
-                const time = idx * delay;
-                this.playNote(midi, {
-                    duration: noteDuration,
-                    sustainTime,
-                    attackTime,
-                    releaseTime,
-                    time
-                });
+            if (midi) events.push({ beat: idx * delay, duration: noteDuration, notes: [midi] });
+        });
+
+        return this._runSequence(events, { sustainTime, attackTime, releaseTime }, {
+            tempo, loop, onEnd, length: notes.length * delay
+        });
+    }
+
+    /**
+     * Drive note events through the transport; without one, schedule everything up front
+     */
+    _runSequence(events, noteOptions, transportOptions = {}) {
+        const transport = this.getTransport();
+        // One options object per sequence, re-pointed per event
+        const opts = { ...noteOptions, time: 0, duration: 0 };
+
+        if (!transport) {
+            events.forEach(ev => {
+                opts.time = ev.beat;
+                opts.duration = ev.duration;
+                ev.notes.forEach(midi => this.playNote(midi, opts));
+            });
+            return null;
+        }
+
+        // No tempo means seconds, whatever the last phrase set
+        transport.tempo = transportOptions.tempo || 60;
+        transport.setSequence(events, {
+            length: transportOptions.length,
+            loop: !!transportOptions.loop,
+            onEnd: transportOptions.onEnd || null,
+            onEvent: (ev, when, duration) => {
+                opts.time = Math.max(0, when - this.ctx.currentTime);
+                opts.duration = duration;
+                return ev.notes.map(midi => this.playNote(midi, opts));
+            },
+            onCancel: (handles) => handles.forEach(voices => this._cancelVoices(voices))
+        });
+        transport.start(0);
+        return transport;
+    }
+
+    /**
+     * Silence voices that were scheduled but have not started yet
+     */
+    _cancelVoices(voices) {
+        const now = this.ctx.currentTime;
+        voices.forEach(voice => {
+            try { voice.osc.stop(now); } catch (_) {}
+            if (voice.slot) {
+                // Pooled gain stays connected; just hand the slot back
+                if (this.voicePool) this.voicePool.release(voice.slot, voice.generation);
+            } else {
+                try { voice.gain.disconnect(); } catch (_) {}
             }
+            this._forgetVoice(voice);
         });
     }
 
+    /**
+     * Stop transport playback at the current position (pending notes are cancelled)
+     */
+    stopPlayback() {
+        if (this.transport) this.transport.stop();
+    }
+
     /**
      * Stop all sounds immediately (panic button)
      */
     stopAll() {
-        if (this.ctx) {
-            this.ctx.createGain().gain.setValueAtTime(0, this.ctx.currentTime);
+        if (this.transport) this.transport.stop();
+        if (this.ctx && this.voicePool) {
+            const now = this.ctx.currentTime;
+            this.voicePool.forEachActive(slot => this._silenceSlot(slot, now));
         }
     }
 
@@ -5,6 +5,9 @@
  * - Highlights all scale tones across the fretboard
  * - Emphasizes root note positions
  * - Syncs with ScaleLibrary and PianoVisualizer selections
+ * - String x fret pitch table per tuning, with a pitch-class -> positions index
+ * - Playable chord voicings (fingering span, string skips), cached per chord/tuning/capo,
+ *   shown on the board and auditioned as a strum
  */
 
 class GuitarFretboardVisualizer {
@@ -13,6 +16,7 @@ class GuitarFretboardVisualizer {
             container: options.container || null,
             frets: options.frets || 22,
             tuningMidi: options.tuningMidi || [40, 45, 50, 55, 59, 64], // E2 A2 D3 G3 B3 E4
+            capo: options.capo || 0,
             showNoteLabels: options.showNoteLabels !== false,
             fitToContainer: options.fitToContainer !== false,
             ...options
@@ -23,7 +27,9 @@ class GuitarFretboardVisualizer {
             currentScale: 'major',
             scaleNotes: [],
             highlightedNote: null, // specific note name to emphasize
-            focusMidi: null // specific midi to focus/scroll
+            focusMidi: null, // specific midi to focus/scroll
+            voicing: null,   // chord voicing shown on the board (see findChordVoicings)
+            voicingRequest: null
         };
 
         this.listeners = new Map();
@@ -35,6 +41,12 @@ class GuitarFretboardVisualizer {
         this._dockHostSize = null;
         this._dockRerenderRaf = 0;
 
+        this._pitchTable = null;         // see _getPitchTable()
+        this._voicingCache = new Map();  // chord/tuning/capo/options -> voicings
+        this._cells = [];                // { cell, string, fret, midi } in DOM order
+        this._cellAt = [];               // [string][fret] -> cell
+        this._appliedCellState = new Map(); // cell -> style signature last written
+
         // Simple note <-> semitone mapping
         this.NOTE_TO_SEMITONE = {
             'C': 0, 'C#': 1, 'Db': 1, 'D': 2, 'D#': 3, 'Eb': 3, 'E': 4,
@@ -324,6 +336,7 @@ class GuitarFretboardVisualizer {
         // Build cells: open markers live to the left of the nut; fretted notes sit between fret wires.
         // Visual order: top row = high E, bottom row = low E
         const tuning = this.options.tuningMidi.slice().reverse(); // [64,59,55,50,45,40]
+        this._resetCellIndex();
         for (let s = 0; s < 6; s++) {
             const openMidi = tuning[s];
             // Open string marker (fret 0)
@@ -378,8 +391,10 @@ class GuitarFretboardVisualizer {
                     this.state.focusMidi = midiNum;
                     this.applyState();
                     
+                    // Picking a note of the shown chord shape strums the whole voicing
                     const audio = this.options.audioEngine;
-                    if (audio && typeof audio.playNote === 'function') {
+                    const strummed = cell.classList.contains('voicing-tone') && this.auditionVoicing();
+                    if (!strummed && audio && typeof audio.playNote === 'function') {
                         audio.playNote(midiNum, { duration: 1.2 });
                     }
                     this.emit('noteClicked', { note: cell.dataset.note, midi: midiNum });
@@ -396,11 +411,13 @@ class GuitarFretboardVisualizer {
                 });
                 cell.addEventListener('mouseleave', () => {
                     cell.style.transform = 'scale(1)';
-                    // Re-apply state styling
+                    // Re-apply state styling (hover changed opacity behind the patch cache's back)
+                    this._appliedCellState.delete(cell);
                     this.applyState();
                 });
 
                 cellLayer.appendChild(cell);
+                this._indexCell(cell, 5 - s, 0);
             }
 
             // Fretted notes (1..N)
@@ -450,7 +467,8 @@ class GuitarFretboardVisualizer {
                     this.applyState();
                     
                     const audio = this.options.audioEngine;
-                    if (audio && typeof audio.playNote === 'function') {
+                    const strummed = cell.classList.contains('voicing-tone') && this.auditionVoicing();
+                    if (!strummed && audio && typeof audio.playNote === 'function') {
                         audio.playNote(midiNum, { duration: 1.2 }); // Reset to shorter duration for UI clicks
                     }
                     this.emit('noteClicked', { note: cell.dataset.note, midi: midiNum });
@@ -464,10 +482,12 @@ class GuitarFretboardVisualizer {
                 });
                 cell.addEventListener('mouseleave', () => {
                     cell.style.transform = 'scale(1)';
+                    this._appliedCellState.delete(cell);
                     this.applyState();
                 });
 
                 cellLayer.appendChild(cell);
+                this._indexCell(cell, 5 - s, f);
             }
         }
 
@@ -571,42 +591,301 @@ class GuitarFretboardVisualizer {
         return pairs[note] || note;
     }
 
+    _resetCellIndex() {
+        this._cells = [];
+        this._cellAt = [];
+        this._appliedCellState = new Map();
+    }
+
+    _indexCell(cell, string, fret) {
+        const midi = parseInt(cell.dataset.midi, 10);
+        this._cells.push({ cell, string, fret, midi });
+        (this._cellAt[string] || (this._cellAt[string] = []))[fret] = cell;
+    }
+
+    /**
+     * Pitch class of a note name; handles spellings outside NOTE_TO_SEMITONE (E#, Cb, Bbb...)
+     */
+    _pitchClassOf(note) {
+        if (typeof note !== 'string') return null;
+        const direct = this.NOTE_TO_SEMITONE[note];
+        if (typeof direct === 'number') return direct;
+        const m = note.match(/^([A-Ga-g])([#b]*)$/);
+        if (!m) return null;
+        let pc = this.NOTE_TO_SEMITONE[m[1].toUpperCase()];
+        for (const ch of m[2]) pc += ch === '#' ? 1 : -1;
+        return ((pc % 12) + 12) % 12;
+    }
+
+    /**
+     * String x fret MIDI / pitch-class table for the current tuning, rebuilt only when the
+     * tuning or fret count changes. Strings are indexed 0 = lowest (matching dataset.stringIndex);
+     * byPc lists positions in board order (top row first, frets ascending).
+     */
+    _getPitchTable() {
+        const tuning = this.options.tuningMidi;
+        const frets = this.options.frets;
+        const sig = `${tuning.join(',')}|${frets}`;
+        if (this._pitchTable && this._pitchTable.sig === sig) return this._pitchTable;
+
+        const width = frets + 1;
+        const midi = new Int16Array(tuning.length * width);
+        const pc = new Uint8Array(tuning.length * width);
+        const byPc = Array.from({ length: 12 }, () => []);
+        for (let string = tuning.length - 1; string >= 0; string--) {
+            for (let fret = 0; fret <= frets; fret++) {
+                const m = tuning[string] + fret;
+                const i = string * width + fret;
+                midi[i] = m;
+                pc[i] = m % 12;
+                byPc[m % 12].push({ string, fret, midi: m });
+            }
+        }
+        this._pitchTable = { sig, strings: tuning.length, frets, width, midi, pc, byPc };
+        return this._pitchTable;
+    }
+
     findNearestFretMidiForSemitone(semitoneClass) {
         // Choose the fret position closest to the mid-neck (around fret 5–7) on any string
         const preferredFret = 6;
         let best = { midi: null, dist: Infinity };
-        const cells = this.gridEl ? Array.from(this.gridEl.querySelectorAll('.fret-cell')) : [];
-        for (const cell of cells) {
-            const midi = parseInt(cell.dataset.midi, 10);
-            const f = parseInt(cell.dataset.fret, 10);
-            if (midi % 12 === semitoneClass) {
-                const d = Math.abs(f - preferredFret);
-                if (d < best.dist) best = { midi, dist: d };
-            }
+        const positions = this._getPitchTable().byPc[((semitoneClass % 12) + 12) % 12] || [];
+        for (const pos of positions) {
+            const d = Math.abs(pos.fret - preferredFret);
+            if (d < best.dist) best = { midi: pos.midi, dist: d };
         }
         return best.midi;
     }
 
+    /**
+     * Playable voicings for a chord: symbol ('Cmaj7', needs options.musicTheory), note list,
+     * or { root, chordNotes }. Depth-first over strings inside each fret window, pruned on
+     * coverage, string count and string skips; results are cached per chord/tuning/capo.
+     * @param {Object} [options] - { maxSpan = 3, maxFret = 15, maxSkips = 1, minStrings = 4,
+     *   requireRootBass = true, allowOmitFifth = true, limit = 8, capo }
+     * @returns {Array} [{ frets (low string first, -1 = muted), positions, midi, notes, baseFret,
+     *   span, fingers, skips, capo, score }], most playable first
+     */
+    findChordVoicings(chord, options = {}) {
+        const spec = this._resolveChordSpec(chord);
+        if (!spec) return [];
+        const table = this._getPitchTable();
+        const opts = {
+            maxSpan: 3, maxFret: 15, maxSkips: 1, minStrings: 4,
+            requireRootBass: true, allowOmitFifth: true, limit: 8,
+            ...options
+        };
+        const capo = Math.max(0, options.capo != null ? options.capo : (this.options.capo || 0));
+        const maxFret = Math.min(opts.maxFret + capo, table.frets);
+        const minStrings = Math.min(opts.minStrings, table.strings);
+        const cacheKey = [
+            spec.rootPc, spec.pcs.join(','), table.sig, capo, opts.maxSpan, maxFret, opts.maxSkips,
+            minStrings, opts.requireRootBass ? 1 : 0, opts.allowOmitFifth ? 1 : 0, opts.limit
+        ].join('|');
+        const cached = this._voicingCache.get(cacheKey);
+        if (cached) return cached;
+
+        const chordMask = spec.pcs.reduce((mask, pc) => mask | (1 << pc), 0);
+        const fifthPc = (spec.rootPc + 7) % 12;
+        const optionalMask = opts.allowOmitFifth && spec.pcs.length >= 4 && (chordMask & (1 << fifthPc)) ? (1 << fifthPc) : 0;
+        const requiredMask = chordMask & ~optionalMask;
+        const popcount = (x) => { let n = 0; while (x) { x &= x - 1; n++; } return n; };
+        const pcAt = (string, fret) => table.pc[string * table.width + fret];
+
+        const found = new Map(); // frets key -> voicing
+        const frets = new Array(table.strings).fill(-1);
+        const consider = () => {
+            let sounding = 0, skips = 0, fretted = 0, open = 0, mask = 0, first = -1, last = -1;
+            let minF = Infinity, maxF = -Infinity;
+            for (let s = 0; s < frets.length; s++) {
+                const f = frets[s];
+                if (f < 0) continue;
+                if (first < 0) first = s;
+                // Muted strings between two sounding strings are skips; low/high ends are just damped
+                else skips += s - last - 1;
+                last = s;
+                sounding++;
+                mask |= 1 << pcAt(s, f);
+                if (f === capo) open++;
+                else { fretted++; minF = Math.min(minF, f); maxF = Math.max(maxF, f); }
+            }
+            if (sounding < minStrings || skips > opts.maxSkips || (mask & requiredMask) !== requiredMask) return;
+            // A shared lowest fret can be barred with one finger
+            let fingers = fretted;
+            if (fretted) {
+                let atMin = 0;
+                frets.forEach(f => { if (f === minF) atMin++; });
+                if (atMin > 1) fingers = fretted - atMin + 1;
+            }
+            if (fingers > 4) return;
+            const key = frets.join(',');
+            if (found.has(key)) return;
+            const span = fretted ? maxF - minF : 0;
+            const baseFret = fretted ? minF : capo;
+            const score = span + skips * 2 + first * 0.5 + (baseFret - capo) * 0.3 + fingers * 0.4
+                - open * 0.3 - sounding * 0.5 + ((mask & optionalMask) !== optionalMask ? 0.5 : 0);
+            const positions = [];
+            frets.forEach((f, s) => { if (f >= 0) positions.push({ string: s, fret: f, midi: table.midi[s * table.width + f] }); });
+            found.set(key, {
+                frets: frets.slice(),
+                positions,
+                midi: positions.map(p => p.midi),
+                notes: positions.map(p => this.SEMITONE_TO_NOTE[p.midi % 12]),
+                baseFret, span, fingers, skips, capo,
+                score: Math.round(score * 100) / 100
+            });
+        };
+
+        // state.gap: strings muted since the last sounding one (they become skips if another sounds)
+        const search = (string, windowStart, state) => {
+            const remaining = table.strings - string;
+            if (state.sounding + remaining < minStrings) return;
+            if (popcount(requiredMask & ~state.mask) > remaining) return;
+            if (string === table.strings) {
+                consider();
+                return;
+            }
+            frets[string] = -1;
+            search(string + 1, windowStart, { ...state, gap: state.sounding ? state.gap + 1 : 0 });
+
+            const play = (fret) => {
+                const pc = pcAt(string, fret);
+                if (!(chordMask & (1 << pc))) return;
+                if (state.sounding === 0 && opts.requireRootBass && pc !== spec.rootPc) return;
+                const skips = state.skips + state.gap;
+                if (skips > opts.maxSkips) return;
+                frets[string] = fret;
+                search(string + 1, windowStart, { sounding: state.sounding + 1, skips, gap: 0, mask: state.mask | (1 << pc) });
+            };
+            play(capo);
+            const hi = Math.min(windowStart + opts.maxSpan, maxFret);
+            for (let f = Math.max(windowStart, capo + 1); f <= hi; f++) play(f);
+            frets[string] = -1;
+        };
+        for (let w = capo + 1; w <= Math.max(capo + 1, maxFret - opts.maxSpan); w++) {
+            search(0, w, { sounding: 0, skips: 0, gap: 0, mask: 0 });
+        }
+
+        const voicings = Array.from(found.values())
+            .sort((a, b) => a.score - b.score || a.baseFret - b.baseFret)
+            .slice(0, opts.limit);
+        if (this._voicingCache.size >= GuitarFretboardVisualizer.VOICING_CACHE_LIMIT) {
+            this._voicingCache.delete(this._voicingCache.keys().next().value);
+        }
+        this._voicingCache.set(cacheKey, voicings);
+        return voicings;
+    }
+
+    _resolveChordSpec(chord) {
+        let root = null;
+        let notes = null;
+        let label = null;
+        if (Array.isArray(chord)) {
+            notes = chord;
+            root = chord[0];
+        } else if (typeof chord === 'string') {
+            const match = chord.match(/^([A-G][#b]?)(.*)$/);
+            const theory = this.options.musicTheory;
+            if (!match) return null;
+            if (!theory || typeof theory.getChordNotes !== 'function') {
+                console.warn('GuitarFretboardVisualizer: chord symbols need options.musicTheory; pass chord notes instead');
+                return null;
+            }
+            root = match[1];
+            notes = theory.getChordNotes(root, match[2] || 'maj') || [];
+            label = chord;
+        } else if (chord && typeof chord === 'object') {
+            notes = chord.chordNotes || chord.notes || [];
+            root = chord.root || notes[0];
+            label = chord.fullName || chord.name || null;
+        }
+        const rootPc = this._pitchClassOf(root);
+        if (rootPc == null || !Array.isArray(notes)) return null;
+        const pcs = Array.from(new Set([rootPc, ...notes.map(n => this._pitchClassOf(n)).filter(pc => pc != null)]))
+            .sort((a, b) => a - b);
+        return { root, rootPc, pcs, label: label || notes.join(' ') };
+    }
+
+    /**
+     * Show voicing `index` of a chord on the board (see findChordVoicings for accepted chords)
+     */
+    showChordVoicing(chord, index = 0, options = {}) {
+        const voicings = this.findChordVoicings(chord, options);
+        const voicing = voicings[Math.min(Math.max(0, index), voicings.length - 1)] || null;
+        const spec = voicing ? this._resolveChordSpec(chord) : null;
+        this.state.voicingRequest = { chord, index, options };
+        this.state.voicing = voicing ? { ...voicing, chord: spec.label, rootPc: spec.rootPc } : null;
+        this.applyState();
+        this.emit('voicingShown', { chord, voicing: this.state.voicing, voicings });
+        return this.state.voicing;
+    }
+
+    clearChordVoicing() {
+        this.state.voicing = null;
+        this.state.voicingRequest = null;
+        this.applyState();
+    }
+
+    setCapo(capo) {
+        this.options.capo = Math.max(0, capo | 0);
+        const request = this.state.voicingRequest;
+        if (request) this.showChordVoicing(request.chord, request.index, request.options);
+    }
+
+    /**
+     * Strum a voicing (default: the one on the board) low string to high through the audio engine
+     */
+    auditionVoicing(voicing = this.state.voicing, options = {}) {
+        const audio = this.options.audioEngine;
+        if (!voicing || !audio || typeof audio.playNote !== 'function') return false;
+        const strumMs = options.strumMs != null ? options.strumMs : 35;
+        const duration = options.duration || 1.6;
+        voicing.midi.forEach((midi, i) => {
+            if (!strumMs) audio.playNote(midi, { duration });
+            else setTimeout(() => audio.playNote(midi, { duration }), i * strumMs);
+        });
+        this.emit('voicingAuditioned', { voicing });
+        return true;
+    }
+
     applyState() {
         if (!this.gridEl) return;
-        const root = this.state.currentKey;
-        const scaleNotes = this.state.scaleNotes || [];
-        const rootEquiv = this.getEnharmonicEquivalent(root);
+        const rootPc = this._pitchClassOf(this.state.currentKey);
+        let scaleMask = 0;
+        (this.state.scaleNotes || []).forEach(n => {
+            const pc = this._pitchClassOf(n);
+            if (pc != null) scaleMask |= 1 << pc;
+        });
 
         const focusMidi = this.state.focusMidi;
-        const highlightedNote = this.state.highlightedNote;
+        const highlightedPc = this.state.highlightedNote ? this._pitchClassOf(this.state.highlightedNote) : null;
+
+        // Voicing roles by cell; a muted string marks its open-string cell
+        const voicingRoles = new Map();
+        const voicing = this.state.voicing;
+        if (voicing) {
+            voicing.frets.forEach((fret, string) => {
+                const row = this._cellAt[string] || [];
+                const cell = row[fret < 0 ? 0 : fret];
+                if (!cell) return;
+                if (fret < 0) voicingRoles.set(cell, 'muted');
+                else voicingRoles.set(cell, ((this.options.tuningMidi[string] + fret) % 12) === voicing.rootPc ? 'root' : 'tone');
+            });
+        }
 
-        const cells = Array.from(this.gridEl.querySelectorAll('.fret-cell'));
-        for (const cell of cells) {
-            const note = cell.dataset.note;
-            const midi = parseInt(cell.dataset.midi, 10);
-            const f = parseInt(cell.dataset.fret, 10);
+        for (const { cell, midi } of this._cells) {
+            const pc = midi % 12;
+            const isScaleTone = (scaleMask & (1 << pc)) !== 0;
+            const isRoot = pc === rootPc;
+            const isFocused = (typeof focusMidi === 'number' && midi === focusMidi) || (highlightedPc != null && pc === highlightedPc);
+            const voicingRole = voicingRoles.get(cell) || '';
+
+            // Only touch cells whose state changed since the last write
+            const sig = `${isScaleTone ? 1 : 0}${isRoot ? 1 : 0}${isFocused ? 1 : 0}${voicingRole}`;
+            if (this._appliedCellState.get(cell) === sig) continue;
+            this._appliedCellState.set(cell, sig);
             const label = cell.querySelector('.fret-label');
 
-            const isScaleTone = scaleNotes.some(n => n === note || this.getEnharmonicEquivalent(n) === note);
-            const isRoot = (note === root || note === rootEquiv);
-            const isFocused = (typeof focusMidi === 'number' && midi === focusMidi) || (highlightedNote && (note === highlightedNote || this.getEnharmonicEquivalent(note) === highlightedNote));
-
             // Base styling: show scale tones as glowing dots
             if (isScaleTone) {
                 cell.style.opacity = '1';
@@ -646,10 +925,29 @@ class GuitarFretboardVisualizer {
                     label.style.fontWeight = '900';
                 }
             }
+
+            // Chord voicing: fretted notes in violet (root ringed in gold), muted strings dimmed
+            cell.classList.toggle('voicing-tone', voicingRole === 'tone' || voicingRole === 'root');
+            cell.classList.toggle('voicing-muted', voicingRole === 'muted');
+            if (voicingRole === 'tone' || voicingRole === 'root') {
+                cell.style.opacity = '1';
+                cell.style.background = 'radial-gradient(circle, rgba(167,139,250,1) 0%, rgba(124,58,237,0.85) 100%)';
+                cell.style.boxShadow = voicingRole === 'root'
+                    ? '0 0 0 2px rgba(245,158,11,0.9), 0 0 16px rgba(167,139,250,0.9)'
+                    : '0 0 14px rgba(167,139,250,0.8)';
+                if (label) {
+                    label.style.color = '#fff';
+                    label.style.textShadow = '0 1px 3px rgba(0,0,0,0.9)';
+                }
+            } else if (voicingRole === 'muted') {
+                cell.style.opacity = '0.15';
+            }
         }
     }
 }
 
+GuitarFretboardVisualizer.VOICING_CACHE_LIMIT = 256;
+
 // Export/Global
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = GuitarFretboardVisualizer;
@@ -0,0 +1,182 @@
+/**
+ * @module LexiconIndex
+ * @description One word index over the NRC emotion lexicon and the offline thesaurus archetypes
+ * @exports class LexiconIndex
+ * @feature Inflected forms resolved to their stem at build time (same suffix rules as WordDatabase)
+ * @feature VAD and dominant emotion decoded once per distinct bitmask into typed arrays
+ * @feature lookupMany(tokens) resolves a whole sentence in one pass
+ *
+ * Built by WordDatabase, which supplies the bitmask decoder; entries are frozen and shared.
+ */
+
+class LexiconIndex {
+    /**
+     * @param {Object} sources - { nrc, suffixes, decodeMask, emotionScales, thesaurus, archetypes, thesaurusLookup }
+     *   nrc: { word: mask }, decodeMask(mask) -> { valence, arousal, dominance, category },
+     *   thesaurus: iterable of [word, archetype], thesaurusLookup(word) -> archetype (rule-based fallback)
+     */
+    constructor(sources = {}) {
+        this.ids = new Map();          // word -> id
+        this.words = [];
+        this.emotionScales = sources.emotionScales || {};
+        this.archetypes = sources.archetypes || {};
+        this.archetypeNames = [];
+        this.thesaurusLookup = sources.thesaurusLookup || null;
+        this.misses = new Map();       // token -> entry|null for words only the rule-based thesaurus can resolve
+        this.missLimit = 4096;
+
+        const nrc = sources.nrc || {};
+        const suffixes = sources.suffixes || [];
+        const decodeMask = sources.decodeMask;
+
+        // Headwords, then suffixed forms in suffix order so the first matching rule wins
+        const stemOf = new Map();
+        Object.keys(nrc).forEach(word => stemOf.set(word, word));
+        for (const suffix of suffixes) {
+            Object.keys(nrc).forEach(stem => {
+                const form = stem + suffix;
+                if (form.length > suffix.length + 3 && !stemOf.has(form)) stemOf.set(form, stem);
+            });
+        }
+
+        const thesaurus = new Map();
+        if (sources.thesaurus) {
+            for (const [word, archetype] of sources.thesaurus) thesaurus.set(word, archetype);
+        }
+        stemOf.forEach((_, word) => this._intern(word));
+        thesaurus.forEach((_, word) => this._intern(word));
+
+        const count = this.words.length;
+        this.maskById = new Int16Array(count).fill(-1);
+        this.archetypeById = new Int16Array(count).fill(-1);
+        this.stemById = new Int32Array(count);
+        // archetypeById: -1 = not asked yet (resolved through thesaurusLookup on first use), -2 = none
+
+        stemOf.forEach((stem, word) => {
+            const id = this.ids.get(word);
+            this.maskById[id] = nrc[stem];
+            this.stemById[id] = this.ids.get(stem);
+        });
+        thesaurus.forEach((archetype, word) => {
+            const id = this.ids.get(word);
+            this.archetypeById[id] = this._archetypeIndex(archetype);
+            if (this.maskById[id] < 0) this.stemById[id] = id;
+        });
+
+        // Decode each distinct mask once (10-bit masks)
+        this.vadByMask = new Float64Array(1024 * 3);
+        this.categoryByMask = new Array(1024).fill(null);
+        if (typeof decodeMask === 'function') {
+            const seen = new Set(this.maskById);
+            seen.forEach(mask => {
+                if (mask < 0) return;
+                const decoded = decodeMask(mask);
+                this.vadByMask[mask * 3] = decoded.valence;
+                this.vadByMask[mask * 3 + 1] = decoded.arousal;
+                this.vadByMask[mask * 3 + 2] = decoded.dominance;
+                this.categoryByMask[mask] = decoded.category;
+            });
+        }
+
+        this.entries = new Array(count).fill(undefined); // lazily built, frozen
+    }
+
+    _intern(word) {
+        if (this.ids.has(word)) return this.ids.get(word);
+        const id = this.words.length;
+        this.words.push(word);
+        this.ids.set(word, id);
+        return id;
+    }
+
+    _archetypeIndex(name) {
+        let idx = this.archetypeNames.indexOf(name);
+        if (idx < 0) {
+            idx = this.archetypeNames.length;
+            this.archetypeNames.push(name);
+        }
+        return idx;
+    }
+
+    get size() {
+        return this.words.length;
+    }
+
+    /**
+     * Resolve one token (lowercase). Entry:
+     * { word, stem, mask, valence, arousal, dominance, category, scale, archetype, archetypeInfo }
+     * mask is null when the word has no NRC emotion; archetype is null when the thesaurus has none.
+     */
+    lookup(token) {
+        if (!token) return null;
+        const id = this.ids.get(token);
+        if (id !== undefined) return this._entry(id);
+        return this._lookupMiss(token);
+    }
+
+    /**
+     * Resolve every token of a sentence in one pass; result is aligned with `tokens`
+     */
+    lookupMany(tokens) {
+        const out = new Array(tokens.length);
+        for (let i = 0; i < tokens.length; i++) {
+            const token = tokens[i];
+            const id = this.ids.get(token);
+            out[i] = id !== undefined ? this._entry(id) : this._lookupMiss(token);
+        }
+        return out;
+    }
+
+    _entry(id) {
+        const cached = this.entries[id];
+        if (cached !== undefined) return cached;
+
+        const mask = this.maskById[id];
+        let archetypeIdx = this.archetypeById[id];
+        if (archetypeIdx === -1) {
+            // NRC-only words (inflected forms included) still get the thesaurus' rule-based archetype
+            const resolved = this.thesaurusLookup ? this.thesaurusLookup(this.words[id]) : null;
+            archetypeIdx = resolved ? this._archetypeIndex(resolved) : -2;
+            this.archetypeById[id] = archetypeIdx;
+        }
+        const archetype = archetypeIdx >= 0 ? this.archetypeNames[archetypeIdx] : null;
+        const entry = this._makeEntry(this.words[id], this.words[this.stemById[id]], mask, archetype);
+        this.entries[id] = entry;
+        return entry;
+    }
+
+    _makeEntry(word, stem, mask, archetype) {
+        const hasMask = mask >= 0;
+        const category = hasMask ? this.categoryByMask[mask] : null;
+        return Object.freeze({
+            word,
+            stem,
+            mask: hasMask ? mask : null,
+            valence: hasMask ? this.vadByMask[mask * 3] : 0,
+            arousal: hasMask ? this.vadByMask[mask * 3 + 1] : 0,
+            dominance: hasMask ? this.vadByMask[mask * 3 + 2] : 0,
+            category,
+            scale: (category && this.emotionScales[category]) || null,
+            archetype,
+            archetypeInfo: archetype ? (this.archetypes[archetype] || null) : null
+        });
+    }
+
+    /**
+     * Tokens not in the index can still match the thesaurus' own stemming rules
+     */
+    _lookupMiss(token) {
+        if (!this.thesaurusLookup) return null;
+        if (this.misses.has(token)) return this.misses.get(token);
+        const archetype = this.thesaurusLookup(token);
+        const entry = archetype ? this._makeEntry(token, token, -1, archetype) : null;
+        if (this.misses.size >= this.missLimit) this.misses.clear();
+        this.misses.set(token, entry);
+        return entry;
+    }
+}
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = LexiconIndex;
+}
@@ -1,6 +1,10 @@
 /**
  * MIDIInputManager - Web MIDI API integration
  * Requests MIDI permissions and routes note events to audio engine
+ *
+ * Audio is triggered on the message path; 'noteOn'/'noteOff' still fire per
+ * message, while visual listeners should use 'activeNotes', a coalesced
+ * snapshot emitted at most once per animation frame.
  */
 class MIDIInputManager {
     constructor(audioEngine) {
@@ -11,6 +15,14 @@ class MIDIInputManager {
         this.enabled = false;
         this.statusCallback = null;
         this.listeners = new Map();
+
+        // Per-frame fan-out of note changes to visual listeners
+        this._framePending = false;
+        this._framePressed = [];
+        this._frameReleased = [];
+
+        // Input-to-sound latency (message timestamp -> audio scheduled + output latency)
+        this.latency = { count: 0, lastMs: 0, avgMs: 0, maxMs: 0, outputMs: 0 };
     }
 
     /**
@@ -73,7 +85,7 @@ class MIDIInputManager {
     attachInput(input) {
         const self = this;
         input.addEventListener('midimessage', (e) => {
-            self.handleMidiMessage(e.data, input.id);
+            self.handleMidiMessage(e.data, input.id, e.timeStamp);
         });
         this.inputs.set(input.id, input);
     }
@@ -97,8 +109,9 @@ class MIDIInputManager {
     /**
      * Handle incoming MIDI messages
      * Standard MIDI format: [command, note, velocity]
+     * @param {number} timeStamp - MIDIMessageEvent.timeStamp (performance.now() clock), for latency stats
      */
-    handleMidiMessage(data, inputId) {
+    handleMidiMessage(data, inputId, timeStamp) {
         if (data.length < 2) return;
 
         const command = data[0] >> 4;
@@ -108,7 +121,7 @@ class MIDIInputManager {
 
         // Note on (command 9)
         if (command === 9 && velocity > 0) {
-            this.noteOn(note, velocity, inputId);
+            this.noteOn(note, velocity, inputId, timeStamp);
         }
         // Note off (command 8) or Note on with velocity 0
         else if (command === 8 || (command === 9 && velocity === 0)) {
@@ -123,7 +136,7 @@ class MIDIInputManager {
     /**
      * Process MIDI note on
      */
-    noteOn(midi, velocity, inputId) {
+    noteOn(midi, velocity, inputId, timeStamp) {
         if (!this.audioEngine) return;
 
         // Normalize velocity to 0-1 range
@@ -132,6 +145,7 @@ class MIDIInputManager {
         // Play the note with long duration (will be stopped on note-off)
         if (typeof this.audioEngine.playNote === 'function') {
             this.audioEngine.playNote(midi, 10.0, 0, normalizedVelocity);
+            this._recordLatency(timeStamp);
         }
 
         // Track active note
@@ -145,6 +159,7 @@ class MIDIInputManager {
 
         // Emit event
         this.emit('noteOn', { midi, velocity: normalizedVelocity, inputId });
+        this._queueFrame(midi, true);
     }
 
     /**
@@ -159,6 +174,53 @@ class MIDIInputManager {
         const key = `${inputId}:${midi}`;
         this.activeNotes.delete(key);
         this.emit('noteOff', { midi, inputId });
+        this._queueFrame(midi, false);
+    }
+
+    /**
+     * Coalesce note changes into one 'activeNotes' emit per animation frame
+     */
+    _queueFrame(midi, pressed) {
+        (pressed ? this._framePressed : this._frameReleased).push(midi);
+        if (this._framePending) return;
+        this._framePending = true;
+        const schedule = typeof requestAnimationFrame === 'function'
+            ? requestAnimationFrame
+            : (fn) => setTimeout(fn, 16);
+        schedule(() => this._flushFrame());
+    }
+
+    _flushFrame() {
+        this._framePending = false;
+        const pressed = this._framePressed;
+        const released = this._frameReleased;
+        this._framePressed = [];
+        this._frameReleased = [];
+
+        const notes = Array.from(new Set(Array.from(this.activeNotes.values(), n => n.midi))).sort((a, b) => a - b);
+        this.emit('activeNotes', { notes, pressed, released });
+    }
+
+    _recordLatency(timeStamp) {
+        if (typeof timeStamp !== 'number' || !(timeStamp > 0) || typeof performance === 'undefined') return;
+        const ctx = this.audioEngine && this.audioEngine.ctx;
+        const outputMs = ctx ? ((ctx.baseLatency || 0) + (ctx.outputLatency || 0)) * 1000 : 0;
+        const ms = Math.max(0, performance.now() - timeStamp) + outputMs;
+
+        const stats = this.latency;
+        stats.count++;
+        stats.lastMs = ms;
+        stats.outputMs = outputMs;
+        stats.maxMs = Math.max(stats.maxMs, ms);
+        // Running mean
+        stats.avgMs += (ms - stats.avgMs) / stats.count;
+    }
+
+    /**
+     * Measured input-to-sound latency in milliseconds
+     */
+    getLatencyStats() {
+        return { ...this.latency };
     }
 
     /**
@@ -14,39 +14,21 @@ window.showLearnNotesModule = function(instrument) {
     document.getElementById('learn-piano-page').style.display = 'none';
     document.getElementById('learn-guitar-page').style.display = 'none';
     // Show the selected instrument's learn page
-    if (instrument === 'guitar') {
-        document.getElementById('learn-guitar-page').style.display = 'block';
-        // Dynamically load the module only if the class isn't already available
-        if (!window.LearnGuitarNotes) {
-            const existingScript = document.querySelector('script[src="learn-guitar-notes.js"]');
-            if (!existingScript && !window.learnGuitarNotesLoaded) {
-                const script = document.createElement('script');
-                script.src = 'learn-guitar-notes.js';
-                script.onload = () => { window.learnGuitarNotesLoaded = true; window.mountLearnModuleIfReady('guitar'); };
-                document.body.appendChild(script);
-            } else {
-                // If the script tag exists or was previously loaded, attempt to mount
-                window.mountLearnModuleIfReady('guitar');
-            }
-        } else {
-            window.mountLearnModuleIfReady('guitar');
-        }
-    } else {
-        document.getElementById('learn-piano-page').style.display = 'block';
-        // Dynamically load the module only if the class isn't already available
-        if (!window.LearnPianoNotes) {
-            const existingScript = document.querySelector('script[src="learn-piano-notes.js"]');
-            if (!existingScript && !window.learnPianoNotesLoaded) {
-                const script = document.createElement('script');
-                script.src = 'learn-piano-notes.js';
-                script.onload = () => { window.learnPianoNotesLoaded = true; window.mountLearnModuleIfReady('piano'); };
-                document.body.appendChild(script);
-            } else {
-                window.mountLearnModuleIfReady('piano');
-            }
-        } else {
-            window.mountLearnModuleIfReady('piano');
-        }
+    const id = instrument === 'guitar' ? 'guitar' : 'piano';
+    document.getElementById(`learn-${id}-page`).style.display = 'block';
+    const className = id === 'guitar' ? 'LearnGuitarNotes' : 'LearnPianoNotes';
+    // Load the module only if the class isn't already available
+    if (window[className]) {
+        window.mountLearnModuleIfReady(id);
+    } else if (window.moduleLoader) {
+        window.moduleLoader.load(`learn-${id}-notes`)
+            .then(() => window.mountLearnModuleIfReady(id))
+            .catch(err => console.error('[LearnNotes] Failed to load module:', err));
+    } else if (!document.querySelector(`script[src="learn-${id}-notes.js"]`)) {
+        const script = document.createElement('script');
+        script.src = `learn-${id}-notes.js`;
+        script.onload = () => window.mountLearnModuleIfReady(id);
+        document.body.appendChild(script);
     }
 };
 
@@ -130,15 +112,36 @@ window.mountLearnModuleIfReady = function(instrument) {
                     showGradingTooltips: false
                 });
                 
+                // Load piano samples nearest the visible keys first
+                if (this.audioEngine && typeof this.audioEngine.setPreferredRange === 'function') {
+                    this.pianoVisualizer.on('rendered', ({ startMidi, endMidi }) => {
+                        this.audioEngine.setPreferredRange(startMidi, endMidi);
+                    });
+                }
+                
                 // Inject Guitar Engine into Guitar Fretboard
                 this.guitarFretboard = new GuitarFretboardVisualizer({ 
                     container: '#guitar-container',
                     audioEngine: this.guitarEngine,
+                    musicTheory: this.musicTheory,
                     frets: 22, 
                     showNoteLabels: true 
                 });
                 
+                // Shared key/scale/numbers state; module fan-out is batched to one update per frame
+                this.stateStore = typeof AppStateStore !== 'undefined' ? new AppStateStore() : null;
+                window.appStateStore = this.stateStore;
+
+                // Heavy analysis (container search, context parsing) runs in a worker when one can start
+                this.analysisService = typeof AnalysisService !== 'undefined'
+                    ? new AnalysisService({ musicTheory: this.musicTheory })
+                    : null;
+                window.analysisService = this.analysisService;
+
                 this.containerChordTool = new ContainerChordTool(this.musicTheory);
+                if (this.analysisService) {
+                    this.containerChordTool.connectAnalysisService(this.analysisService);
+                }
                 this.scaleRelationshipExplorer = new ScaleRelationshipExplorer(this.musicTheory);
                 this.progressionBuilder = new ProgressionBuilder(this.musicTheory);
                 this.scaleCircleExplorer = new ScaleCircleExplorer(this.musicTheory);
@@ -151,6 +154,10 @@ window.mountLearnModuleIfReady = function(instrument) {
                     if (typeof this.chordExplorer.connectNumberGenerator === 'function') {
                         this.chordExplorer.connectNumberGenerator(this.numberGenerator);
                     }
+                    // Exhaustive substitution search runs on the analysis worker
+                    if (this.analysisService && typeof this.chordExplorer.connectAnalysisService === 'function') {
+                        this.chordExplorer.connectAnalysisService(this.analysisService);
+                    }
                     // Wire scale library so explorer updates when key/scale change
                     if (typeof this.chordExplorer.connectScaleLibrary === 'function') {
                         this.chordExplorer.connectScaleLibrary(this.scaleLibrary);
@@ -183,11 +190,49 @@ window.mountLearnModuleIfReady = function(instrument) {
                     console.info && console.info('GradingLegendHelpSystem not loaded; skipping.');
                 }
 
-
+                // Opt-in timing overlay (Ctrl+Shift+P or ?perf); registers wrappers now, installs them on enable
+                this.setupInstrumentation();
 
                 this.initialize();
             }
 
+            setupInstrumentation() {
+                if (typeof PerfInstrumentation === 'undefined') return;
+                const perf = PerfInstrumentation.fromEnvironment();
+                const modules = {
+                    NumberGenerator: this.numberGenerator,
+                    ScaleLibrary: this.scaleLibrary,
+                    PianoVisualizer: this.pianoVisualizer,
+                    GuitarFretboard: this.guitarFretboard,
+                    ContainerChordTool: this.containerChordTool,
+                    ProgressionBuilder: this.progressionBuilder,
+                    ScaleCircleExplorer: this.scaleCircleExplorer,
+                    ChordExplorer: this.chordExplorer
+                };
+                Object.entries(modules).forEach(([name, module]) => perf.instrumentModule(name, module));
+                perf.instrumentModule('ScaleRelationshipExplorer', this.scaleRelationshipExplorer, { emit: false });
+                perf.instrumentModule('SheetMusic', this.sheetMusicGenerator, { emit: false });
+                perf.instrumentModule('SolarSystem', this.solarSystem, { render: ['draw'], emit: false });
+                perf.instrumentModule('MusicTheoryEngine', this.musicTheory, { render: [], emit: 'broadcastGradingEvent' });
+                perf.instrumentFunctions('MusicTheoryEngine', this.musicTheory, [
+                    'findAllContainerChords', 'getDiatonicChord', 'calculateElementGrade'
+                ]);
+                perf.instrumentFunctions('ScaleRelationshipExplorer', this.scaleRelationshipExplorer, ['findContainingScales']);
+                perf.registerCacheSource('MusicTheoryEngine memo', () => this.musicTheory.getMemoStats());
+                if (window.derivedIndexSnapshot) {
+                    perf.registerCacheSource('Derived index snapshot', () => window.derivedIndexSnapshot.getStats());
+                }
+                if (this.stateStore) {
+                    // Commits folded into an already-pending flush count as hits
+                    perf.registerCacheSource('AppStateStore batching', () => {
+                        const { commits, flushes } = this.stateStore.getStats();
+                        return { hits: Math.max(0, commits - flushes), misses: flushes };
+                    });
+                }
+                this.perf = perf;
+                window.perfInstrumentation = perf;
+            }
+
             initialize() {
                 this.setupModuleIntegration();
                 this.setupEventHandlers();
@@ -196,6 +241,8 @@ window.mountLearnModuleIfReady = function(instrument) {
                 try { this.renderMiniChordStrip(this.scaleLibrary.getCurrentKey(), this.scaleLibrary.getCurrentScale()); } catch(_){}
                 // Setup sticky scroll behavior for mini chord strip
                 try { this.setupMiniStripScrollBehavior(); } catch(e){ console.warn('Sticky mini strip setup failed', e); }
+                // The landing page is showing; mount the deferred workspace modules when the main thread is free
+                if (this.deferredMounts) this._warmupDeferredMounts(Array.from(this.deferredMounts.keys()));
             }
 
             /**
@@ -284,84 +331,40 @@ window.mountLearnModuleIfReady = function(instrument) {
             }
 
             setupModuleIntegration() {
-                // Connect number generator to container chord tool
-                this.numberGenerator.on('numbersChanged', (data) => {
-                    const scaleNotes = this.scaleLibrary.getCurrentScaleNotes();
-                    const preferred = data.numbers.map(num => {
-                        if (typeof num === 'number') {
-                            return { note: scaleNotes[(num - 1) % scaleNotes.length], degree: num };
+                if (this.stateStore) {
+                    // Modules publish into the store; the fan-out below runs once per frame
+                    // with whatever key/scale/numbers changed in that frame
+                    this.scaleLibrary.on('scaleChanged', (data) => {
+                        this.stateStore.set({ key: data.key, scale: data.scale, scaleNotes: data.notes });
+                    });
+                    this.numberGenerator.on('numbersChanged', (data) => {
+                        this.stateStore.set({ numbers: data.numbers || [], numberType: data.type });
+                    });
+                    this.stateStore.subscribe(['numbers', 'scaleNotes'], (changes, state) => {
+                        // A scale change only matters here when there are degrees to re-map
+                        if (!changes.numbers && !(state.numbers && state.numbers.length)) return;
+                        this._applyNumbersContext(state.numbers || [], state.scaleNotes || this.scaleLibrary.getCurrentScaleNotes());
+                    }, { id: 'numbers-context' });
+                    this.stateStore.subscribe(['key', 'scale', 'scaleNotes'], (changes, state) => {
+                        this._applyScaleContext({ key: state.key, scale: state.scale, notes: state.scaleNotes });
+                    }, { id: 'scale-context' });
+                } else {
+                    this.numberGenerator.on('numbersChanged', (data) => {
+                        this._applyNumbersContext(data.numbers, this.scaleLibrary.getCurrentScaleNotes());
+                    });
+                    this.scaleLibrary.on('scaleChanged', (data) => {
+                        // Degrees map to different notes in the new scale
+                        const currentNumbers = this.numberGenerator.getCurrentNumbers();
+                        if (currentNumbers.length > 0) {
+                            this.numberGenerator.emit('numbersChanged', {
+                                numbers: currentNumbers,
+                                type: this.numberGenerator.getNumberType(),
+                                source: 'scale_change'
+                            });
                         }
-                        return { note: num, degree: null };
+                        this._applyScaleContext(data);
                     });
-                    // Use generated notes to bias sorting (single-note mode for selection)
-                    this.containerChordTool.setPreferredNotes(preferred);
-                    
-                    // NOTE: do NOT auto-select generated notes as input by default.
-                    // We only want the generated notes to bias sorting (preferredNotes).
-                    // Automatically selecting them caused every generated note to be highlighted,
-                    // which is not desirable. Clear any selection so nothing is highlighted.
-                    // If a developer wants automatic selection later, call setInputNotes explicitly.
-                    if (this.containerChordTool && typeof this.containerChordTool.setSelectedNote === 'function') {
-                        this.containerChordTool.setSelectedNote('');
-                    }
-                    
-
-                });
-
-                // Connect scale library to other modules
-                this.scaleLibrary.on('scaleChanged', (data) => {
-                    const currentNumbers = this.numberGenerator.getCurrentNumbers();
-                    if (currentNumbers.length > 0) {
-                        this.numberGenerator.emit('numbersChanged', {
-                            numbers: currentNumbers,
-                            type: this.numberGenerator.getNumberType(),
-                            source: 'scale_change'
-                        });
-                    }
-
-                    // Update progression builder with new key/scale context
-                    if (this.progressionBuilder && this.progressionBuilder.state) {
-                        this.progressionBuilder.state.currentKey = data.key;
-                        this.progressionBuilder.state.currentScale = data.scale;
-                    }
-
-                    // Keep container chord tool in sync with key/scale context
-                    if (this.containerChordTool && this.containerChordTool.setKeyAndScale) {
-                        this.containerChordTool.setKeyAndScale(data.key, data.scale);
-                    }
-
-                    this.pianoVisualizer.renderScale(data);
-                    this.scaleCircleExplorer.setKey(data.key);
-                    this.scaleCircleExplorer.setScaleNotes(data.notes);
-                    if (this.sheetMusicGenerator && this.sheetMusicGenerator.setKeyAndScale) {
-                        this.sheetMusicGenerator.setKeyAndScale(data.key, data.scale, data.notes);
-                    }
-                    this.numberGenerator.setCurrentScaleNotes(data.notes);
-                    this.numberGenerator.setScaleInfo(data.key, data.scale);
-                    this.numberGenerator.render();
-                    if (this.solarSystem) {
-                        this.solarSystem.updateSystem({ key: data.key, scale: data.scale, notes: data.notes });
-                    }
-                    const miniPianoContainer = document.getElementById('mini-piano-visualize-container');
-                    if (miniPianoContainer) {
-                        miniPianoContainer.innerHTML = this.numberGenerator.renderMiniPiano();
-                    }
-                    // Update citation display
-                    const compactInfoContainer = document.getElementById('piano-scale-info-compact');
-                    const expandedInfoContainer = document.getElementById('piano-scale-info');
-                    
-                    if (compactInfoContainer && expandedInfoContainer) {
-                        renderScaleCitation(data.scale, compactInfoContainer, expandedInfoContainer);
-                    }
-                    // Update mini chord strip to reflect new key/scale
-                    try { this.renderMiniChordStrip(data.key, data.scale); } catch(_){}
-                    
-                    // Redraw piano connectors for new scale
-                    setTimeout(() => {
-                        this.renderPianoSheetMusic();
-                        setTimeout(() => this.drawPianoConnectors(), 500);
-                    }, 300);
-                });
+                }
 
                 // Connect container chord tool to piano visualizer
                 this.containerChordTool.on('chordSelected', (data) => {
@@ -376,6 +379,10 @@ window.mountLearnModuleIfReady = function(instrument) {
                             class: role.replace(/\s+/g, '-')
                         }))
                     });
+                    // Playable shape for the same chord on the fretboard
+                    if (this.guitarFretboard && typeof this.guitarFretboard.showChordVoicing === 'function') {
+                        this.guitarFretboard.showChordVoicing(data.chord);
+                    }
                 });
 
                 // Connect progression builder to Solar System to highlight chosen/substituted chords
@@ -458,15 +465,6 @@ window.mountLearnModuleIfReady = function(instrument) {
                     });
                 }
 
-                // Connect number generator to circle explorer
-                this.numberGenerator.on('numbersChanged', (data) => {
-                    const scaleNotes = this.scaleLibrary.getCurrentScaleNotes();
-                    this.scaleCircleExplorer.setGeneratedNumbers(data.numbers, scaleNotes);
-                    if (this.solarSystem && this.solarSystem.setGeneratedNumbers) {
-                        this.solarSystem.setGeneratedNumbers(data.numbers, scaleNotes);
-                    }
-                });
-
                 // Single bubble click: select note across modules
                 this.numberGenerator.on('singleNoteSelected', (data) => {
                     try {
@@ -769,10 +767,90 @@ window.mountLearnModuleIfReady = function(instrument) {
 
                 // Connect progression builder to number generator and scale library
                 if (this.progressionBuilder && this.progressionBuilder.connectModules) {
-                    this.progressionBuilder.connectModules(this.numberGenerator, this.scaleLibrary);
+                    this.progressionBuilder.connectModules(this.numberGenerator, this.scaleLibrary, this.stateStore);
                 }
             }
 
+            /**
+             * Push generated numbers (degrees or note names) into the modules that display them
+             */
+            _applyNumbersContext(numbers, scaleNotes) {
+                const preferred = numbers.map(num => {
+                    if (typeof num === 'number') {
+                        return { note: scaleNotes[(num - 1) % scaleNotes.length], degree: num };
+                    }
+                    return { note: num, degree: null };
+                });
+                // Use generated notes to bias sorting (single-note mode for selection)
+                this.containerChordTool.setPreferredNotes(preferred);
+                
+                // NOTE: do NOT auto-select generated notes as input by default.
+                // We only want the generated notes to bias sorting (preferredNotes).
+                // Automatically selecting them caused every generated note to be highlighted,
+                // which is not desirable. Clear any selection so nothing is highlighted.
+                // If a developer wants automatic selection later, call setInputNotes explicitly.
+                if (this.containerChordTool && typeof this.containerChordTool.setSelectedNote === 'function') {
+                    this.containerChordTool.setSelectedNote('');
+                }
+
+                // Circle explorer and solar system show the generated degrees
+                this.scaleCircleExplorer.setGeneratedNumbers(numbers, scaleNotes);
+                if (this.solarSystem && this.solarSystem.setGeneratedNumbers) {
+                    this.solarSystem.setGeneratedNumbers(numbers, scaleNotes);
+                }
+            }
+
+            /**
+             * Bring every scale-aware module to the given key/scale/notes
+             */
+            _applyScaleContext(data) {
+                // Update progression builder with new key/scale context
+                if (this.progressionBuilder && this.progressionBuilder.state) {
+                    this.progressionBuilder.state.currentKey = data.key;
+                    this.progressionBuilder.state.currentScale = data.scale;
+                }
+
+                // Keep container chord tool in sync with key/scale context
+                if (this.containerChordTool && this.containerChordTool.setKeyAndScale) {
+                    this.containerChordTool.setKeyAndScale(data.key, data.scale);
+                }
+
+                this.pianoVisualizer.renderScale(data);
+                this.scaleCircleExplorer.setKey(data.key);
+                this.scaleCircleExplorer.setScaleNotes(data.notes);
+                if (this.sheetMusicGenerator && this.sheetMusicGenerator.setKeyAndScale) {
+                    this.sheetMusicGenerator.setKeyAndScale(data.key, data.scale, data.notes);
+                }
+                if (this.guitarFretboard && this.guitarFretboard.renderScale) {
+                    this.guitarFretboard.renderScale(data);
+                }
+                this.numberGenerator.setCurrentScaleNotes(data.notes);
+                this.numberGenerator.setScaleInfo(data.key, data.scale);
+                this.numberGenerator.render();
+                if (this.solarSystem) {
+                    this.solarSystem.updateSystem({ key: data.key, scale: data.scale, notes: data.notes });
+                }
+                const miniPianoContainer = document.getElementById('mini-piano-visualize-container');
+                if (miniPianoContainer) {
+                    miniPianoContainer.innerHTML = this.numberGenerator.renderMiniPiano();
+                }
+                // Update citation display
+                const compactInfoContainer = document.getElementById('piano-scale-info-compact');
+                const expandedInfoContainer = document.getElementById('piano-scale-info');
+                
+                if (compactInfoContainer && expandedInfoContainer) {
+                    renderScaleCitation(data.scale, compactInfoContainer, expandedInfoContainer);
+                }
+                // Update mini chord strip to reflect new key/scale
+                try { this.renderMiniChordStrip(data.key, data.scale); } catch(_){}
+                
+                // Redraw piano connectors for new scale
+                setTimeout(() => {
+                    this.renderPianoSheetMusic();
+                    setTimeout(() => this.drawPianoConnectors(), 500);
+                }, 300);
+            }
+
             /**
              * Public entrypoint invoked by the NumberGenerator "Harmonize" button.
              * Ensures the progression builder and sheet generator honor the requested
@@ -857,22 +935,9 @@ window.mountLearnModuleIfReady = function(instrument) {
                     catch (e) { console.warn(`[ModularApp] ${label} failed`, e); }
                 };
 
-                // Sync fretboard to ScaleLibrary changes
+                // Sync fretboard to ScaleLibrary highlighting (scale changes go through _applyScaleContext)
                 safe('ScaleLibrary.events', () => {
                     if (this.scaleLibrary && typeof this.scaleLibrary.on === 'function') {
-                        this.scaleLibrary.on('scaleChanged', ({ key, scale, notes }) => {
-                            if (this.guitarFretboard && this.guitarFretboard.renderScale) {
-                                this.guitarFretboard.renderScale({ key, scale, notes });
-                            }
-                            if (this.numberGenerator) {
-                                if (typeof this.numberGenerator.setScaleInfo === 'function') {
-                                    this.numberGenerator.setScaleInfo(key, scale);
-                                }
-                                if (typeof this.numberGenerator.setCurrentScaleNotes === 'function') {
-                                    this.numberGenerator.setCurrentScaleNotes(notes);
-                                }
-                            }
-                        });
                         this.scaleLibrary.on('degreeHighlighted', ({ note }) => {
                             if (this.guitarFretboard && this.guitarFretboard.highlightNote) {
                                 this.guitarFretboard.highlightNote(note);
@@ -987,12 +1052,13 @@ window.mountLearnModuleIfReady = function(instrument) {
                         }
                     });
 
-                    // Mount scale relationship explorer
-                    safe('ScaleRelationshipExplorer.mount', () => {
+                    // Below-the-fold / optional modules mount when their container is shown
+                    // or in idle time (see mountWorkspaceModules)
+                    this.deferMount('scale-relationship-container', () => safe('ScaleRelationshipExplorer.mount', () => {
                         if (this.scaleRelationshipExplorer && this.scaleRelationshipExplorer.mount) {
                             this.scaleRelationshipExplorer.mount('#scale-relationship-container');
                         }
-                    });
+                    }));
 
                     // Mount progression builder
                     safe('ProgressionBuilder.mount', () => {
@@ -1009,26 +1075,30 @@ window.mountLearnModuleIfReady = function(instrument) {
                     });
 
                     // Mount chord explorer
-                    safe('UnifiedChordExplorer.mount', () => {
+                    this.deferMount('chord-explorer-container', () => safe('UnifiedChordExplorer.mount', () => {
                         if (this.chordExplorer && this.chordExplorer.mount) {
                             this.chordExplorer.mount('#chord-explorer-container');
                         }
-                    });
+                    }));
 
                     // Mount sheet music generator under chord explorer
-                    safe('SheetMusicGenerator.mount', () => {
+                    this.deferMount('sheet-music-container', () => safe('SheetMusicGenerator.mount', () => {
                         if (this.sheetMusicGenerator && this.sheetMusicGenerator.mount) {
                             this.sheetMusicGenerator.mount('#sheet-music-container');
                         }
-                    });
+                    }));
 
                     // Mount solar system visualizer (docked by default)
-                    safe('SolarSystem.mount', () => {
+                    this.deferMount('solar-dock-viewport', () => safe('SolarSystem.mount', () => {
                         if (this.solarSystem && this.solarSystem.mount) {
                             const mountTarget = '#solar-dock-viewport';
                             this.solarSystem.mount(mountTarget);
+                            // Auto-play solar system if possible
+                            if (typeof this.solarSystem.start === 'function') {
+                                try { this.solarSystem.start(); } catch(e) { /* ignore */ }
+                            }
                         }
-                    });
+                    }));
                     // (condensed sidebar solar removed)
                     // Mobile autodetect: add class and slightly reduce solar size scale
                     safe('SolarSystem.ui', () => {
@@ -1051,10 +1121,6 @@ window.mountLearnModuleIfReady = function(instrument) {
                         if (avBtn && this.audioVisualizer) {
                             avBtn.addEventListener('click', () => this.audioVisualizer.open());
                         }
-                        // Auto-play solar system if possible
-                        if (this.solarSystem && typeof this.solarSystem.start === 'function') {
-                            try { this.solarSystem.start(); } catch(e) { /* ignore */ }
-                        }
 
                         // Dock/Undock control
                         const dockBtn = document.getElementById('dock-solar');
@@ -1103,6 +1169,44 @@ window.mountLearnModuleIfReady = function(instrument) {
                     });
             }
 
+            /**
+             * Register a module mount that can wait until its container is needed
+             */
+            deferMount(containerId, mountFn) {
+                if (!this.deferredMounts) this.deferredMounts = new Map();
+                this.deferredMounts.set(containerId, mountFn);
+            }
+
+            /**
+             * Mount deferred modules whose containers are in `containerIds` (all when null)
+             * now, and warm the rest up in idle time.
+             */
+            mountWorkspaceModules(containerIds = null) {
+                if (!this.deferredMounts || this.deferredMounts.size === 0) return;
+                const wanted = containerIds ? new Set(containerIds) : null;
+                const later = [];
+                Array.from(this.deferredMounts.keys()).forEach(id => {
+                    if (!wanted || wanted.has(id)) this._runDeferredMount(id);
+                    else later.push(id);
+                });
+                this._warmupDeferredMounts(later);
+            }
+
+            _runDeferredMount(containerId) {
+                const mountFn = this.deferredMounts && this.deferredMounts.get(containerId);
+                if (!mountFn) return;
+                this.deferredMounts.delete(containerId);
+                mountFn();
+            }
+
+            _warmupDeferredMounts(containerIds) {
+                const loader = window.moduleLoader;
+                containerIds.forEach(id => {
+                    if (loader) loader.whenIdle(() => this._runDeferredMount(id));
+                    else setTimeout(() => this._runDeferredMount(id), 0);
+                });
+            }
+
             renderInitialState() {
                 // Set initial scale
                 this.scaleLibrary.setKeyAndScale('C', 'major');
@@ -1584,8 +1688,16 @@ window.mountLearnModuleIfReady = function(instrument) {
             if (expandedContainer) expandedContainer.innerHTML = '<div class="no-sources">Source information removed</div>';
         }
 
-        // Initialize the modular app when DOM is ready
+        // Initialize the modular app when DOM is ready. On warm visits SCALES and the derived
+        // indexes come from the IndexedDB snapshot, and the engines read them while constructing,
+        // so wait for it to land (snapshot.ready resolves after loadTimeout at the latest).
         document.addEventListener('DOMContentLoaded', () => {
+            const snapshot = window.derivedIndexSnapshot;
+            if (snapshot && snapshot.ready) snapshot.ready.then(startModularApp, startModularApp);
+            else startModularApp();
+        });
+
+        function startModularApp() {
             window.modularApp = new ModularMusicTheoryApp();
             // Expose key components globally for lexical integration
             window.numberGenerator = window.modularApp.numberGenerator;
@@ -1725,23 +1837,24 @@ window.mountLearnModuleIfReady = function(instrument) {
                 if (!mm._uiNoteHandlersAttached) {
                     mm._uiNoteHandlersAttached = true;
 
-                    mm.on('noteOn', ({ midi }) => {
+                    // One coalesced snapshot per frame keeps dense chords/pedal bursts off the input path
+                    mm.on('activeNotes', ({ notes, pressed, released }) => {
                         // Global full keyboard
-                        if (window.modularApp.pianoVisualizer && typeof window.modularApp.pianoVisualizer.midiNoteOn === 'function') {
-                            window.modularApp.pianoVisualizer.midiNoteOn(midi);
+                        const pv = window.modularApp.pianoVisualizer;
+                        if (pv && typeof pv.setMidiNotes === 'function') {
+                            pv.setMidiNotes(notes);
                         }
                         // Learn: Piano Notes (1-octave keyboard)
-                        if (window.learnPianoNotesInstance && typeof window.learnPianoNotesInstance.midiNoteOn === 'function') {
-                            window.learnPianoNotesInstance.midiNoteOn(midi);
+                        const lpn = window.learnPianoNotesInstance;
+                        if (lpn) {
+                            if (typeof lpn.midiNoteOff === 'function') released.forEach(m => lpn.midiNoteOff(m));
+                            if (typeof lpn.midiNoteOn === 'function') pressed.forEach(m => { if (notes.includes(m)) lpn.midiNoteOn(m); });
                         }
-                    });
-
-                    mm.on('noteOff', ({ midi }) => {
-                        if (window.modularApp.pianoVisualizer && typeof window.modularApp.pianoVisualizer.midiNoteOff === 'function') {
-                            window.modularApp.pianoVisualizer.midiNoteOff(midi);
-                        }
-                        if (window.learnPianoNotesInstance && typeof window.learnPianoNotesInstance.midiNoteOff === 'function') {
-                            window.learnPianoNotesInstance.midiNoteOff(midi);
+                        // Fretboard follows the most recent held note
+                        const fb = window.modularApp.guitarFretboard;
+                        const latest = pressed.filter(m => notes.includes(m)).pop();
+                        if (fb && latest !== undefined && typeof fb.highlightMidi === 'function') {
+                            fb.highlightMidi(latest);
                         }
                     });
                 }
@@ -1757,7 +1870,7 @@ window.mountLearnModuleIfReady = function(instrument) {
             
             // Setup module toggle functionality
             setupModuleControls();
-        });
+        }
         
         // Setup control deck global controls
         function setupControlDeck() {
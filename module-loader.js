@@ -0,0 +1,165 @@
+/**
+ * @module ModuleLoader
+ * @description On-demand script loading, idle-time warmup and time-to-interactive reporting
+ * @exports class ModuleLoader
+ * @feature load(id) injects a manifest entry's scripts once, in order, and resolves when they have run
+ * @feature whenIdle()/warmup() run deferred work in requestIdleCallback slots (setTimeout fallback)
+ * @feature beginInteraction()/markInteractive() measure launch-to-idle time per entrypoint
+ */
+
+class ModuleLoader {
+    constructor(options = {}) {
+        this.manifest = { ...ModuleLoader.MANIFEST, ...(options.manifest || {}) };
+        this.loading = new Map();   // src -> Promise
+        this.idleQueue = [];
+        this.idleScheduled = false;
+        this.interactions = new Map(); // label -> start time (ms)
+        this.metrics = [];          // { label, tti, at }
+    }
+
+    /**
+     * Load every script listed for a manifest id (or a bare script URL)
+     * @returns {Promise} resolves once all scripts have executed
+     */
+    load(id) {
+        const scripts = this.manifest[id] || (/\.js(\?|$)/.test(id) ? [id] : null);
+        if (!scripts) return Promise.reject(new Error(`[ModuleLoader] Unknown module: ${id}`));
+        // Sequential: later scripts in an entry may depend on earlier ones
+        return scripts.reduce((chain, src) => chain.then(() => this._loadScript(src)), Promise.resolve());
+    }
+
+    isLoaded(id) {
+        const scripts = this.manifest[id] || [id];
+        return scripts.every(src => {
+            const pending = this.loading.get(src);
+            return pending ? !!pending.settled : this._hasStaticTag(src);
+        });
+    }
+
+    _hasStaticTag(src) {
+        if (typeof document === 'undefined') return false;
+        return !!document.querySelector(`script[src="${src}"]`) && !this.loading.has(src);
+    }
+
+    _loadScript(src) {
+        if (this.loading.has(src)) return this.loading.get(src);
+        if (this._hasStaticTag(src)) return Promise.resolve();
+
+        const promise = new Promise((resolve, reject) => {
+            const script = document.createElement('script');
+            script.src = src;
+            script.async = false;
+            script.onload = () => { promise.settled = true; resolve(); };
+            script.onerror = () => {
+                this.loading.delete(src);
+                reject(new Error(`[ModuleLoader] Failed to load ${src}`));
+            };
+            document.head.appendChild(script);
+        });
+        this.loading.set(src, promise);
+        return promise;
+    }
+
+    /**
+     * Run fn in the next idle slot. Tasks run one per slot so a long warmup
+     * list never blocks input.
+     */
+    whenIdle(fn, options = {}) {
+        return new Promise((resolve, reject) => {
+            this.idleQueue.push({ fn, resolve, reject, timeout: options.timeout || 2000 });
+            this._scheduleIdle();
+        });
+    }
+
+    _scheduleIdle() {
+        if (this.idleScheduled || this.idleQueue.length === 0) return;
+        this.idleScheduled = true;
+        const timeout = this.idleQueue[0].timeout;
+        const run = (deadline) => {
+            this.idleScheduled = false;
+            const task = this.idleQueue.shift();
+            if (task) {
+                try {
+                    Promise.resolve(task.fn(deadline)).then(task.resolve, task.reject);
+                } catch (err) {
+                    task.reject(err);
+                }
+            }
+            this._scheduleIdle();
+        };
+        if (typeof requestIdleCallback === 'function') {
+            requestIdleCallback(run, { timeout });
+        } else {
+            setTimeout(() => run({ didTimeout: true, timeRemaining: () => 0 }), 50);
+        }
+    }
+
+    /**
+     * Load manifest ids during idle time, one per slot
+     */
+    warmup(ids) {
+        return Promise.all((ids || []).map(id => this.whenIdle(() => this.load(id)).catch(err => {
+            console.warn('[ModuleLoader] Warmup failed:', id, err && err.message);
+        })));
+    }
+
+    _now() {
+        return (typeof performance !== 'undefined' && performance.now) ? performance.now() : Date.now();
+    }
+
+    /**
+     * Start timing an entrypoint (defaults to navigation start when never called)
+     */
+    beginInteraction(label) {
+        this.interactions.set(label, this._now());
+        if (typeof performance !== 'undefined' && performance.mark) {
+            try { performance.mark(`${label}:start`); } catch (_) {}
+        }
+    }
+
+    /**
+     * Record time-to-interactive for `label`: the first idle slot after the
+     * entrypoint's synchronous work is done.
+     */
+    markInteractive(label) {
+        const start = this.interactions.has(label) ? this.interactions.get(label) : 0;
+        this.interactions.delete(label);
+        return this.whenIdle(() => {
+            const tti = this._now() - start;
+            const entry = { label, tti: Math.round(tti), at: Date.now() };
+            this.metrics.push(entry);
+            if (typeof performance !== 'undefined' && performance.measure) {
+                try {
+                    performance.mark(`${label}:interactive`);
+                    if (start) performance.measure(`tti:${label}`, `${label}:start`, `${label}:interactive`);
+                } catch (_) {}
+            }
+            console.info(`[ModuleLoader] ${label} interactive in ${entry.tti}ms`);
+            if (typeof window !== 'undefined' && typeof CustomEvent === 'function') {
+                window.dispatchEvent(new CustomEvent('moduleInteractive', { detail: entry }));
+            }
+            return entry;
+        }, { timeout: 500 });
+    }
+
+    getMetrics() {
+        return this.metrics.slice();
+    }
+}
+
+// Script sets that are not part of the initial page load
+ModuleLoader.MANIFEST = {
+    'learn-scales': ['learn-scales.js'],
+    'learn-chords': ['learn-chords.js'],
+    'learn-inversions': ['learn-inversions.js'],
+    'learn-piano-notes': ['learn-piano-notes.js'],
+    'learn-guitar-notes': ['learn-guitar-notes.js'],
+    // compromise (window.nlp): POS tagging for main-thread ContextEngine parses.
+    // analysis-worker.js imports its own copy.
+    'nlp': ['compromise.min.js']
+};
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = ModuleLoader;
+}
@@ -10,6 +10,10 @@ class ModuleSelector {
         this.currentSkillLevel = 'beginner';
         // Preferred instrument for lessons (default to piano)
         this.preferredInstrument = localStorage.getItem('music-theory-instrument') || 'piano';
+        // Learn pages and other optional scripts load on first use
+        this.loader = typeof ModuleLoader !== 'undefined'
+            ? (window.moduleLoader || (window.moduleLoader = new ModuleLoader()))
+            : null;
         
         // Module definitions organized by skill level
         this.modules = {
@@ -148,6 +152,10 @@ class ModuleSelector {
         this.wrapOrphanModuleContainers();
         this.setupEventListeners();
         this.showLandingPage();
+        if (this.loader) {
+            this.loader.markInteractive('landing');
+            this.loader.warmup(['nlp', 'learn-scales', 'learn-chords']);
+        }
         this.applyInstrumentButtonState();
     }
 
@@ -538,7 +546,7 @@ class ModuleSelector {
         if (bottomDeck) bottomDeck.style.display = 'none';
 
         // Lazy-mount the learn module
-        try {
+        this._withLearnModule('learn-piano-notes', () => {
             if (!window.learnPianoNotesInstance) {
                 const LearnClass = window.LearnPianoNotes;
                 if (LearnClass && window.modularApp && window.modularApp.musicTheory) {
@@ -548,9 +556,7 @@ class ModuleSelector {
             if (window.learnPianoNotesInstance && typeof window.learnPianoNotesInstance.mount === 'function') {
                 window.learnPianoNotesInstance.mount('#learn-piano-notes-container');
             }
-        } catch (e) {
-            console.error('[ModuleSelector] Failed to mount LearnPianoNotes:', e);
-        }
+        }, 'LearnPianoNotes');
     }
 
     launchLearnChords() {
@@ -567,7 +573,7 @@ class ModuleSelector {
         if (bottomDeck) bottomDeck.style.display = 'none';
 
         // Lazy-mount the learn chords module
-        try {
+        this._withLearnModule('learn-chords', () => {
             if (!window.learnChordsInstance) {
                 const LearnClass = window.LearnChords;
                 if (LearnClass && window.modularApp && window.modularApp.musicTheory) {
@@ -582,9 +588,7 @@ class ModuleSelector {
                     window.learnChordsInstance.connectMidi(window.modularApp.midiManager);
                 }
             }
-        } catch (e) {
-            console.error('[ModuleSelector] Failed to mount LearnChords:', e);
-        }
+        }, 'LearnChords');
     }
 
     launchLearnScales() {
@@ -601,7 +605,7 @@ class ModuleSelector {
         if (bottomDeck) bottomDeck.style.display = 'none';
 
         // Lazy-mount the learn scales module
-        try {
+        this._withLearnModule('learn-scales', () => {
             if (!window.learnScalesInstance) {
                 const LearnClass = window.LearnScales;
                 if (LearnClass && window.modularApp && window.modularApp.musicTheory) {
@@ -616,12 +620,32 @@ class ModuleSelector {
                     window.learnScalesInstance.connectMidi(window.modularApp.midiManager);
                 }
             }
-        } catch (e) {
-            console.error('[ModuleSelector] Failed to mount LearnScales:', e);
-        }
+        }, 'LearnScales');
+    }
+
+    /**
+     * Load a learn page's script if needed, then run its mount step and report
+     * time-to-interactive for the entrypoint.
+     */
+    _withLearnModule(moduleId, mountFn, label) {
+        const run = () => {
+            try {
+                mountFn();
+            } catch (e) {
+                console.error(`[ModuleSelector] Failed to mount ${label}:`, e);
+            }
+            if (this.loader) this.loader.markInteractive(moduleId);
+        };
+        if (!this.loader) return run();
+        this.loader.beginInteraction(moduleId);
+        this.loader.load(moduleId).then(run, (e) => {
+            console.error(`[ModuleSelector] Failed to load ${label}:`, e);
+        });
     }
 
     launchWorkspace(useSelectedOnly = false) {
+        if (this.loader) this.loader.beginInteraction('workspace');
+
         const landing = document.getElementById('landing-page');
         const learn = document.getElementById('learn-piano-page');
         const workspace = document.querySelector('.workspace');
@@ -638,7 +662,10 @@ class ModuleSelector {
         // If specific modules were selected and useSelectedOnly flag is true, hide non-selected modules
         if (useSelectedOnly && this.selectedModules.size > 0) {
             this.filterWorkspaceModules(Array.from(this.selectedModules));
+        } else if (window.modularApp && typeof window.modularApp.mountWorkspaceModules === 'function') {
+            window.modularApp.mountWorkspaceModules(null);
         }
+        if (this.loader) this.loader.markInteractive('workspace');
 
         // First-time visitor prompt for tutorial (moved from tutorial-system.js)
         // Tutorial prompt logic now handled in tutorial-system.js after launch-workspace-btn click
@@ -679,6 +706,11 @@ class ModuleSelector {
             }
         });
 
+        // Construct what is visible now; the rest warms up in idle time
+        if (window.modularApp && typeof window.modularApp.mountWorkspaceModules === 'function') {
+            window.modularApp.mountWorkspaceModules(Array.from(visibleContainers));
+        }
+
         console.log('[ModuleSelector] Filtered workspace. Visible modules:', Array.from(visibleContainers));
     }
 }
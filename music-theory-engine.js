@@ -205,6 +205,96 @@ class MusicTheoryEngine {
                 this.semitoneToNote[semi] = note;
             }
         });
+
+        // Pitch-class bitmask index used by findAllContainerChords
+        this._buildContainerChordIndex();
+
+        // Bounded memo for the pure note/chord lookups (see _memoize)
+        this._memoTables = new Map();
+        this._memoLimit = 1024; // entries per table
+        this._memoScalesRef = this.scales;
+        this.memoStats = { hits: 0, misses: 0, evictions: 0, invalidations: 0 };
+        // Bumped whenever cached grades may be stale (mode change or scale catalog change)
+        this.gradingVersion = 0;
+    }
+
+    /**
+     * Look up `key` in the named memo table, computing and freezing on a miss.
+     * Array results are frozen so every caller can share one instance; tables
+     * are LRU-bounded and dropped whenever the scale catalog changes.
+     */
+    _memoize(table, key, compute) {
+        if (!this._memoTables) return compute();
+        // ScaleLibrary may swap in a whole new catalog object
+        if (this._memoScalesRef !== this.scales) this.invalidateMemo();
+
+        let map = this._memoTables.get(table);
+        if (!map) {
+            map = new Map();
+            this._memoTables.set(table, map);
+        }
+        if (map.has(key)) {
+            const hit = map.get(key);
+            // Refresh recency
+            map.delete(key);
+            map.set(key, hit);
+            this.memoStats.hits++;
+            return hit;
+        }
+
+        this.memoStats.misses++;
+        let value = compute();
+        if (Array.isArray(value)) value = Object.freeze(value);
+        map.set(key, value);
+        if (map.size > this._memoLimit) {
+            map.delete(map.keys().next().value);
+            this.memoStats.evictions++;
+        }
+        return value;
+    }
+
+    /**
+     * Drop all memoized lookups (called when ensureScale registers a scale)
+     */
+    invalidateMemo() {
+        if (!this._memoTables) return;
+        this._memoTables.clear();
+        this._memoScalesRef = this.scales;
+        this.memoStats.invalidations++;
+        this.gradingVersion++;
+    }
+
+    /**
+     * Drop cached grades and tier info only (called by setGradingMode); note/chord lookups stay warm
+     */
+    invalidateGradingCache() {
+        if (this._memoTables) MusicTheoryEngine.GRADING_TABLES.forEach(table => this._memoTables.delete(table));
+        this.gradingVersion++;
+    }
+
+    /**
+     * Current grading state for subscribers: tier info for every tier plus cached lookups.
+     * Carried on grading events so handlers can read grades without recomputing them.
+     */
+    getGradingSnapshot() {
+        const tiers = [0, 1, 2, 3, 4].map(tier => this.getGradingTierInfo(tier));
+        return {
+            mode: this.gradingMode,
+            version: this.gradingVersion,
+            tiers,
+            grade: (element, context = {}) => this.calculateElementGrade(element, context),
+            grading: (element, context = {}) => this.getElementGrading(element, context)
+        };
+    }
+
+    /**
+     * Memo hit/miss counters plus per-table sizes
+     */
+    getMemoStats() {
+        const tables = {};
+        if (this._memoTables) this._memoTables.forEach((map, name) => { tables[name] = map.size; });
+        const { hits, misses } = this.memoStats;
+        return { ...this.memoStats, hitRate: hits + misses ? hits / (hits + misses) : 0, tables };
     }
 
     /**
@@ -297,7 +387,7 @@ class MusicTheoryEngine {
     spellNotesForRoot(preferredRoot, notes) {
         if (!preferredRoot || !Array.isArray(notes)) return notes || [];
         const preferFlat = String(preferredRoot).indexOf('b') >= 0;
-        return notes.map(n => {
+        return this._memoize('spellNotesForRoot', (preferFlat ? 'b|' : '#|') + notes.join(','), () => notes.map(n => {
             try {
                 const v = this.noteValues[n];
                 if (v === undefined) return n;
@@ -305,7 +395,7 @@ class MusicTheoryEngine {
             } catch (e) {
                 return n;
             }
-        });
+        }));
     }
 
     /**
@@ -354,6 +444,12 @@ class MusicTheoryEngine {
      */
     getScaleNotesWithKeySignature(key, scaleType) {
         const scaleId = this.normalizeScaleId ? this.normalizeScaleId(scaleType) : String(scaleType);
+        // Unknown ids fall back to major; don't memoize those so a later registration is seen
+        if (!this.scales || !this.scales[scaleId]) return this._computeScaleNotesWithKeySignature(key, scaleId);
+        return this._memoize('scaleNotesKS', `${key}|${scaleId}`, () => this._computeScaleNotesWithKeySignature(key, scaleId));
+    }
+
+    _computeScaleNotesWithKeySignature(key, scaleId) {
         const intervals = this.scales[scaleId] || this.scales.major;
 
         // For church-mode modal scales (dorian, phrygian, lydian, mixolydian,
@@ -483,6 +579,8 @@ class MusicTheoryEngine {
         const scaleId = this.normalizeScaleId ? this.normalizeScaleId(scaleType) : String(scaleType);
         if (!scaleId) return false;
         if (this.scales && this.scales[scaleId]) return true;
+        // Anything registered below changes scale lookups
+        const registered = () => { this.invalidateMemo(); return true; };
 
         // Try to source from global embedded catalog if available (browser)
         try {
@@ -491,7 +589,17 @@ class MusicTheoryEngine {
                 this.scales = this.scales || {};
                 this.scales[scaleId] = globalS.intervals[scaleId];
                 this.scalesMeta = this.scalesMeta || globalS.meta || {};
-                return true;
+                return registered();
+            }
+        } catch (_) {}
+
+        // Packed catalog (scales-data-packed.js): decode this record on first request
+        try {
+            const packed = (typeof globalThis !== 'undefined' && globalThis.ScaleCatalogPacked) || (typeof window !== 'undefined' && window.ScaleCatalogPacked) || null;
+            if (packed && packed.has(scaleId)) {
+                this.scales = this.scales || {};
+                this.scales[scaleId] = packed.getIntervals(scaleId);
+                return registered();
             }
         } catch (_) {}
 
@@ -502,7 +610,7 @@ class MusicTheoryEngine {
                 this.scales = this.scales || {};
                 this.scales[scaleId] = S.intervals[scaleId];
                 this.scalesMeta = this.scalesMeta || S.meta || {};
-                return true;
+                return registered();
             }
         } catch (_) {}
 
@@ -513,6 +621,10 @@ class MusicTheoryEngine {
      * Get all notes in a chord
      */
     getChordNotes(root, chordType) {
+        return this._memoize('chordNotes', `${root}|${chordType}`, () => this._computeChordNotes(root, chordType));
+    }
+
+    _computeChordNotes(root, chordType) {
         const normalized = this.normalizeChordType(chordType);
         let formula = this.chordFormulas[normalized] || this.chordFormulas[chordType];
         if (!formula) {
@@ -594,6 +706,11 @@ class MusicTheoryEngine {
      * Prefers seventh-chord names when available, falls back to triads and sus
      */
     classifyChordTypeFromIntervals(intervals) {
+        const key = Array.from(new Set(intervals)).sort((a, b) => a - b).join(',');
+        return this._memoize('classifyIntervals', key, () => this._classifyChordTypeFromIntervals(intervals));
+    }
+
+    _classifyChordTypeFromIntervals(intervals) {
         const set = new Set(intervals);
         const has = (n) => set.has(n);
 
@@ -783,152 +900,210 @@ class MusicTheoryEngine {
     }
 
     /**
-     * Find all chords containing given notes (container chords)
+     * Build a 12-bit pitch-class mask from note names (bit n = semitone n above C).
+     * Unknown note names are ignored.
      */
-    findAllContainerChords(notes, scaleNotes) {
-        const results = [];
+    notesToPitchClassMask(notes) {
+        let mask = 0;
+        if (!Array.isArray(notes)) return mask;
+        for (const n of notes) {
+            const v = this.noteValues[n];
+            if (v !== undefined) mask |= (1 << (v % 12));
+        }
+        return mask;
+    }
 
-        const key = scaleNotes && scaleNotes.length ? scaleNotes[0] : null;
-        const keyVal = key ? this.noteValues[key] : null;
+    /**
+     * Functional role of a chord type whose root sits `rootToKey` semitones above the key.
+     * Pass null for an unknown key pitch (maps to the chromatic/pivot branch).
+     */
+    _computeContainerFunctions(chordType, rootToKey) {
+        const f = this.chordFormulas[chordType];
+        const hasMaj3 = !!(f && f.includes(4));
+        const hasMin3 = !!(f && f.includes(3));
+        const isDominantQuality = chordType.includes('7') && !chordType.includes('maj7');
+
+        const funcs = new Set();
+        const res = new Set();
+
+        const domQual = isDominantQuality && hasMaj3;
+        const majTriad = hasMaj3 && !chordType.includes('7');
+        const minQual = hasMin3 && !hasMaj3;
+
+        switch (rootToKey) {
+            case 0: // I
+                if (chordType.includes('#5') || chordType.includes('aug')) funcs.add('Tonic (color)');
+                else funcs.add('Tonic');
+                res.add('—');
+                break;
+            case 2: // II
+                if (minQual) funcs.add('Predominant');
+                if (domQual) { funcs.add('Secondary Dominant (to V)'); res.add('→ V'); }
+                else res.add('→ V');
+                break;
+            case 4: // III
+                if (domQual || majTriad) { funcs.add('Secondary Dominant (to vi)'); res.add('→ vi'); }
+                else funcs.add('Tonic Prolongation');
+                break;
+            case 5: // IV
+                funcs.add('Predominant'); res.add('→ V');
+                break;
+            case 7: // V
+                funcs.add('Dominant'); res.add('→ I');
+                break;
+            case 9: // VI
+                if (minQual) funcs.add('Tonic Prolongation'); else funcs.add('Predominant');
+                res.add('→ ii or → V');
+                break;
+            case 11: // VII
+                if (chordType.includes('dim')) { funcs.add('Leading-tone'); res.add('→ I or → V'); }
+                else funcs.add('Dominant Color');
+                break;
+            case 1: // bII
+                if (domQual || majTriad) { funcs.add('Tritone Sub (of V)'); res.add('→ V'); }
+                else funcs.add('Modal Interchange');
+                break;
+            case 8: // bVI
+                funcs.add('Modal Interchange (bVI)'); res.add('→ V');
+                break;
+            case 10: // bVII
+                funcs.add('Modal Interchange (bVII)'); res.add('→ I or → V');
+                break;
+            case 3: // bIII
+                funcs.add('Modal Interchange (bIII)'); res.add('→ IV or → I');
+                break;
+            default:
+                funcs.add('Chromatic/Pivot');
+                res.add('contextual');
+        }
 
-        const semis = (a, b) => (this.noteValues[a] - this.noteValues[b] + 12) % 12;
+        if (domQual && !funcs.has('Secondary Dominant (to vi)') && !funcs.has('Tritone Sub (of V)') && !funcs.has('Dominant')) {
+            funcs.add('Dominant-like');
+        }
 
-        const hasMaj3 = (type) => {
-            const f = this.chordFormulas[type];
-            return f && f.includes(4);
-        };
+        return { functions: Array.from(funcs), resolutions: Array.from(res) };
+    }
 
-        const hasMin3 = (type) => {
-            const f = this.chordFormulas[type];
-            return f && f.includes(3);
-        };
+    /**
+     * Precompute every (root, chordType) pair as a pitch-class mask plus the data
+     * findAllContainerChords needs, so a query is a scan over integers.
+     * Entries are stored in output order (by chord size, then root, then formula order).
+     * Functional analysis is tabulated per chordType for each of the 12 root-to-key
+     * distances, with slot 12 used when the key pitch is unknown.
+     */
+    _buildContainerChordIndex() {
+        const functionTables = {};
+        Object.keys(this.chordFormulas).forEach(chordType => {
+            const table = [];
+            for (let i = 0; i < 12; i++) table.push(this._computeContainerFunctions(chordType, i));
+            table.push(this._computeContainerFunctions(chordType, null));
+            functionTables[chordType] = table;
+        });
 
-        const isDominantQuality = (type) => type.includes('7') && !type.includes('maj7');
+        const entries = [];
+        this.chromaticNotes.forEach(root => {
+            const rootValue = this.noteValues[root];
+            Object.keys(this.chordFormulas).forEach(chordType => {
+                const chordNotes = this.getChordNotes(root, chordType);
+                const pcs = chordNotes.map(n => this.noteValues[n]);
+                let mask = 0;
+                for (const pc of pcs) mask |= (1 << pc);
+                entries.push({
+                    mask,
+                    root,
+                    rootValue,
+                    chordType,
+                    fullName: root + chordType,
+                    chordNotes,
+                    pcs,
+                    complexity: this.getChordComplexity(chordType),
+                    functionTable: functionTables[chordType]
+                });
+            });
+        });
 
-        const self = this;
-        function computeFunctions(root, chordType, keyName) {
-            if (!keyName) return { functions: [], resolutions: [] };
-            const rootToKey = (self.noteValues[root] - self.noteValues[keyName] + 12) % 12;
-            const funcs = new Set();
-            const res = new Set();
+        // Array.prototype.sort is stable, so ties keep root/formula order.
+        entries.sort((a, b) => a.chordNotes.length - b.chordNotes.length);
 
-            const domQual = isDominantQuality(chordType) && hasMaj3(chordType);
-            const majTriad = hasMaj3(chordType) && !chordType.includes('7');
-            const minQual = hasMin3(chordType) && !hasMaj3(chordType);
+        const masks = new Uint16Array(entries.length);
+        entries.forEach((entry, i) => { masks[i] = entry.mask; });
 
-            switch (rootToKey) {
-                case 0: // I
-                    if (chordType.includes('#5') || chordType.includes('aug')) funcs.add('Tonic (color)');
-                    else funcs.add('Tonic');
-                    res.add('—');
-                    break;
-                case 2: // II
-                    if (minQual) funcs.add('Predominant');
-                    if (domQual) { funcs.add('Secondary Dominant (to V)'); res.add('→ V'); }
-                    else res.add('→ V');
-                    break;
-                case 4: // III
-                    if (domQual || majTriad) { funcs.add('Secondary Dominant (to vi)'); res.add('→ vi'); }
-                    else funcs.add('Tonic Prolongation');
-                    break;
-                case 5: // IV
-                    funcs.add('Predominant'); res.add('→ V');
-                    break;
-                case 7: // V
-                    funcs.add('Dominant'); res.add('→ I');
-                    break;
-                case 9: // VI
-                    if (minQual) funcs.add('Tonic Prolongation'); else funcs.add('Predominant');
-                    res.add('→ ii or → V');
-                    break;
-                case 11: // VII
-                    if (chordType.includes('dim')) { funcs.add('Leading-tone'); res.add('→ I or → V'); }
-                    else funcs.add('Dominant Color');
-                    break;
-                case 1: // bII
-                    if (domQual || majTriad) { funcs.add('Tritone Sub (of V)'); res.add('→ V'); }
-                    else funcs.add('Modal Interchange');
-                    break;
-                case 8: // bVI
-                    funcs.add('Modal Interchange (bVI)'); res.add('→ V');
-                    break;
-                case 10: // bVII
-                    funcs.add('Modal Interchange (bVII)'); res.add('→ I or → V');
-                    break;
-                case 3: // bIII
-                    funcs.add('Modal Interchange (bIII)'); res.add('→ IV or → I');
-                    break;
-                default:
-                    funcs.add('Chromatic/Pivot');
-                    res.add('contextual');
-            }
+        this.containerChordIndex = { entries, masks };
+        return this.containerChordIndex;
+    }
 
-            if (domQual && !funcs.has('Secondary Dominant (to vi)') && !funcs.has('Tritone Sub (of V)') && !funcs.has('Dominant')) {
-                funcs.add('Dominant-like');
+    /**
+     * Find all chords containing given notes (container chords)
+     * @param {Array<string>} notes - note names to search for
+     * @param {Array<string>} scaleNotes - current scale (first note is treated as the key)
+     * @param {Object} [options]
+     * @param {'any'|'all'} [options.match='any'] - 'any' keeps chords sharing at least one
+     *   pitch class with `notes`; 'all' keeps only chords containing every pitch class
+     */
+    findAllContainerChords(notes, scaleNotes, options = {}) {
+        const results = [];
+        const index = this.containerChordIndex || this._buildContainerChordIndex();
+        const noteList = Array.isArray(notes) ? notes : [];
+        const scaleList = Array.isArray(scaleNotes) ? scaleNotes : [];
+
+        const key = scaleList.length ? scaleList[0] : null;
+        const keyVal = key ? this.noteValues[key] : undefined;
+        const requireAll = options && options.match === 'all';
+
+        const target = this.notesToPitchClassMask(noteList);
+        if (target === 0) return results;
+        const scaleMask = this.notesToPitchClassMask(scaleList);
+        const { entries, masks } = index;
+
+        for (let i = 0; i < masks.length; i++) {
+            const overlap = masks[i] & target;
+            if (requireAll ? overlap !== target : overlap === 0) continue;
+
+            const entry = entries[i];
+            let scaleMatchCount = 0;
+            for (const pc of entry.pcs) {
+                if (scaleMask & (1 << pc)) scaleMatchCount++;
             }
+            const scaleMatchPercent = Math.round((scaleMatchCount / entry.pcs.length) * 100);
 
-            return { functions: Array.from(funcs), resolutions: Array.from(res) };
-        }
-
-        this.chromaticNotes.forEach(root => {
-            Object.entries(this.chordFormulas).forEach(([chordType, formula]) => {
-                const chordNotes = this.getChordNotes(root, chordType);
-                const anyNoteContained = notes.some(note => chordNotes.includes(note));
-                if (!anyNoteContained) return;
-
-                const scaleMatchCount = chordNotes.filter(cn => scaleNotes.includes(cn)).length;
-                const scaleMatchPercent = Math.round((scaleMatchCount / chordNotes.length) * 100);
-
-                const roles = notes.map(note => {
-                    const noteValue = this.noteValues[note];
-                    const rootValue = this.noteValues[root];
-                    const interval = (noteValue - rootValue + 12) % 12;
+            const roles = noteList.map(note => {
+                const interval = (this.noteValues[note] - entry.rootValue + 12) % 12;
 
-                    let role = 'Extension';
-                    let roleClass = 'extension';
+                let role = 'Extension';
+                let roleClass = 'extension';
 
-                    if (interval === 0) { role = 'Root'; roleClass = 'root'; }
-                    else if (interval === 3 || interval === 4) { role = interval === 3 ? 'Minor 3rd' : 'Major 3rd'; roleClass = 'third'; }
-                    else if (interval === 6 || interval === 7) { role = interval === 6 ? 'Dim 5th' : 'Perfect 5th'; roleClass = 'fifth'; }
-                    else if (interval === 10 || interval === 11) { role = interval === 10 ? 'Minor 7th' : 'Major 7th'; roleClass = 'seventh'; }
-                    else if (interval === 2 || interval === 9) { role = interval === 2 ? 'Major 9th' : 'Major 2nd'; roleClass = 'ninth'; }
-                    else if (interval === 5 || interval === 8) { role = interval === 5 ? 'Perfect 4th' : 'Aug 5th'; roleClass = 'eleventh'; }
+                if (interval === 0) { role = 'Root'; roleClass = 'root'; }
+                else if (interval === 3 || interval === 4) { role = interval === 3 ? 'Minor 3rd' : 'Major 3rd'; roleClass = 'third'; }
+                else if (interval === 6 || interval === 7) { role = interval === 6 ? 'Dim 5th' : 'Perfect 5th'; roleClass = 'fifth'; }
+                else if (interval === 10 || interval === 11) { role = interval === 10 ? 'Minor 7th' : 'Major 7th'; roleClass = 'seventh'; }
+                else if (interval === 2 || interval === 9) { role = interval === 2 ? 'Major 9th' : 'Major 2nd'; roleClass = 'ninth'; }
+                else if (interval === 5 || interval === 8) { role = interval === 5 ? 'Perfect 4th' : 'Aug 5th'; roleClass = 'eleventh'; }
 
-                    return { note, interval, role, class: roleClass };
-                });
+                return { note, interval, role, class: roleClass };
+            });
 
-                const functions = computeFunctions(root, chordType, key);
-                const complexity = this.getChordComplexity(chordType);
+            let functions = { functions: [], resolutions: [] };
+            if (key) {
+                const slot = keyVal === undefined ? 12 : (entry.rootValue - keyVal + 12) % 12;
+                functions = entry.functionTable[slot];
+            }
 
-                results.push({
-                    fullName: root + chordType,
-                    root,
-                    chordType,
-                    chordNotes,
-                    roles,
-                    scaleMatchPercent,
-                    functions: functions.functions,
-                    resolutions: functions.resolutions,
-                    complexity,
-                    likelihood: scaleMatchPercent === 100 ? 'Perfect' : scaleMatchPercent >= 75 ? 'Excellent' : scaleMatchPercent >= 50 ? 'Good' : 'Fair'
-                });
+            results.push({
+                fullName: entry.fullName,
+                root: entry.root,
+                chordType: entry.chordType,
+                chordNotes: entry.chordNotes.slice(),
+                roles,
+                scaleMatchPercent,
+                functions: functions.functions.slice(),
+                resolutions: functions.resolutions.slice(),
+                complexity: entry.complexity,
+                likelihood: scaleMatchPercent === 100 ? 'Perfect' : scaleMatchPercent >= 75 ? 'Excellent' : scaleMatchPercent >= 50 ? 'Good' : 'Fair'
             });
-        });
-
-        // Sort by scale match percentage, then by function importance
-        return results.sort((a, b) => {
-            const funcScore = (chord) => {
-                const funcOrder = ['Tonic', 'Dominant', 'Predominant', 'Secondary Dominant', 'Leading-tone', 'Tritone Sub'];
-                const aIdx = funcOrder.findIndex(f => chord.functions.includes(f));
-                const bIdx = funcOrder.findIndex(f => chord.functions.includes(f));
-                if (aIdx !== bIdx) return aIdx - bIdx;
-                return b.scaleMatchPercent - a.scaleMatchPercent;
-            };
+        }
 
-            const cmpFunc = funcScore(a) - funcScore(b);
-            if (cmpFunc !== 0) return cmpFunc;
-            return a.chordNotes.length - b.chordNotes.length;
-        });
+        // Results are already ordered by chord size (fewest notes first) via the index.
+        return results;
     }
 
     /**
@@ -1198,6 +1373,7 @@ class MusicTheoryEngine {
         if (oldMode === mode) return true; // No change needed
 
         this.gradingMode = mode;
+        this.invalidateGradingCache();
         
         // Create grading change event
         const event = {
@@ -1205,6 +1381,7 @@ class MusicTheoryEngine {
             data: {
                 oldMode: oldMode,
                 newMode: mode,
+                mode: mode,
                 timestamp: Date.now(),
                 options: options
             },
@@ -1281,6 +1458,11 @@ class MusicTheoryEngine {
         // Add to event queue for tracking
         this.gradingEventQueue.push(event);
 
+        // Attach the precomputed grading state so subscribers don't regrade on their own
+        if (event.data && typeof event.data === 'object' && !Array.isArray(event.data) && !event.data.grading) {
+            event.data.grading = this.getGradingSnapshot();
+        }
+
         // Notify all active subscribers synchronously for immediate propagation
         for (const subscription of this.listeners) {
             if (!subscription.active) continue;
@@ -1515,6 +1697,15 @@ class MusicTheoryEngine {
     }
 
     getGradingTierInfo(tier, context = {}) {
+        // Only relevance is context-dependent; the common no-context call is cached per mode
+        if (context.relevance === undefined && this._memoTables) {
+            return this._memoize('gradeTierInfo', `${this.gradingMode}|${tier}`,
+                () => Object.freeze(this._computeGradingTierInfo(tier, context)));
+        }
+        return this._computeGradingTierInfo(tier, context);
+    }
+
+    _computeGradingTierInfo(tier, context = {}) {
         const type = this.gradingMode;
         let tierInfo;
 
@@ -1567,6 +1758,21 @@ class MusicTheoryEngine {
      */
     calculateElementGrade(element, context = {}) {
         const { key = 'C', scaleType = 'major', elementType = 'note' } = context;
+        if (typeof element !== 'string' || !this._memoTables) return this._computeElementGrade(element, context);
+        return this._memoize('grade', `${this.gradingMode}|${elementType}|${key}|${scaleType}|${element}`,
+            () => this._computeElementGrade(element, context));
+    }
+
+    /**
+     * Tier plus tier info for an element, from the grading cache
+     */
+    getElementGrading(element, context = {}) {
+        const tier = this.calculateElementGrade(element, context);
+        return { tier, info: this.getGradingTierInfo(tier) };
+    }
+
+    _computeElementGrade(element, context = {}) {
+        const { key = 'C', scaleType = 'major', elementType = 'note' } = context;
         
         if (elementType === 'note') {
             return this.calculateNoteGrade(element, key, scaleType, context);
@@ -2010,6 +2216,9 @@ class MusicTheoryEngine {
 
 }
 
+// Memo tables holding mode-dependent grading results
+MusicTheoryEngine.GRADING_TABLES = ['grade', 'gradeTierInfo'];
+
 // Export for module usage
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = MusicTheoryEngine;
@@ -4,7 +4,7 @@
  * @exports class NumberGenerator
  * @feature Multiple number types (Diatonic, Barry Harris, Extended, Chromatic)
  * @feature Mathematical transformations (retrograde, invert, rotate, randomize)
- * @feature History management with undo/redo
+ * @feature History management with undo/redo (capped, delta-encoded rings; persisted on idle)
  * @feature Event system for number changes
  */
 
@@ -27,9 +27,9 @@ class NumberGenerator {
         this.state = {
             currentNumbers: [1, 2, 3, 4, 5, 6, 7], // Default scale sequence
             numberType: this.options.defaultType,
-            history: [],
-            undoStack: [],
-            redoStack: [],
+            history: new DeltaHistory(this.options.maxHistorySize),   // oldest first; getHistory() is newest first
+            undoStack: new DeltaHistory(this.options.maxHistorySize),
+            redoStack: new DeltaHistory(this.options.maxHistorySize),
             desiredLength: this.options.defaultLength,
             generationLogic: 'random', // random, melodic, harmonic, chord_tones, functional
             harmonizationMode: 'root', // 'melody' | 'harmony' | 'root' (default: root = Numbers as Root)
@@ -56,7 +56,16 @@ class NumberGenerator {
     }
 
     initialize() {
+        this._historyDirty = false;
+        this._historySaveScheduled = false;
         this.loadHistory();
+        if (typeof document !== 'undefined' && typeof window !== 'undefined') {
+            // Persist pending history before the page is hidden or unloaded
+            document.addEventListener('visibilitychange', () => {
+                if (document.visibilityState === 'hidden') this.flushHistory();
+            });
+            window.addEventListener('pagehide', () => this.flushHistory());
+        }
     }
 
     /**
@@ -391,7 +400,7 @@ class NumberGenerator {
         this.state.currentNumbers = [...numbers];
         this.state.numberType = type;
         // Any new committed change should clear redo history
-        this.state.redoStack = [];
+        this.state.redoStack.clear();
 
         this.emit('numbersChanged', {
             numbers: this.state.currentNumbers,
@@ -459,7 +468,7 @@ class NumberGenerator {
     clearNumbers() {
         this.saveToHistory();
         this.state.currentNumbers = [];
-        this.state.redoStack = [];
+        this.state.redoStack.clear();
         this.emit('numbersChanged', {
             numbers: [],
             type: this.state.numberType,
@@ -617,17 +626,12 @@ class NumberGenerator {
         if (this.state.undoStack.length === 0) return false;
 
         const previousState = this.state.undoStack.pop();
+        const current = this._historyRecord();
         // push current to redo stack
-        this.state.redoStack.push({
-            numbers: [...this.state.currentNumbers],
-            type: this.state.numberType
-        });
+        this.state.redoStack.push(current);
         // keep a breadcrumb in history
-        this.state.history.push({
-            numbers: [...this.state.currentNumbers],
-            type: this.state.numberType,
-            timestamp: Date.now()
-        });
+        this.state.history.push(current);
+        this.saveHistory();
 
         this.state.currentNumbers = previousState.numbers;
         this.state.numberType = previousState.type;
@@ -648,10 +652,7 @@ class NumberGenerator {
         if (this.state.redoStack.length === 0) return false;
         const nextState = this.state.redoStack.pop();
         // push current to undo stack for symmetry
-        this.state.undoStack.push({
-            numbers: [...this.state.currentNumbers],
-            type: this.state.numberType
-        });
+        this.state.undoStack.push(this._historyRecord());
 
         this.state.currentNumbers = nextState.numbers;
         this.state.numberType = nextState.type;
@@ -665,52 +666,50 @@ class NumberGenerator {
     }
 
     /**
-     * Get history
+     * Get history (newest first)
      */
     getHistory() {
-        return [...this.state.history];
+        return this.state.history.toArray().reverse();
     }
 
     /**
-     * Load specific numbers from history
+     * Load specific numbers from history (0 = newest)
      */
     loadFromHistory(index) {
-        const history = this.getHistory();
+        const history = this.state.history;
         if (index < 0 || index >= history.length) return false;
 
-        const entry = history[index];
+        const entry = history.get(history.length - 1 - index);
         this.setNumbers(entry.numbers, entry.type);
         return true;
     }
 
+    _historyRecord() {
+        return {
+            numbers: [...this.state.currentNumbers],
+            type: this.state.numberType,
+            timestamp: Date.now()
+        };
+    }
+
     /**
      * Save current state to history
      */
     saveToHistory() {
-        this.state.undoStack.push({
-            numbers: [...this.state.currentNumbers],
-            type: this.state.numberType
-        });
-
-        this.state.history.unshift({
-            numbers: [...this.state.currentNumbers],
-            type: this.state.numberType,
-            timestamp: Date.now()
-        });
+        const record = this._historyRecord();
+        // Transformations save before calling setNumbers, which saves again; skip the repeat
+        // so one undo steps back one edit
+        const last = this.state.undoStack.peekLast();
+        const unchanged = last && last.type === record.type && DeltaHistory.diff(last.numbers, record.numbers).length === 0
+            && last.numbers.length === record.numbers.length;
+        if (!unchanged) {
+            this.state.undoStack.push(record);
+            this.state.history.push(record);
+        }
 
         // Any new action invalidates redo path
-        this.state.redoStack = [];
-
-        // Limit history size
-        if (this.state.history.length > this.options.maxHistorySize) {
-            this.state.history = this.state.history.slice(0, this.options.maxHistorySize);
-        }
-        if (this.state.undoStack.length > this.options.maxHistorySize) {
-            this.state.undoStack = this.state.undoStack.slice(-this.options.maxHistorySize);
-        }
-        if (this.state.redoStack.length > this.options.maxHistorySize) {
-            this.state.redoStack = this.state.redoStack.slice(-this.options.maxHistorySize);
-        }
+        this.state.redoStack.clear();
+        // Size limits are enforced by the rings
     }
 
     /**
@@ -721,7 +720,7 @@ class NumberGenerator {
             try {
                 const stored = localStorage.getItem('music_numbers_history');
                 if (stored) {
-                    this.state.history = JSON.parse(stored);
+                    this.state.history = this._historyFromStored(JSON.parse(stored));
                 }
             } catch (error) {
                 console.warn('Failed to load history:', error);
@@ -729,10 +728,38 @@ class NumberGenerator {
         }
     }
 
+    _historyFromStored(data) {
+        const size = this.options.maxHistorySize;
+        // Older sessions stored a plain newest-first array of { numbers, type, timestamp }
+        if (Array.isArray(data)) return DeltaHistory.fromArray(data.slice(0, size).reverse(), size);
+        return DeltaHistory.fromJSON(data, size);
+    }
+
     /**
-     * Save history to storage
+     * Save history to storage. Writes are deferred to an idle slot (or page hide)
+     * so edits never pay for serialization.
      */
     saveHistory() {
+        this._historyDirty = true;
+        if (this._historySaveScheduled) return;
+        this._historySaveScheduled = true;
+        const run = () => {
+            this._historySaveScheduled = false;
+            this.flushHistory();
+        };
+        if (typeof requestIdleCallback === 'function') {
+            requestIdleCallback(run, { timeout: 2000 });
+        } else {
+            setTimeout(run, 1000);
+        }
+    }
+
+    /**
+     * Write pending history to storage now
+     */
+    flushHistory() {
+        if (!this._historyDirty) return;
+        this._historyDirty = false;
         if (typeof localStorage !== 'undefined') {
             try {
                 localStorage.setItem('music_numbers_history', JSON.stringify(this.state.history));
@@ -762,7 +789,7 @@ class NumberGenerator {
             this.setNumbers(state.numbers, state.type || this.state.numberType);
         }
         if (state.history && Array.isArray(state.history)) {
-            this.state.history = state.history;
+            this.state.history = this._historyFromStored(state.history);
             this.saveHistory();
         }
     }
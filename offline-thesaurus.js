@@ -67,6 +67,10 @@
             }
             return null;
         },
+        // [word, archetype] pairs, for building a combined lexicon index
+        entries: function() {
+            return wordMap.entries();
+        },
         size: wordMap.size
     };
     
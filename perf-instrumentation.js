@@ -0,0 +1,427 @@
+/**
+ * @module PerfInstrumentation
+ * @description Opt-in timing layer: module renders, event fan-out, engine hot functions and long tasks
+ * @exports class PerfInstrumentation
+ * @feature Wraps registered methods with performance.measure once enabled; nothing is wrapped until then
+ * @feature Groups emitted events and renders under the user action (pointer/key/change) that caused them
+ * @feature Toggleable overlay (Ctrl+Shift+P, ?perf or localStorage 'perf-overlay') with per-module ms and cache hit rates
+ * @feature exportTrace() returns Chrome trace-event JSON (chrome://tracing, Perfetto, DevTools "Load profile")
+ */
+
+class PerfInstrumentation {
+    constructor(options = {}) {
+        this.enabled = false;
+        this.bufferLimit = options.bufferLimit || 5000;
+        this.targets = [];          // { label, object, method, kind } registered for wrapping
+        this.wrapped = false;
+        this.cacheSources = new Map(); // name -> () => { hits, misses } | { hitRate }
+        this.events = [];           // trace events (ring, oldest dropped past bufferLimit)
+        this.eventHead = 0;         // index of the oldest event once the ring is full
+        this.measureNames = new Set(); // user-timing measure names this instance created
+        this.stats = new Map();     // label -> { kind, calls, totalMs, maxMs, lastMs }
+        this.actions = [];          // recent user actions { type, target, t, events, renders, ms }
+        this.currentAction = null;
+        this.longTasks = { count: 0, totalMs: 0, maxMs: 0 };
+        this.renderDepth = 0;       // nested renders count once toward an action
+        this.userTiming = typeof performance !== 'undefined' && typeof performance.measure === 'function';
+        this.overlay = null;
+        this.overlayTimer = null;
+        this.observer = null;
+        this._onAction = this._onAction.bind(this);
+        this._onKey = this._onKey.bind(this);
+        this.origin = PerfInstrumentation.now();
+    }
+
+    static now() {
+        return (typeof performance !== 'undefined' && performance.now) ? performance.now() : Date.now();
+    }
+
+    /**
+     * Instance configured from the page: enabled by ?perf or localStorage 'perf-overlay' = '1'
+     */
+    static fromEnvironment(options = {}) {
+        const perf = new PerfInstrumentation(options);
+        let wanted = false;
+        try {
+            wanted = /[?&]perf(=1|&|$)/.test(window.location.search) || window.localStorage.getItem('perf-overlay') === '1';
+        } catch (_) {}
+        if (typeof document !== 'undefined') document.addEventListener('keydown', perf._onKey);
+        if (wanted) perf.enable({ overlay: true });
+        return perf;
+    }
+
+    // --- Registration (cheap; wrapping happens on first enable) ---
+
+    /**
+     * Time a module's render() and count its emit() fan-out
+     */
+    instrumentModule(name, module, options = {}) {
+        if (!module) return this;
+        const renders = options.render || ['render'];
+        renders.forEach(method => this._register(`${name}.${method}`, module, method, 'render'));
+        // emit: false for modules without an emitter; engines name their broadcast method instead
+        if (options.emit !== false) this._register(`${name}.emit`, module, options.emit || 'emit', 'emit');
+        return this;
+    }
+
+    /**
+     * Time named engine functions (e.g. findAllContainerChords)
+     */
+    instrumentFunctions(name, object, methods) {
+        if (!object) return this;
+        methods.forEach(method => this._register(`${name}.${method}`, object, method, 'function'));
+        return this;
+    }
+
+    registerCacheSource(name, read) {
+        if (typeof read === 'function') this.cacheSources.set(name, read);
+        return this;
+    }
+
+    _register(label, object, method, kind) {
+        if (typeof object[method] !== 'function') return;
+        const target = { label, object, method, kind, original: null };
+        this.targets.push(target);
+        if (this.wrapped) this._wrap(target);
+    }
+
+    // --- Enable / disable ---
+
+    enable({ overlay = false } = {}) {
+        if (!this.wrapped) {
+            this.targets.forEach(target => this._wrap(target));
+            this.wrapped = true;
+        }
+        this.enabled = true;
+        this._observeLongTasks();
+        if (typeof document !== 'undefined') {
+            PerfInstrumentation.ACTION_EVENTS.forEach(type => document.addEventListener(type, this._onAction, true));
+        }
+        if (overlay) this.showOverlay();
+        return this;
+    }
+
+    disable() {
+        this.enabled = false;
+        if (this.observer) {
+            try { this.observer.disconnect(); } catch (_) {}
+            this.observer = null;
+        }
+        if (typeof document !== 'undefined') {
+            PerfInstrumentation.ACTION_EVENTS.forEach(type => document.removeEventListener(type, this._onAction, true));
+        }
+        this.hideOverlay();
+        return this;
+    }
+
+    toggle() {
+        if (this.enabled && this.overlay) {
+            this.disable();
+        } else {
+            this.enable({ overlay: true });
+        }
+        try { window.localStorage.setItem('perf-overlay', this.enabled ? '1' : '0'); } catch (_) {}
+        return this.enabled;
+    }
+
+    reset() {
+        this.events = [];
+        this.eventHead = 0;
+        this.stats.clear();
+        this.actions = [];
+        this.currentAction = null;
+        this.longTasks = { count: 0, totalMs: 0, maxMs: 0 };
+        this.origin = PerfInstrumentation.now();
+        this._renderOverlay();
+    }
+
+    _wrap(target) {
+        const perf = this;
+        const original = target.object[target.method];
+        target.original = original;
+        const { label, kind } = target;
+        target.object[target.method] = function instrumented(...args) {
+            if (!perf.enabled) return original.apply(this, args);
+            const detail = kind === 'emit' ? { event: String(args[0] && args[0].type ? args[0].type : args[0]) } : null;
+            const start = PerfInstrumentation.now();
+            if (kind === 'render') perf.renderDepth++;
+            try {
+                return original.apply(this, args);
+            } finally {
+                if (kind === 'render') perf.renderDepth--;
+                perf._record(label, kind, start, PerfInstrumentation.now(), detail);
+            }
+        };
+    }
+
+    // --- Recording ---
+
+    _record(label, kind, start, end, detail) {
+        const ms = end - start;
+        let stat = this.stats.get(label);
+        if (!stat) {
+            stat = { kind, calls: 0, totalMs: 0, maxMs: 0, lastMs: 0 };
+            this.stats.set(label, stat);
+        }
+        stat.calls++;
+        stat.totalMs += ms;
+        stat.lastMs = ms;
+        if (ms > stat.maxMs) stat.maxMs = ms;
+
+        const name = detail && detail.event ? `${label}:${detail.event}` : label;
+        this._push({ name, cat: kind, ph: 'X', ts: start, dur: ms, args: detail || undefined });
+        this._userTiming(name, start, end, detail);
+
+        const action = this.currentAction;
+        if (action && start - action.t < PerfInstrumentation.ACTION_WINDOW_MS) {
+            if (kind === 'emit') action.events++;
+            else if (kind === 'render' && this.renderDepth === 0) action.renders++;
+            action.ms = Math.max(action.ms, end - action.t);
+        }
+    }
+
+    _userTiming(name, start, end, detail) {
+        if (!this.userTiming) return;
+        try {
+            performance.measure(name, { start, end, detail });
+            this.measureNames.add(name);
+        } catch (_) {
+            // User Timing without start/end options (older browsers): keep our own timeline only
+            this.userTiming = false;
+        }
+    }
+
+    _push(event) {
+        if (this.events.length < this.bufferLimit) {
+            this.events.push(event);
+            return;
+        }
+        // Full: overwrite the oldest slot instead of shifting the whole buffer
+        this.events[this.eventHead] = event;
+        this.eventHead = (this.eventHead + 1) % this.bufferLimit;
+        // Once per lap, keep the browser's user-timing buffer from growing alongside ours
+        if (this.eventHead === 0) this._clearOwnMeasures();
+    }
+
+    /**
+     * Clear only the measures this instance created; other code's entries are left alone
+     */
+    _clearOwnMeasures() {
+        if (typeof performance === 'undefined' || typeof performance.clearMeasures !== 'function') return;
+        this.measureNames.forEach(name => {
+            try { performance.clearMeasures(name); } catch (_) {}
+        });
+        this.measureNames.clear();
+    }
+
+    /**
+     * Buffered events, oldest first
+     */
+    _orderedEvents() {
+        if (this.eventHead === 0) return this.events;
+        return this.events.slice(this.eventHead).concat(this.events.slice(0, this.eventHead));
+    }
+
+    _onAction(e) {
+        if (!this.enabled) return;
+        if (this.overlay && this.overlay.contains(e.target)) return;
+        const t = PerfInstrumentation.now();
+        const el = e.target || {};
+        const target = el.id ? `#${el.id}` : (el.className && typeof el.className === 'string' ? `.${el.className.split(/\s+/)[0]}` : (el.tagName || '').toLowerCase());
+        this.currentAction = { type: e.type, target, t, events: 0, renders: 0, ms: 0 };
+        this.actions.push(this.currentAction);
+        if (this.actions.length > PerfInstrumentation.ACTION_HISTORY) this.actions.shift();
+        this._push({ name: `${e.type} ${target}`, cat: 'action', ph: 'i', s: 'g', ts: t });
+    }
+
+    _onKey(e) {
+        if (e.ctrlKey && e.shiftKey && (e.key === 'P' || e.key === 'p')) {
+            e.preventDefault();
+            this.toggle();
+        }
+    }
+
+    _observeLongTasks() {
+        if (this.observer || typeof PerformanceObserver === 'undefined') return;
+        try {
+            this.observer = new PerformanceObserver(list => {
+                list.getEntries().forEach(entry => {
+                    this.longTasks.count++;
+                    this.longTasks.totalMs += entry.duration;
+                    if (entry.duration > this.longTasks.maxMs) this.longTasks.maxMs = entry.duration;
+                    this._push({ name: 'longtask', cat: 'longtask', ph: 'X', ts: entry.startTime, dur: entry.duration,
+                        args: { attribution: (entry.attribution || []).map(a => a.name).join(',') || 'unknown' } });
+                });
+            });
+            this.observer.observe({ type: 'longtask', buffered: true });
+        } catch (e) {
+            console.warn('[PerfInstrumentation] Long task observer unavailable:', e);
+            this.observer = null;
+        }
+    }
+
+    // --- Reporting ---
+
+    /**
+     * Snapshot for the overlay and for callers: per-label stats, action fan-out, long tasks, cache rates
+     */
+    getReport() {
+        const rows = Array.from(this.stats.entries()).map(([label, s]) => ({
+            label, kind: s.kind, calls: s.calls, avgMs: s.totalMs / s.calls, maxMs: s.maxMs, lastMs: s.lastMs, totalMs: s.totalMs
+        }));
+        const finished = this.actions.filter(a => a !== this.currentAction || PerfInstrumentation.now() - a.t > PerfInstrumentation.ACTION_WINDOW_MS);
+        const avg = (list, field) => list.length ? list.reduce((sum, a) => sum + a[field], 0) / list.length : 0;
+        return {
+            renders: rows.filter(r => r.kind === 'render').sort((a, b) => b.totalMs - a.totalMs),
+            functions: rows.filter(r => r.kind === 'function').sort((a, b) => b.totalMs - a.totalMs),
+            emits: rows.filter(r => r.kind === 'emit').sort((a, b) => b.calls - a.calls),
+            actions: {
+                count: this.actions.length,
+                last: this.actions[this.actions.length - 1] || null,
+                avgEvents: avg(finished, 'events'),
+                avgRenders: avg(finished, 'renders')
+            },
+            longTasks: { ...this.longTasks },
+            caches: this._readCaches()
+        };
+    }
+
+    _readCaches() {
+        const out = [];
+        this.cacheSources.forEach((read, name) => {
+            try {
+                const s = read() || {};
+                const total = (s.hits || 0) + (s.misses || 0);
+                const hitRate = typeof s.hitRate === 'number' ? s.hitRate : (total ? s.hits / total : 0);
+                out.push({ name, hitRate, hits: s.hits || 0, misses: s.misses || 0 });
+            } catch (_) {}
+        });
+        return out;
+    }
+
+    /**
+     * Chrome trace-event JSON ({ traceEvents }); timestamps in microseconds since enable/reset
+     */
+    exportTrace() {
+        const us = (ms) => Math.round((ms - this.origin) * 1000);
+        const traceEvents = [
+            { name: 'process_name', ph: 'M', pid: 1, tid: 0, args: { name: 'Music Theory Studio' } },
+            { name: 'thread_name', ph: 'M', pid: 1, tid: 1, args: { name: 'main' } }
+        ];
+        this._orderedEvents().forEach(e => {
+            if (e.ts < this.origin) return;
+            const out = { name: e.name, cat: e.cat, ph: e.ph, pid: 1, tid: 1, ts: us(e.ts) };
+            if (e.ph === 'X') out.dur = Math.max(1, Math.round(e.dur * 1000));
+            if (e.s) out.s = e.s;
+            if (e.args) out.args = e.args;
+            traceEvents.push(out);
+        });
+        return {
+            traceEvents,
+            displayTimeUnit: 'ms',
+            metadata: { exportedAt: new Date().toISOString(), userAgent: typeof navigator !== 'undefined' ? navigator.userAgent : 'node', report: this.getReport() }
+        };
+    }
+
+    downloadTrace(filename = `music-theory-trace-${Date.now()}.json`) {
+        const blob = new Blob([JSON.stringify(this.exportTrace())], { type: 'application/json' });
+        const url = URL.createObjectURL(blob);
+        const a = document.createElement('a');
+        a.href = url;
+        a.download = filename;
+        document.body.appendChild(a);
+        a.click();
+        a.remove();
+        setTimeout(() => URL.revokeObjectURL(url), 1000);
+    }
+
+    // --- Overlay ---
+
+    showOverlay() {
+        if (typeof document === 'undefined' || !document.body) return;
+        if (!this.overlay) {
+            const el = document.createElement('div');
+            el.id = 'perf-overlay';
+            el.style.cssText = `
+                position: fixed;
+                top: 12px;
+                right: 12px;
+                width: 340px;
+                max-height: 70vh;
+                overflow: auto;
+                background: rgba(10, 14, 22, 0.92);
+                color: #e2e8f0;
+                border: 1px solid rgba(0, 243, 255, 0.35);
+                border-radius: 8px;
+                padding: 10px 12px;
+                font-family: var(--font-tech, monospace);
+                font-size: 11px;
+                line-height: 1.45;
+                z-index: 10001;
+                box-shadow: 0 6px 18px rgba(0,0,0,0.45);
+            `;
+            el.addEventListener('click', (e) => {
+                const action = e.target && e.target.dataset ? e.target.dataset.perfAction : null;
+                if (action === 'export') this.downloadTrace();
+                else if (action === 'reset') this.reset();
+                else if (action === 'close') this.toggle();
+            });
+            this.overlay = el;
+        }
+        if (!this.overlay.parentNode) document.body.appendChild(this.overlay);
+        this._renderOverlay();
+        if (!this.overlayTimer) this.overlayTimer = setInterval(() => this._renderOverlay(), 500);
+    }
+
+    hideOverlay() {
+        if (this.overlayTimer) {
+            clearInterval(this.overlayTimer);
+            this.overlayTimer = null;
+        }
+        if (this.overlay && this.overlay.parentNode) this.overlay.parentNode.removeChild(this.overlay);
+        this.overlay = null;
+    }
+
+    _renderOverlay() {
+        if (!this.overlay || !this.overlay.parentNode) return;
+        const r = this.getReport();
+        const ms = (v) => `${v.toFixed(v < 10 ? 2 : 1)}ms`;
+        const esc = (s) => String(s).replace(/[&<>"]/g, c => ({ '&': '&amp;', '<': '&lt;', '>': '&gt;', '"': '&quot;' }[c]));
+        const table = (rows, cols) => rows.length
+            ? `<table style="width:100%;border-collapse:collapse;">${rows.map(row => `<tr>${cols.map((c, i) =>
+                `<td style="padding:1px 4px;${i ? 'text-align:right;' : 'max-width:150px;overflow:hidden;text-overflow:ellipsis;white-space:nowrap;'}">${c(row)}</td>`).join('')}</tr>`).join('')}</table>`
+            : '<div style="opacity:0.6;">none yet</div>';
+        const section = (title) => `<div style="margin:8px 0 3px;color:#00f3ff;text-transform:uppercase;letter-spacing:0.05em;">${title}</div>`;
+        const last = r.actions.last;
+        const button = (action, text) => `<button data-perf-action="${action}" style="background:rgba(0,243,255,0.12);color:#e2e8f0;border:1px solid rgba(0,243,255,0.35);border-radius:4px;padding:2px 8px;font:inherit;cursor:pointer;">${text}</button>`;
+
+        this.overlay.innerHTML = `
+            <div style="display:flex;justify-content:space-between;align-items:center;gap:6px;">
+                <strong>Performance</strong>
+                <span>${button('export', 'Export trace')} ${button('reset', 'Reset')} ${button('close', '×')}</span>
+            </div>
+            ${section('Renders (avg / max / calls)')}
+            ${table(r.renders.slice(0, 12), [x => esc(x.label.replace(/\.render$/, '')), x => ms(x.avgMs), x => ms(x.maxMs), x => x.calls])}
+            ${section('User actions')}
+            <div>${r.actions.count} actions · avg ${r.actions.avgEvents.toFixed(1)} events, ${r.actions.avgRenders.toFixed(1)} renders each</div>
+            ${last ? `<div style="opacity:0.8;">last: ${esc(last.type)} ${esc(last.target)} → ${last.events} events, ${last.renders} renders, ${ms(last.ms)}</div>` : ''}
+            ${section('Engine functions (avg / max / calls)')}
+            ${table(r.functions.slice(0, 10), [x => esc(x.label), x => ms(x.avgMs), x => ms(x.maxMs), x => x.calls])}
+            ${section('Events emitted')}
+            ${table(r.emits.slice(0, 8), [x => esc(x.label.replace(/\.emit$/, '')), x => x.calls, x => ms(x.totalMs)])}
+            ${section('Caches')}
+            ${table(r.caches, [x => esc(x.name), x => `${(x.hitRate * 100).toFixed(1)}%`, x => `${x.hits}/${x.hits + x.misses}`])}
+            ${section('Long tasks')}
+            <div>${r.longTasks.count} tasks · ${ms(r.longTasks.totalMs)} total · max ${ms(r.longTasks.maxMs)}</div>
+        `;
+    }
+}
+
+PerfInstrumentation.ACTION_EVENTS = ['pointerdown', 'keydown', 'change'];
+PerfInstrumentation.ACTION_WINDOW_MS = 1000; // work started this long after an action is attributed to it
+PerfInstrumentation.ACTION_HISTORY = 50;
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = PerfInstrumentation;
+}
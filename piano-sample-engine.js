@@ -2,15 +2,23 @@
  * PianoSampleEngine - High-quality sampled piano audio engine
  * Uses Salamander Grand Piano samples from the Web Audio API
  * Provides realistic piano sounds for music theory applications
+ * Voices come from a fixed-size VoicePool (polyphony cap, stealing, active/stolen stats)
  */
 class PianoSampleEngine {
-    constructor() {
+    constructor(options = {}) {
         this.ctx = null;
         this.masterGain = null;
         this.samples = new Map();
         this.loading = false;
-        this.loaded = false;
+        this.loaded = false; // true once any sample is playable
+        this.fullyLoaded = false;
+        this.loadedSampleNotes = []; // sorted subset of sampleNotes that have decoded
+        this.focusMidi = options.focusMidi || 60; // sample loading starts nearest this note
+        this.loadConcurrency = options.loadConcurrency || 4;
         this.activeVoices = new Map(); // Track active oscillators/sources for note-off
+        this.transport = null; // Lookahead AudioTransport for sequences (created on first use)
+        this.voicePool = null; // Pooled voice slots (created on first note)
+        this.polyphony = options.polyphony || 24; // synthesized voices use 5 oscillators each
         
         // Sample configuration - we'll sample every 3rd note for efficiency
         // and use pitch shifting for notes in between
@@ -67,32 +75,35 @@ class PianoSampleEngine {
         }
         
         try {
-            // Try to load Salamander samples from Tone.js CDN
-            const promises = this.sampleNotes.map(async midi => {
-                try {
-                    const note = this.midiToNoteName(midi);
-                    const url = `${this.sampleBaseUrl}${note}.mp3`;
-                    const response = await fetch(url);
-                    const arrayBuffer = await response.arrayBuffer();
-                    const audioBuffer = await this.ctx.decodeAudioData(arrayBuffer);
-                    this.samples.set(midi, audioBuffer);
-                    return true;
-                } catch (error) {
-                    console.warn(`Failed to load sample for MIDI ${midi}:`, error.message);
-                    return false;
+            // Nearest-to-visible-range first, a few at a time; each sample is
+            // playable as soon as it decodes (findClosestSample fills the gaps)
+            const queue = this.sampleNotes.slice().sort((x, y) => Math.abs(x - this.focusMidi) - Math.abs(y - this.focusMidi));
+            const cache = await this._openSampleCache();
+            let successCount = 0;
+
+            const worker = async () => {
+                while (queue.length) {
+                    const midi = queue.shift();
+                    try {
+                        const note = this.midiToNoteName(midi);
+                        const url = `${this.sampleBaseUrl}${note}.mp3`;
+                        const arrayBuffer = await this._fetchSample(url, cache);
+                        const audioBuffer = await this.ctx.decodeAudioData(arrayBuffer);
+                        this._addSample(midi, audioBuffer);
+                        successCount++;
+                    } catch (error) {
+                        console.warn(`Failed to load sample for MIDI ${midi}:`, error.message);
+                    }
                 }
-            });
-            
-            const results = await Promise.allSettled(promises);
-            const successCount = results.filter(r => r.status === 'fulfilled' && r.value).length;
+            };
+            await Promise.all(Array.from({ length: Math.min(this.loadConcurrency, queue.length) }, worker));
             
             console.log(`Loaded ${successCount}/${this.sampleNotes.length} piano samples`);
             
-            if (successCount > 0) {
-                this.loaded = true;
-            } else {
+            if (successCount === 0) {
                 console.warn('Failed to load piano samples, falling back to synthesized sound');
             }
+            this.fullyLoaded = successCount === this.sampleNotes.length;
         } catch (error) {
             console.error('Error loading piano samples:', error);
         } finally {
@@ -100,6 +111,50 @@ class PianoSampleEngine {
         }
     }
 
+    /**
+     * Bias sample loading toward the visible keyboard range (call before the first note)
+     */
+    setPreferredRange(startMidi, endMidi) {
+        if (typeof startMidi !== 'number') return;
+        const end = typeof endMidi === 'number' ? endMidi : startMidi;
+        this.focusMidi = Math.round((startMidi + end) / 2);
+    }
+
+    /**
+     * Encoded samples are kept in Cache Storage so repeat visits skip the CDN
+     */
+    async _openSampleCache() {
+        try {
+            if (typeof caches === 'undefined') return null;
+            return await caches.open(PianoSampleEngine.SAMPLE_CACHE);
+        } catch (_) {
+            return null; // opaque origins / private browsing
+        }
+    }
+
+    async _fetchSample(url, cache) {
+        if (cache) {
+            const hit = await cache.match(url);
+            if (hit) return hit.arrayBuffer();
+        }
+        const response = await fetch(url);
+        if (!response.ok) throw new Error(`HTTP ${response.status}`);
+        if (cache) {
+            try { await cache.put(url, response.clone()); } catch (_) { /* quota */ }
+        }
+        return response.arrayBuffer();
+    }
+
+    _addSample(midi, audioBuffer) {
+        this.samples.set(midi, audioBuffer);
+        // Keep the loaded set sorted for findClosestSample
+        const loaded = this.loadedSampleNotes;
+        let i = loaded.length;
+        while (i > 0 && loaded[i - 1] > midi) i--;
+        loaded.splice(i, 0, midi);
+        this.loaded = true;
+    }
+
     resume() {
         if (!this.ctx) this.init();
         if (this.ctx.state === 'suspended') {
@@ -111,10 +166,12 @@ class PianoSampleEngine {
      * Find the closest sampled note for a given MIDI number
      */
     findClosestSample(midi) {
-        let closest = this.sampleNotes[0];
+        // Only consider samples that have decoded; early in loading this may be a handful
+        const candidates = this.loadedSampleNotes.length ? this.loadedSampleNotes : this.sampleNotes;
+        let closest = candidates[0];
         let minDist = Math.abs(midi - closest);
         
-        for (const sampleMidi of this.sampleNotes) {
+        for (const sampleMidi of candidates) {
             const dist = Math.abs(midi - sampleMidi);
             if (dist < minDist) {
                 minDist = dist;
@@ -136,12 +193,12 @@ class PianoSampleEngine {
         
         if (!buffer) {
             // Fallback to synthesized sound if sample not loaded
-            this.playNoteSynthesized(midi, duration, time, velocity);
-            return;
+            return this.playNoteSynthesized(midi, duration, time, velocity);
         }
         
+        const { slot, start } = this._acquireSlot(midi, velocity, this.ctx.currentTime + time);
         const source = this.ctx.createBufferSource();
-        const gainNode = this.ctx.createGain();
+        const gainNode = slot.nodes.voiceGain;
         
         source.buffer = buffer;
         
@@ -150,9 +207,8 @@ class PianoSampleEngine {
         source.playbackRate.value = Math.pow(2, semitoneShift / 12);
         
         source.connect(gainNode);
-        gainNode.connect(this.masterGain);
         
-        const now = this.ctx.currentTime + time;
+        const now = start;
         
         // Apply velocity
         const initialGain = velocity * 0.8;
@@ -171,28 +227,12 @@ class PianoSampleEngine {
         source.start(now);
         source.stop(now + duration + 0.5);
         
-        // Track active voice for note-off
-        const voiceKey = `${midi}`;
-        if (!this.activeVoices.has(voiceKey)) {
-            this.activeVoices.set(voiceKey, []);
-        }
-        this.activeVoices.get(voiceKey).push({
+        return this._trackVoice(slot, {
             source,
             gainNode,
             startTime: now,
             midi
         });
-        
-        // Clean up after note ends
-        source.onended = () => {
-            const voices = this.activeVoices.get(voiceKey);
-            if (voices) {
-                const index = voices.findIndex(v => v.source === source);
-                if (index > -1) {
-                    voices.splice(index, 1);
-                }
-            }
-        };
     }
 
     /**
@@ -203,41 +243,29 @@ class PianoSampleEngine {
         this.resume();
         
         const frequency = 440 * Math.pow(2, (midi - 69) / 12);
-        const now = this.ctx.currentTime + time;
-        
-        // Create multiple oscillators for richer sound
-        const partials = [
-            { ratio: 1.0, gain: 1.0 },      // Fundamental
-            { ratio: 2.0, gain: 0.4 },      // 2nd harmonic
-            { ratio: 3.0, gain: 0.2 },      // 3rd harmonic
-            { ratio: 4.0, gain: 0.15 },     // 4th harmonic
-            { ratio: 5.0, gain: 0.1 }       // 5th harmonic
-        ];
-        
-        const masterGain = this.ctx.createGain();
-        masterGain.connect(this.masterGain);
+        const { slot, start } = this._acquireSlot(midi, velocity, this.ctx.currentTime + time);
+        const now = start;
+        const { voiceGain, partialGains, noiseGain } = slot.nodes;
         
-        const voiceKey = `${midi}`;
-        if (!this.activeVoices.has(voiceKey)) {
-            this.activeVoices.set(voiceKey, []);
-        }
+        // Voice gain carries note-off; partial gains carry the envelope
+        voiceGain.gain.setValueAtTime(1, now);
 
         const oscillators = [];
 
-        partials.forEach(({ ratio, gain: partialGain }) => {
+        PianoSampleEngine.SYNTH_PARTIALS.forEach(({ ratio, gain: partialGain }, i) => {
             const osc = this.ctx.createOscillator();
-            const oscGain = this.ctx.createGain();
+            const oscGain = partialGains[i];
             
             osc.type = 'sine';
             osc.frequency.value = frequency * ratio;
             
             osc.connect(oscGain);
-            oscGain.connect(masterGain);
             
             const gain = partialGain * velocity * 0.2;
             const sustainLevel = 0.3;
             const releaseTime = 0.15;
             
+            oscGain.gain.cancelScheduledValues(now);
             oscGain.gain.setValueAtTime(0, now);
             oscGain.gain.linearRampToValueAtTime(gain, now + 0.01);
             oscGain.gain.exponentialRampToValueAtTime(gain * sustainLevel, now + 0.1);
@@ -250,38 +278,164 @@ class PianoSampleEngine {
             osc.stop(now + duration + 0.5);
             oscillators.push(osc);
         });
+
+        // Add attack transient (percussive click); the noise buffer is built once
+        const noise = this.ctx.createBufferSource();
+        noise.buffer = this._getNoiseBuffer();
+        noise.connect(slot.nodes.noiseFilter);
         
-        // Store the master gain for this voice for manual termination
-        this.activeVoices.get(voiceKey).push({
+        noiseGain.gain.cancelScheduledValues(now);
+        noiseGain.gain.setValueAtTime(velocity * 0.3, now);
+        noiseGain.gain.exponentialRampToValueAtTime(0.001, now + 0.02);
+        
+        noise.start(now);
+
+        // Store the voice gain for manual termination
+        return this._trackVoice(slot, {
             source: oscillators[0], // Reference fundamental for tracking
             oscillators: oscillators,
-            gainNode: masterGain,
+            noise,
+            gainNode: voiceGain,
             startTime: now,
             midi
         });
+    }
 
-        // Add attack transient (percussive click)
-        const noise = this.ctx.createBufferSource();
-        const noiseBuffer = this.ctx.createBuffer(1, this.ctx.sampleRate * 0.05, this.ctx.sampleRate);
-        const noiseData = noiseBuffer.getChannelData(0);
-        for (let i = 0; i < noiseData.length; i++) {
-            noiseData[i] = (Math.random() * 2 - 1) * 0.1;
+    /**
+     * Lazily build the voice pool (null when voice-pool.js is not loaded)
+     */
+    getVoicePool() {
+        if (!this.voicePool && typeof VoicePool !== 'undefined' && this.ctx) {
+            this.voicePool = new VoicePool({
+                polyphony: this.polyphony,
+                now: () => this.ctx.currentTime,
+                createSlotNodes: () => this._createSlotNodes(),
+                silence: (slot, when) => this._silenceSlot(slot, when)
+            });
         }
-        noise.buffer = noiseBuffer;
-        
-        const noiseGain = this.ctx.createGain();
+        return this.voicePool;
+    }
+
+    /**
+     * Persistent per-slot graph: partial gains -> voice gain -> master, plus the
+     * click path noise -> highpass -> noise gain -> master
+     */
+    _createSlotNodes() {
+        const voiceGain = this.ctx.createGain();
+        voiceGain.gain.value = 0;
+        voiceGain.connect(this.masterGain);
+
+        const partialGains = PianoSampleEngine.SYNTH_PARTIALS.map(() => {
+            const g = this.ctx.createGain();
+            g.gain.value = 0;
+            g.connect(voiceGain);
+            return g;
+        });
+
         const noiseFilter = this.ctx.createBiquadFilter();
         noiseFilter.type = 'highpass';
         noiseFilter.frequency.value = 2000;
-        
-        noise.connect(noiseFilter);
+        const noiseGain = this.ctx.createGain();
+        noiseGain.gain.value = 0;
         noiseFilter.connect(noiseGain);
         noiseGain.connect(this.masterGain);
+
+        return { voiceGain, partialGains, noiseFilter, noiseGain };
+    }
+
+    /**
+     * Take a slot for a note at `when`; without a pool, build a throwaway slot
+     */
+    _acquireSlot(midi, velocity, when) {
+        const pool = this.getVoicePool();
+        if (!pool) return { slot: { nodes: this._createSlotNodes(), generation: 0, pooled: false }, start: when };
+
+        const slot = pool.acquire(midi, velocity, when);
+        // A stolen slot is fading out; begin after the fade
+        const start = slot.stolen ? Math.max(when, this.ctx.currentTime + VoicePool.STEAL_FADE + 0.001) : when;
+        slot.nodes.voiceGain.gain.cancelScheduledValues(start);
+        return { slot, start };
+    }
+
+    /**
+     * Register a voice for note-off and free its slot when the source ends
+     */
+    _trackVoice(slot, voice) {
+        voice.slot = slot.pooled === false ? null : slot;
+        voice.generation = slot.generation;
+        if (voice.slot) slot.voice = voice;
+
+        const voiceKey = `${voice.midi}`;
+        if (!this.activeVoices.has(voiceKey)) {
+            this.activeVoices.set(voiceKey, []);
+        }
+        this.activeVoices.get(voiceKey).push(voice);
         
-        noiseGain.gain.setValueAtTime(velocity * 0.3, now);
-        noiseGain.gain.exponentialRampToValueAtTime(0.001, now + 0.02);
-        
-        noise.start(now);
+        // Clean up after note ends
+        voice.source.onended = () => {
+            this._forgetVoice(voice);
+            if (voice.slot && this.voicePool) this.voicePool.release(voice.slot, voice.generation);
+        };
+        return voice;
+    }
+
+    _forgetVoice(voice) {
+        const voices = this.activeVoices.get(`${voice.midi}`);
+        if (!voices) return;
+        const index = voices.indexOf(voice);
+        if (index > -1) voices.splice(index, 1);
+    }
+
+    _stopVoiceSources(voice, when) {
+        (voice.oscillators || [voice.source]).forEach(node => {
+            try { node.stop(when); } catch (_) {}
+        });
+        if (voice.noise) {
+            try { voice.noise.stop(when); } catch (_) {}
+        }
+    }
+
+    /**
+     * Fast fade and stop of whatever a slot is playing (voice stealing / panic)
+     */
+    _silenceSlot(slot, when) {
+        const fadeEnd = when + VoicePool.STEAL_FADE;
+        const g = slot.nodes.voiceGain.gain;
+        g.cancelScheduledValues(when);
+        g.setValueAtTime(g.value, when);
+        g.linearRampToValueAtTime(0, fadeEnd);
+        const voice = slot.voice;
+        if (voice) {
+            this._stopVoiceSources(voice, fadeEnd);
+            this._forgetVoice(voice);
+        }
+    }
+
+    _getNoiseBuffer() {
+        if (!this._noiseBuffer) {
+            this._noiseBuffer = this.ctx.createBuffer(1, this.ctx.sampleRate * 0.05, this.ctx.sampleRate);
+            const noiseData = this._noiseBuffer.getChannelData(0);
+            for (let i = 0; i < noiseData.length; i++) {
+                noiseData[i] = (Math.random() * 2 - 1) * 0.1;
+            }
+        }
+        return this._noiseBuffer;
+    }
+
+    /**
+     * Active/stolen voice counts
+     */
+    getVoiceStats() {
+        const pool = this.voicePool;
+        return pool ? pool.getStats() : { active: 0, stolen: 0, allocated: 0, peakActive: 0, polyphony: this.polyphony, slots: 0 };
+    }
+
+    /**
+     * Set the polyphony cap (voices beyond it steal the oldest/quietest)
+     */
+    setPolyphony(n) {
+        this.polyphony = Math.max(1, parseInt(n, 10) || this.polyphony);
+        if (this.voicePool) this.voicePool.setPolyphony(this.polyphony);
     }
 
     /**
@@ -289,10 +443,9 @@ class PianoSampleEngine {
      */
     playNote(midi, duration = 0.5, time = 0, velocity = 1.0) {
         if (this.loaded && this.samples.size > 0) {
-            this.playNoteSampled(midi, duration, time, velocity);
-        } else {
-            this.playNoteSynthesized(midi, duration, time, velocity);
+            return this.playNoteSampled(midi, duration, time, velocity);
         }
+        return this.playNoteSynthesized(midi, duration, time, velocity);
     }
 
     /**
@@ -315,20 +468,74 @@ class PianoSampleEngine {
 
     /**
      * Play notes in sequence (arpeggio/melody)
+     * @param {Object} options - { tempo, loop, onEnd } times are beats (seconds at 60 BPM)
+     * @returns {AudioTransport|null} transport driving playback (stop/seek/setTempo mid-phrase)
      */
-    playSequence(notes, noteDuration = 0.5, gap = 0.1, velocity = 1.0) {
+    playSequence(notes, noteDuration = 0.5, gap = 0.1, velocity = 1.0, options = {}) {
         this.resume();
         let time = 0;
+        const events = [];
         notes.forEach(note => {
             let midi = note;
             if (typeof note === 'string') {
                 midi = this.noteToMidi(note);
             }
             if (midi) {
-                this.playNote(midi, noteDuration, time, velocity);
+                events.push({ beat: time, duration: noteDuration, midi });
                 time += noteDuration + gap;
             }
         });
+
+        const transport = this.getTransport();
+        if (!transport) {
+            events.forEach(ev => this.playNote(ev.midi, ev.duration, ev.beat, velocity));
+            return null;
+        }
+
+        transport.tempo = options.tempo || 60;
+        transport.setSequence(events, {
+            length: time,
+            loop: !!options.loop,
+            onEnd: options.onEnd || null,
+            onEvent: (ev, when, duration) => this.playNote(ev.midi, duration, Math.max(0, when - this.ctx.currentTime), velocity),
+            onCancel: (voices) => voices.forEach(voice => this._cancelVoice(voice))
+        });
+        transport.start(0);
+        return transport;
+    }
+
+    /**
+     * Shared lookahead transport (null if audio-transport.js is not loaded)
+     */
+    getTransport() {
+        this.resume();
+        if (!this.transport && typeof AudioTransport !== 'undefined') {
+            this.transport = new AudioTransport(this.ctx);
+        }
+        return this.transport;
+    }
+
+    /**
+     * Silence a voice that was scheduled but has not started yet
+     */
+    _cancelVoice(voice) {
+        if (!voice) return;
+        const now = this.ctx.currentTime;
+        this._stopVoiceSources(voice, now);
+        if (voice.slot) {
+            // Pooled gains stay connected; just hand the slot back
+            if (this.voicePool) this.voicePool.release(voice.slot, voice.generation);
+        } else {
+            try { voice.gainNode.disconnect(); } catch (_) {}
+        }
+        this._forgetVoice(voice);
+    }
+
+    /**
+     * Stop transport playback at the current position (pending notes are cancelled)
+     */
+    stopPlayback() {
+        if (this.transport) this.transport.stop();
     }
 
     /**
@@ -376,8 +583,9 @@ class PianoSampleEngine {
         voice.gainNode.gain.cancelScheduledValues(now);
         voice.gainNode.gain.setValueAtTime(voice.gainNode.gain.value, now);
         voice.gainNode.gain.exponentialRampToValueAtTime(0.001, now + releaseTime);
+        if (voice.slot && this.voicePool) this.voicePool.markReleasing(voice.slot, voice.generation);
         
-        voice.source.stop(now + releaseTime);
+        this._stopVoiceSources(voice, now + releaseTime);
         voices.pop();
     }
 
@@ -385,14 +593,13 @@ class PianoSampleEngine {
      * Stop all active notes
      */
     stopAllNotes() {
+        if (this.transport) this.transport.stop();
+        const now = this.ctx ? this.ctx.currentTime : 0;
+        if (this.voicePool) {
+            this.voicePool.forEachActive(slot => this._silenceSlot(slot, now));
+        }
         this.activeVoices.forEach((voices) => {
-            voices.forEach((voice) => {
-                try {
-                    voice.source.stop();
-                } catch (e) {
-                    // Already stopped
-                }
-            });
+            voices.forEach((voice) => this._stopVoiceSources(voice, now));
         });
         this.activeVoices.clear();
     }
@@ -407,22 +614,40 @@ class PianoSampleEngine {
     }
 
     /**
-     * Get loading status
+     * Get loading status (true as soon as the first sample is playable)
      */
     isReady() {
         return this.loaded;
     }
 
+    /**
+     * True once every sample has decoded
+     */
+    isFullyLoaded() {
+        return this.fullyLoaded;
+    }
+
     /**
      * Get loading progress (0 to 1)
      */
     getLoadProgress() {
-        if (this.loaded) return 1.0;
-        if (!this.loading) return 0.0;
+        if (this.fullyLoaded) return 1.0;
         return this.samples.size / this.sampleNotes.length;
     }
 }
 
+// Cache Storage bucket for encoded samples; bump when the sample set changes
+PianoSampleEngine.SAMPLE_CACHE = 'piano-samples-v1';
+
+// Partial series for the synthesized fallback (ratios of the fundamental)
+PianoSampleEngine.SYNTH_PARTIALS = [
+    { ratio: 1.0, gain: 1.0 },      // Fundamental
+    { ratio: 2.0, gain: 0.4 },      // 2nd harmonic
+    { ratio: 3.0, gain: 0.2 },      // 3rd harmonic
+    { ratio: 4.0, gain: 0.15 },     // 4th harmonic
+    { ratio: 5.0, gain: 0.1 }       // 5th harmonic
+];
+
 // Export for module systems
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = PianoSampleEngine;
@@ -10,6 +10,7 @@
  * @feature Note role visualization (root, third, fifth, seventh)
  * @feature Interactive note clicking
  * @feature Multiple visualization modes
+ * @feature Keys indexed by MIDI and pitch class; state changes patch only the keys that differ
  */
 
 class PianoVisualizer {
@@ -68,6 +69,12 @@ class PianoVisualizer {
         // Container for vertically stacked chord note display (traditional chord stack)
         this.chordStackElement = null;
         this._activeMidiSet = new Set(); // live MIDI-lit keys
+        // Key element index (rebuilt with the key DOM) and last applied visual state per key
+        this._keyList = [];
+        this._keyByMidi = new Map();
+        this._keysByPc = Array.from({ length: 12 }, () => []);
+        this._appliedKeyState = new Map();
+        this._pv_keyLayoutSig = null;
 
         // Piano layout constants
         this.WHITE_ORDER = ['C', 'D', 'E', 'F', 'G', 'A', 'B'];
@@ -190,6 +197,7 @@ class PianoVisualizer {
      * @param {number} endMidi - Ending MIDI note (inclusive)
      */
     updateRange(startMidi, endMidi) {
+        if (this.options.startMidi === startMidi && this.options.endMidi === endMidi && this._keyList.length) return;
         this.options.startMidi = startMidi;
         this.options.endMidi = endMidi;
         
@@ -578,18 +586,18 @@ class PianoVisualizer {
             }
         } catch (_) {}
 
-        this.whitesLayer.innerHTML = '';
-        this.blacksLayer.innerHTML = '';
-
-        // Reset helper maps used for precise key placement
-        this._whiteKeyPositions = new Map(); // midi -> left px
-
         // Compute range
         const startMidi = this.options.startMidi;
         const endMidi = (typeof this.options.endMidi === 'number')
             ? this.options.endMidi
             : (this.options.startMidi + (this.options.octaves * 12) - 1);
 
+        // Key DOM only depends on range and key geometry; resizes and re-fits keep the existing keys
+        const layoutSig = [startMidi, endMidi, this.options.whiteKeyWidth, this.options.whiteKeyHeight,
+            this.options.blackKeyHeight, this.options.showNoteLabels !== false].join('|');
+        const rebuildKeys = layoutSig !== this._pv_keyLayoutSig || !this._keyList.length
+            || this._keyList[0].parentElement !== this.whitesLayer;
+
         // Count white keys to determine total width
         let whiteCount = 0;
         for (let m = startMidi; m <= endMidi; m++) {
@@ -636,11 +644,22 @@ class PianoVisualizer {
             this.pianoElement.style.minWidth = 'max-content';
         }
 
-        // Render white keys
-        this.renderWhiteKeys(startMidi, endMidi);
+        if (rebuildKeys) {
+            this.whitesLayer.innerHTML = '';
+            this.blacksLayer.innerHTML = '';
+
+            // Reset helper maps used for precise key placement
+            this._whiteKeyPositions = new Map(); // midi -> left px
+            this._resetKeyIndex();
+
+            // Render white keys
+            this.renderWhiteKeys(startMidi, endMidi);
 
-        // Render black keys
-        this.renderBlackKeys(startMidi, endMidi);
+            // Render black keys
+            this.renderBlackKeys(startMidi, endMidi);
+
+            this._pv_keyLayoutSig = layoutSig;
+        }
 
         // Apply current state
         this.applyState();
@@ -651,6 +670,28 @@ class PianoVisualizer {
         });
     }
 
+    _resetKeyIndex() {
+        this._keyList = [];
+        this._keyByMidi = new Map();
+        this._keysByPc = Array.from({ length: 12 }, () => []);
+        this._appliedKeyState = new Map();
+    }
+
+    _indexKey(key, midi) {
+        this._keyList.push(key);
+        this._keyByMidi.set(midi, key);
+        this._keysByPc[midi % 12].push(key);
+    }
+
+    /**
+     * Keys that can match a note name: every accepted spelling (name, correct enharmonic,
+     * sharp/flat pair) shares the key's pitch class, so only that class needs checking
+     */
+    _keysForNote(note) {
+        const pc = this.NOTE_TO_SEMITONE[note];
+        return typeof pc === 'number' ? this._keysByPc[pc] : [];
+    }
+
     /**
      * Render white keys
      */
@@ -730,11 +771,13 @@ class PianoVisualizer {
             });
             key.addEventListener('mouseleave', () => {
                 key.style.transform = 'translateY(0)';
-                // Trigger re-apply of current state
+                // Hover restyled this key; forget its applied state so the re-apply restores it
+                this._appliedKeyState.delete(key);
                 this.applyState();
             });
 
             this.whitesLayer.appendChild(key);
+            this._indexKey(key, midi);
             whiteIndex++;
         }
     }
@@ -841,11 +884,13 @@ class PianoVisualizer {
             });
             key.addEventListener('mouseleave', () => {
                 key.style.transform = 'translateY(0)';
-                // Trigger re-apply of current state
+                // Hover restyled this key; forget its applied state so the re-apply restores it
+                this._appliedKeyState.delete(key);
                 this.applyState();
             });
 
             this.blacksLayer.appendChild(key);
+            this._indexKey(key, midi);
         }
     }
 
@@ -870,7 +915,9 @@ class PianoVisualizer {
     /**
      * Handle grading mode changes
      */
-    onGradingModeChanged(newMode) {
+    onGradingModeChanged(data) {
+        // Engine events carry { oldMode, newMode, grading }; older callers pass the mode string
+        const newMode = (data && typeof data === 'object') ? data.newMode : data;
         const oldMode = this.state.gradingMode;
         this.state.gradingMode = newMode;
         
@@ -1229,23 +1276,26 @@ class PianoVisualizer {
         
         this.state.noteGradings.clear();
         
-        // Calculate grading for each note in the current scale
+        const context = {
+            elementType: 'note',
+            key: this.state.currentKey,
+            scaleType: this.state.currentScale
+        };
+        const cached = typeof this.gradingEngine.getElementGrading === 'function';
+
+        // Calculate grading for each note in the current scale (served from the engine's grading cache)
         this.state.scaleNotes.forEach(note => {
-            const tier = this.gradingEngine.calculateElementGrade(note, {
-                elementType: 'note',
-                key: this.state.currentKey,
-                scaleType: this.state.currentScale
-            });
-            
-            const gradingInfo = this.gradingEngine.getGradingTierInfo(tier);
+            let tier, gradingInfo;
+            if (cached) {
+                ({ tier, info: gradingInfo } = this.gradingEngine.getElementGrading(note, context));
+            } else {
+                tier = this.gradingEngine.calculateElementGrade(note, context);
+                gradingInfo = this.gradingEngine.getGradingTierInfo(tier);
+            }
             this.state.noteGradings.set(note, {
                 tier: tier,
                 info: gradingInfo,
-                explanation: this.gradingEngine.getGradingExplanation(note, tier, {
-                    elementType: 'note',
-                    key: this.state.currentKey,
-                    scaleType: this.state.currentScale
-                })
+                explanation: this.gradingEngine.getGradingExplanation(note, tier, context)
             });
         });
     }
@@ -1375,8 +1425,7 @@ class PianoVisualizer {
     findKeyElementForNote(note) {
         if (!this.pianoElement) return null;
         
-        const keys = this.pianoElement.querySelectorAll('.piano-white-key, .piano-black-key');
-        for (let key of keys) {
+        for (const key of this._keysForNote(note)) {
             const keyNote = key.dataset.correctNote || key.dataset.note;
             if (keyNote === note || this.getEnharmonicEquivalent(keyNote) === note) {
                 return key;
@@ -1632,6 +1681,14 @@ class PianoVisualizer {
         this.applyState();
     }
 
+    /**
+     * Replace the MIDI-lit key set in one pass (per-frame snapshot from MIDIInputManager)
+     */
+    setMidiNotes(midis) {
+        this._activeMidiSet = new Set(midis || []);
+        this.applyState();
+    }
+
     clearMidiNotes() {
         this._activeMidiSet.clear();
         this.applyState();
@@ -1688,20 +1745,18 @@ class PianoVisualizer {
      * Apply current state to visual elements
      */
     applyState() {
-        // Reset all keys
-        this.pianoElement.querySelectorAll('.piano-white-key, .piano-black-key').forEach(key => {
-            key.classList.remove('active', 'highlighted', 'root', 'third', 'fifth', 'seventh', 'ninth', 'eleventh', 'extension');
-            // Reset styling
-            if (key.classList.contains('piano-white-key')) {
-                key.style.background = 'linear-gradient(to bottom, #ffffff, #e0e0e0)';
-                key.style.borderColor = 'var(--border-light)';
-                key.style.boxShadow = 'inset 0 -1px 2px rgba(0,0,0,0.1)';
-            } else if (key.classList.contains('piano-black-key')) {
-                key.style.background = 'linear-gradient(to bottom, #333333, #000000)';
-                key.style.borderColor = '#000000';
-                key.style.boxShadow = 'inset 0 0 2px rgba(255,255,255,0.2), 2px 2px 4px rgba(0,0,0,0.4)';
+        if (!this.pianoElement) return;
+
+        // Build the desired visual state of every touched key, then patch only keys whose state changed
+        const drafts = new Map(); // key -> { classes, background, borderColor, boxShadow }
+        const draft = (key) => {
+            let d = drafts.get(key);
+            if (!d) {
+                d = this._baseKeyDraft(key);
+                drafts.set(key, d);
             }
-        });
+            return d;
+        };
         const midiActiveSet = this._activeMidiSet || new Set();
         
         // Remove existing annotations
@@ -1710,24 +1765,6 @@ class PianoVisualizer {
         // Helper function to check if a key matches a note (enharmonic aware)
         const keyMatchesNote = (key, note) => {
             const keyNote = key.dataset.correctNote || key.dataset.note;
-
-        // Overlay MIDI-lit keys (live play) without disturbing theoretical highlights
-        if (midiActiveSet.size && this.pianoElement) {
-            midiActiveSet.forEach(midi => {
-                const key = this.pianoElement.querySelector(`[data-midi="${midi}"]`);
-                if (key) {
-                    key.classList.add('active', 'midi-active');
-                    const isBlack = key.classList.contains('piano-black-key');
-                    const bg = isBlack
-                        ? 'linear-gradient(180deg, #22d3ee 0%, #0ea5e9 100%)'
-                        : 'linear-gradient(180deg, #a7f3d0 0%, #34d399 100%)';
-                    const border = isBlack ? '#0ea5e9' : '#059669';
-                    key.style.background = bg;
-                    key.style.borderColor = border;
-                    key.style.boxShadow = '0 0 0 3px rgba(34,197,94,0.55), 0 6px 10px rgba(0,0,0,0.35)';
-                }
-            });
-        }
             const keyOriginalNote = key.dataset.note;
             
             // Direct match
@@ -1768,10 +1805,10 @@ class PianoVisualizer {
         // FALLBACK: If only note names are provided, highlight all instances (octave-aware if mode is 'octave').
         if (this.state.activeMidiNotes && this.state.activeMidiNotes.length > 0) {
             this.state.activeMidiNotes.forEach(midi => {
-                const key = this.pianoElement.querySelector(`[data-midi="${midi}"]`);
+                const key = this._keyByMidi.get(midi);
                 if (!key) return; // Note might be out of visual range
                 
-                key.classList.add('active');
+                draft(key).classes.add('active');
                 
                 // Use grading color if available, else default chord colors
                 let backgroundColor, borderColor, boxShadow;
@@ -1807,9 +1844,9 @@ class PianoVisualizer {
                     }
                 }
 
-                key.style.background = backgroundColor;
-                key.style.borderColor = borderColor;
-                key.style.boxShadow = boxShadow;
+                draft(key).background = backgroundColor;
+                draft(key).borderColor = borderColor;
+                draft(key).boxShadow = boxShadow;
             });
         } else {
             // Original behavior: Highlight by note name (potentially multiple octaves)
@@ -1817,11 +1854,11 @@ class PianoVisualizer {
             // For general highlighting, don't restrict to scale or mode unless strictly enforced
             // if (this.state.mode !== 'chord' && !isNoteInScale(note)) return;
 
-            this.pianoElement.querySelectorAll('.piano-white-key, .piano-black-key').forEach(key => {
+            this._keysForNote(note).forEach(key => {
                 if (keyMatchesNote(key, note)) {
                     // If highlightMode is 'octave', only apply to center octave
                     if (this.options.highlightMode === 'octave' && !isInCenter(key)) return;
-                    key.classList.add('active');
+                    draft(key).classes.add('active');
                     
                     // Enhanced grading integration: use grading colors if available
                     let backgroundColor, borderColor, boxShadow;
@@ -1856,9 +1893,9 @@ class PianoVisualizer {
                         }
                     }
                     
-                    key.style.background = backgroundColor;
-                    key.style.borderColor = borderColor;
-                    key.style.boxShadow = boxShadow;
+                    draft(key).background = backgroundColor;
+                    draft(key).borderColor = borderColor;
+                    draft(key).boxShadow = boxShadow;
                 }
             });
         });
@@ -1870,11 +1907,11 @@ class PianoVisualizer {
             // Allow chromatic highlighting even if not in scale
             // if (this.state.mode !== 'chord' && !inScale) return;
             
-            this.pianoElement.querySelectorAll('.piano-white-key, .piano-black-key').forEach(key => {
+            this._keysForNote(note).forEach(key => {
                 if (keyMatchesNote(key, note)) {
                     // If highlightMode is 'octave', only apply to center octave
                     if (this.options.highlightMode === 'octave' && !isInCenter(key)) return;
-                    key.classList.add('highlighted');
+                    draft(key).classes.add('highlighted');
                     
                     // Enhanced grading integration: use grading colors for highlighting
                     let backgroundColor, borderColor, boxShadow;
@@ -1923,9 +1960,9 @@ class PianoVisualizer {
                         }
                     }
                     
-                    key.style.background = backgroundColor;
-                    key.style.borderColor = borderColor;
-                    key.style.boxShadow = boxShadow;
+                    draft(key).background = backgroundColor;
+                    draft(key).borderColor = borderColor;
+                    draft(key).boxShadow = boxShadow;
                 }
             });
         });
@@ -1946,30 +1983,85 @@ class PianoVisualizer {
         // Apply role-based styling
         this.state.noteRoles.forEach((role, note) => {
             if (this.state.mode !== 'chord' && !isNoteInScale(note)) return;
-            this.pianoElement.querySelectorAll('.piano-white-key, .piano-black-key').forEach(key => {
+            this._keysForNote(note).forEach(key => {
                 // If in chord mode, apply to ALL matching keys (ignore center restriction for inversions)
                 const shouldApply = (this.state.mode === 'chord') 
                     ? keyMatchesNote(key, note)
                     : (isInCenter(key) && keyMatchesNote(key, note));
 
                 if (shouldApply) {
-                    key.classList.add(role);
+                    draft(key).classes.add(role);
                     // Force precise role colors
                     const color = getRoleColorFallback(role);
                     // Use gradients to retain 3D feel but with role color
                     const isWhite = key.classList.contains('piano-white-key');
                     if (isWhite) {
-                        key.style.background = `linear-gradient(180deg, ${this.lightenColor(color, 0.4)} 0%, ${color} 100%)`;
-                        key.style.borderColor = this.darkenColor(color, 0.2);
-                        key.style.boxShadow = `inset 0 -1px 2px rgba(0,0,0,0.1), 0 0 0 2px ${color}80`;
+                        draft(key).background = `linear-gradient(180deg, ${this.lightenColor(color, 0.4)} 0%, ${color} 100%)`;
+                        draft(key).borderColor = this.darkenColor(color, 0.2);
+                        draft(key).boxShadow = `inset 0 -1px 2px rgba(0,0,0,0.1), 0 0 0 2px ${color}80`;
                     } else {
-                        key.style.background = `linear-gradient(180deg, ${this.lightenColor(color, 0.1)} 0%, ${this.darkenColor(color, 0.2)} 100%)`;
-                        key.style.borderColor = this.darkenColor(color, 0.4);
-                        key.style.boxShadow = `inset 0 0 2px rgba(255,255,255,0.2), 0 0 0 2px ${color}80`;
+                        draft(key).background = `linear-gradient(180deg, ${this.lightenColor(color, 0.1)} 0%, ${this.darkenColor(color, 0.2)} 100%)`;
+                        draft(key).borderColor = this.darkenColor(color, 0.4);
+                        draft(key).boxShadow = `inset 0 0 2px rgba(255,255,255,0.2), 0 0 0 2px ${color}80`;
                     }
                 }
             });
         });
+
+        // Overlay MIDI-lit keys (live play) last, so live play wins over the theoretical highlights
+        if (midiActiveSet.size) {
+            midiActiveSet.forEach(midi => {
+                const key = this._keyByMidi.get(midi);
+                if (key) {
+                    const d = draft(key);
+                    d.classes.add('active');
+                    d.classes.add('midi-active');
+                    const isBlack = key.classList.contains('piano-black-key');
+                    const bg = isBlack
+                        ? 'linear-gradient(180deg, #22d3ee 0%, #0ea5e9 100%)'
+                        : 'linear-gradient(180deg, #a7f3d0 0%, #34d399 100%)';
+                    const border = isBlack ? '#0ea5e9' : '#059669';
+                    d.background = bg;
+                    d.borderColor = border;
+                    d.boxShadow = '0 0 0 3px rgba(34,197,94,0.55), 0 6px 10px rgba(0,0,0,0.35)';
+                }
+            });
+        }
+
+        this._patchKeys(drafts);
+    }
+
+    /**
+     * Resting look of a key (no state classes)
+     */
+    _baseKeyDraft(key) {
+        const isBlack = key.classList.contains('piano-black-key');
+        return {
+            classes: new Set(),
+            background: isBlack ? 'linear-gradient(to bottom, #333333, #000000)' : 'linear-gradient(to bottom, #ffffff, #e0e0e0)',
+            borderColor: isBlack ? '#000000' : 'var(--border-light)',
+            boxShadow: isBlack ? 'inset 0 0 2px rgba(255,255,255,0.2), 2px 2px 4px rgba(0,0,0,0.4)' : 'inset 0 -1px 2px rgba(0,0,0,0.1)'
+        };
+    }
+
+    /**
+     * Write drafted key states to the DOM, skipping keys whose state is unchanged since the last apply
+     */
+    _patchKeys(drafts) {
+        const stateClasses = PianoVisualizer.STATE_CLASSES;
+        this._keyList.forEach(key => {
+            const d = drafts.get(key) || this._baseKeyDraft(key);
+            const classes = Array.from(d.classes);
+            const sig = `${classes.sort().join(' ')}|${d.background}|${d.borderColor}|${d.boxShadow}`;
+            if (this._appliedKeyState.get(key) === sig) return;
+            this._appliedKeyState.set(key, sig);
+
+            key.classList.remove(...stateClasses);
+            if (classes.length) key.classList.add(...classes);
+            key.style.background = d.background;
+            key.style.borderColor = d.borderColor;
+            key.style.boxShadow = d.boxShadow;
+        });
     }
 
     /**
@@ -2346,6 +2438,9 @@ class PianoVisualizer {
     }
 }
 
+// Classes applyState owns on key elements
+PianoVisualizer.STATE_CLASSES = ['active', 'highlighted', 'root', 'third', 'fifth', 'seventh', 'ninth', 'eleventh', 'extension', 'midi-active'];
+
 // Export for module usage
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = PianoVisualizer;
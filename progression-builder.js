@@ -43,6 +43,7 @@ class ProgressionBuilder {
         };
 
         this.listeners = new Map();
+        this._candidateTables = new Map(); // `${key}|${scale}|${gradingVersion}` -> candidate table
         this.containerElement = null;
         this.numberGenerator = null;
         this.scaleLibrary = null;
@@ -52,7 +53,7 @@ class ProgressionBuilder {
         if (this.musicTheory.subscribe) {
             this.musicTheory.subscribe((event, data) => {
                 if (event === 'gradingModeChanged') {
-                    this.state.gradingType = data;
+                    this.state.gradingType = (data && data.newMode) || this.musicTheory.gradingMode;
                     this.render();
                 }
             });
@@ -64,10 +65,22 @@ class ProgressionBuilder {
     /**
      * Connect to other modules
      */
-    connectModules(numberGenerator, scaleLibrary) {
+    connectModules(numberGenerator, scaleLibrary, stateStore = null) {
         this.numberGenerator = numberGenerator;
         this.scaleLibrary = scaleLibrary;
 
+        // With a shared store, key/scale/numbers changes from one action arrive as a
+        // single batched notification, so the progression is regenerated once
+        if (stateStore && typeof stateStore.subscribe === 'function') {
+            this.unsubscribeStore = stateStore.subscribe(['key', 'scale', 'numbers'], (changes, state) => {
+                if (changes.key) this.state.currentKey = state.key;
+                if (changes.scale) this.state.currentScale = state.scale;
+                if (changes.numbers) this.state.inputNumbers = state.numbers || [];
+                this.generateProgression();
+            }, { id: 'progression-builder' });
+            return;
+        }
+
         // Listen to number generator changes
         if (numberGenerator && numberGenerator.on) {
             numberGenerator.on('numbersChanged', (data) => {
@@ -454,7 +467,8 @@ class ProgressionBuilder {
         let baseChord = null;
         try { baseChord = this.musicTheory.getDiatonicChord(degree, key, scale); } catch(_){}
         // Container chords that include the target note
-        let raw = this.musicTheory.findAllContainerChords([targetNote], scaleNotes) || [];
+        const entry = this._candidateEntry(this.getCandidateTable(key, scale), degree);
+        let raw = entry && entry.note === targetNote ? entry.containers : (this.musicTheory.findAllContainerChords([targetNote], scaleNotes) || []);
         // Optionally augment with borrowed, secondary dominants, chromatic mediants
         const augmented = [];
         if (this.state.enableBorrowedChords) {
@@ -519,8 +533,7 @@ class ProgressionBuilder {
         // Diatonic score via existing grade system
         let gradeScore = 0;
         try {
-            const scaleNotes = this.musicTheory.getScaleNotes(this.state.currentKey, this.state.currentScale) || [];
-            gradeScore = this.getChordGradeScore(cand, baseChord, scaleNotes);
+            gradeScore = typeof cand.__grade === 'number' ? cand.__grade : this.getChordGradeScore(cand, baseChord, scaleNotes);
         } catch(_){}
         // Function weight
         const funcScore = Array.isArray(cand.functions) && cand.functions.length ? 1.5 : 0;
@@ -665,8 +678,8 @@ class ProgressionBuilder {
                 }
 
                 // Find candidate chords that have this root (findAllContainerChords will include chords that contain the root)
-                let candidates = this.musicTheory.findAllContainerChords([root], scaleNotes) || [];
-                candidates = candidates.filter(c => c.root === root);
+                const entry = this._candidateEntry(this.getCandidateTable(), degree);
+                let candidates = entry ? entry.containers.filter(c => c.root === root) : [];
 
                 // Inject the diatonic base chord if it's not in the standard candidate list (e.g. synthetic chords)
                 // This ensures the "native" scale chord is always an option
@@ -754,7 +767,7 @@ class ProgressionBuilder {
                 }
 
                 // Score candidates by grade relative to baseChord
-                candidates = candidates.map(c => ({ ...c, __grade: this.getChordGradeScore(c, baseChord, scaleNotes) }));
+                candidates = candidates.map(c => ({ ...c, __grade: c.__grade != null ? c.__grade : this.getChordGradeScore(c, baseChord, scaleNotes) }));
                 const targetGrade = this.state.gradeTier;
                 
                 // Enhanced grading-weighted selection: favor higher-tier elements
@@ -897,35 +910,24 @@ class ProgressionBuilder {
             const scaleNotes = this.musicTheory.getScaleNotes(this.state.currentKey, this.state.currentScale) || [];
             if (!scaleNotes.length) return null;
             
-            // Get the note for this degree
+            // Get the note for this degree; its graded container chords come from the key's table
             const note = scaleNotes[(degree - 1) % scaleNotes.length];
-            
-            // Find all chords that contain this note
-            const candidates = this.musicTheory.findAllContainerChords([note], scaleNotes) || [];
+            const entry = this._candidateEntry(this.getCandidateTable(), degree);
+            const candidates = entry ? entry.containers : [];
             
             // Filter and score by grade tier and complexity
             const targetGrade = this.state.gradeTier;
             const targetCx = this.getTargetComplexity();
             
-            let filtered = candidates.map(c => {
-                const baseChord = this.musicTheory.getDiatonicChord(degree, this.state.currentKey, this.state.currentScale);
-                const grade = this.getChordGradeScore(c, baseChord, scaleNotes);
-                return { ...c, __grade: grade };
-            });
-            
             // Filter by exact grade tier
-            filtered = filtered.filter(c => c.__grade === targetGrade);
+            let filtered = candidates.filter(c => c.__grade === targetGrade);
             
             // If no exact matches, try adjacent grades
             if (filtered.length === 0) {
                 for (let offset of [1, -1, 2, -2]) {
                     const fallbackGrade = targetGrade + offset;
                     if (fallbackGrade >= 0 && fallbackGrade <= 4) {
-                        const fallback = candidates.map(c => {
-                            const baseChord = this.musicTheory.getDiatonicChord(degree, this.state.currentKey, this.state.currentScale);
-                            const grade = this.getChordGradeScore(c, baseChord, scaleNotes);
-                            return { ...c, __grade: grade };
-                        }).filter(c => c.__grade === fallbackGrade);
+                        const fallback = candidates.filter(c => c.__grade === fallbackGrade);
                         if (fallback.length > 0) {
                             filtered = fallback;
                             break;
@@ -1000,6 +1002,306 @@ class ProgressionBuilder {
         return 'extended';
     }
 
+    /**
+     * Per-(key, scale) table of graded candidates for every degree, built once and reused by
+     * the single-chord pickers and by sampleProgressions(). Entries are shared: copy before mutating.
+     * Each degree holds its container chords (chords containing the degree note) and the
+     * borrowed / secondary dominant / chromatic mediant / tritone sub extras, all with
+     * __grade, complexity and flags { borrowed, mediant, secondaryDominant, tritoneSub }.
+     */
+    getCandidateTable(key = this.state.currentKey, scale = this.state.currentScale) {
+        const version = this.musicTheory.gradingVersion || 0;
+        const id = `${key}|${scale}|${version}`;
+        let table = this._candidateTables.get(id);
+        if (table) return table;
+
+        const scaleNotes = this.musicTheory.getScaleNotes(key, scale) || [];
+        table = { key, scale, scaleNotes, degrees: [], views: new Map() };
+        const parallelScale = scale === 'major' ? 'natural_minor' : 'major';
+        const scaleMask = this.musicTheory.notesToPitchClassMask(scaleNotes);
+        const borrowedNames = new Set();
+        for (let d = 1; d <= 7; d++) {
+            try {
+                const b = this.musicTheory.getDiatonicChord(d, key, parallelScale);
+                if (b) borrowedNames.add(b.root + b.chordType);
+            } catch (_) {}
+        }
+
+        for (let degree = 1; degree <= scaleNotes.length; degree++) {
+            const note = scaleNotes[degree - 1];
+            let baseChord = null;
+            try { baseChord = this.musicTheory.getDiatonicChord(degree, key, scale); } catch (_) {}
+            if (!baseChord) {
+                table.degrees.push(null);
+                continue;
+            }
+            const byName = new Map();
+            const flagsFor = (chord) => {
+                const outside = chord.scaleMatchPercent !== 100;
+                const interval = this._pitchInterval(baseChord.root, chord.root);
+                return {
+                    borrowed: outside && borrowedNames.has(chord.root + chord.chordType),
+                    mediant: outside && [3, 4, 8, 9].includes(interval) && /^(maj7?|m7?|)$/.test(chord.chordType || ''),
+                    secondaryDominant: false,
+                    tritoneSub: false
+                };
+            };
+            const containers = (this.musicTheory.findAllContainerChords([note], scaleNotes) || []).map(c => {
+                const entry = { ...c, __grade: this.getChordGradeScore(c, baseChord, scaleNotes), flags: flagsFor(c), extra: null };
+                byName.set(entry.fullName, entry);
+                return entry;
+            });
+
+            // Same extras buildHarmonyCandidates adds, with every mediant root and quality enumerated
+            const extras = [];
+            const addExtra = (root, chordType, kind, flag) => {
+                if (!root) return;
+                const fullName = root + chordType;
+                const existing = byName.get(fullName);
+                if (existing) {
+                    if (flag) existing.flags[flag] = true;
+                    return;
+                }
+                const chordNotes = this.musicTheory.getChordNotes(root, chordType) || [];
+                const inScale = chordNotes.filter(n => scaleMask & this.musicTheory.notesToPitchClassMask([n])).length;
+                const chord = {
+                    root, chordType, fullName, chordNotes,
+                    scaleMatchPercent: chordNotes.length ? Math.round(inScale / chordNotes.length * 100) : 0,
+                    complexity: this.musicTheory.getChordComplexity(chordType),
+                    functions: [kind]
+                };
+                chord.__grade = this.getChordGradeScore(chord, baseChord, scaleNotes);
+                chord.flags = flagsFor(chord);
+                if (flag) chord.flags[flag] = true;
+                chord.extra = kind;
+                byName.set(fullName, chord);
+                extras.push(chord);
+            };
+            try {
+                const borrowed = this.musicTheory.getDiatonicChord(degree, key, parallelScale);
+                if (borrowed) addExtra(borrowed.root, borrowed.chordType, 'borrowed', 'borrowed');
+            } catch (_) {}
+            if (degree !== 1) addExtra(this.musicTheory.getNoteFromInterval(baseChord.root, 7), '7', 'secondary_dominant', 'secondaryDominant');
+            [3, 4, 8, 9].forEach(interval => {
+                const root = this.musicTheory.getNoteFromInterval(note, interval);
+                addExtra(root, 'maj7', 'chromatic_mediant', 'mediant');
+                addExtra(root, 'm7', 'chromatic_mediant', 'mediant');
+            });
+            addExtra(this.musicTheory.getNoteFromInterval(note, 6), '7', 'tritone_sub', 'tritoneSub');
+
+            table.degrees.push({ degree, note, baseChord, containers, extras });
+        }
+
+        // Key/scale changes are rare but unbounded over a session; keep the most recent few
+        if (this._candidateTables.size >= 24) this._candidateTables.delete(this._candidateTables.keys().next().value);
+        this._candidateTables.set(id, table);
+        return table;
+    }
+
+    _pitchInterval(fromNote, toNote) {
+        const a = this.musicTheory.noteValues[fromNote];
+        const b = this.musicTheory.noteValues[toNote];
+        if (a == null || b == null) return null;
+        return ((b - a) % 12 + 12) % 12;
+    }
+
+    /**
+     * Table entry for a 1-based degree (wrapping like scaleNotes[(degree - 1) % length])
+     */
+    _candidateEntry(table, degree) {
+        const count = table.degrees.length;
+        if (!count) return null;
+        return table.degrees[((degree - 1) % count + count) % count] || null;
+    }
+
+    /**
+     * Sampling view of a table for a harmonization mode and the current enable* toggles: per degree,
+     * candidates bucketed by grade then complexity, each bucket with cumulative scaleMatchPercent weights.
+     * The pools follow generateChordForDegree: harmony mode adds the enabled extras to the degree
+     * note's containers, root mode keeps chords rooted on the degree note (plus the diatonic chord)
+     * with its sus/#5/small-scale filters, and melody mode uses the degree note's containers.
+     */
+    _candidateView(table, mode = this.state.harmonizationMode || 'root') {
+        const s = this.state;
+        const allowed = { borrowed: s.enableBorrowedChords, secondary_dominant: s.enableSecondaryDominants, chromatic_mediant: s.enableChromaticMediants, tritone_sub: s.enableTritoneSubs };
+        const sig = mode === 'harmony' ? 'harmony:' + Object.keys(allowed).map(k => (allowed[k] ? 1 : 0)).join('') : mode;
+        let view = table.views.get(sig);
+        if (view) return view;
+        view = table.degrees.map(entry => {
+            if (!entry) return null;
+            let pool;
+            if (mode === 'harmony') pool = entry.containers.concat(entry.extras.filter(c => allowed[c.extra]));
+            else if (mode === 'root') pool = this._rootModePool(entry, table.scaleNotes);
+            else pool = entry.containers;
+            const grades = [0, 1, 2, 3, 4].map(() => ({ all: [], triad: [], seventh: [], extended: [] }));
+            pool.forEach(c => {
+                const bucket = grades[c.__grade];
+                bucket.all.push(c);
+                if (bucket[c.complexity]) bucket[c.complexity].push(c);
+            });
+            grades.forEach(bucket => Object.keys(bucket).forEach(cx => {
+                const list = bucket[cx];
+                let sum = 0;
+                list.weights = list.map(c => (sum += Math.max(1, Math.floor(c.scaleMatchPercent || 50))));
+            }));
+            return { entry, grades };
+        });
+        table.views.set(sig, view);
+        return view;
+    }
+
+    /**
+     * Root-mode candidates for a table entry without manual tokens: chords rooted on the degree
+     * note, the diatonic chord injected when missing, sus and #5 chords only when the diatonic
+     * chord is one, and no 6th/7th/extended types on small scales
+     */
+    _rootModePool(entry, scaleNotes) {
+        const isSmallScale = scaleNotes.length > 0 && scaleNotes.length < 7;
+        const base = entry.baseChord;
+        const baseType = (base.chordType || '').toLowerCase();
+        const pool = entry.containers.filter(c => c.root === entry.note);
+        if (!pool.some(c => (c.chordType || '').toLowerCase() === baseType)) {
+            const injected = {
+                root: base.root,
+                chordType: base.chordType,
+                fullName: base.fullName,
+                chordNotes: base.diatonicNotes || [],
+                scaleMatchPercent: 100,
+                functions: ['Diatonic'],
+                complexity: 'triad',
+                flags: { borrowed: false, mediant: false, secondaryDominant: false, tritoneSub: false },
+                extra: null
+            };
+            injected.__grade = this.getChordGradeScore(injected, base, scaleNotes);
+            pool.push(injected);
+        }
+        const baseIsSus = /sus/i.test(base.chordType || '');
+        const baseIsSharp5 = /#5/.test(base.chordType || '');
+        return pool.filter(c => {
+            const type = (c.chordType || '').toLowerCase();
+            if (isSmallScale && type !== baseType && /7|9|11|13|6/.test(type)) return false;
+            if (/sus/i.test(c.chordType) && !baseIsSus) return false;
+            if (/#5|aug/i.test(c.chordType) && !baseIsSharp5) return false;
+            return true;
+        });
+    }
+
+    /**
+     * Same grade/complexity fallback chain as pickChordContainingDegree, weighted by scale match
+     */
+    _sampleFromView(slot, targetGrade, targetCx, random) {
+        let bucket = null;
+        for (const offset of [0, 1, -1, 2, -2]) {
+            const g = targetGrade + offset;
+            if (g >= 0 && g <= 4 && slot.grades[g].all.length) { bucket = slot.grades[g]; break; }
+        }
+        if (!bucket) return null;
+        let list = bucket[targetCx];
+        if (!list.length && targetCx === 'extended') list = bucket.seventh;
+        if (!list.length && targetCx !== 'triad') list = bucket.triad;
+        if (!list.length) list = bucket.all;
+        const r = random() * list.weights[list.length - 1];
+        let lo = 0;
+        let hi = list.length - 1;
+        while (lo < hi) {
+            const mid = (lo + hi) >> 1;
+            if (list.weights[mid] < r) lo = mid + 1;
+            else hi = mid;
+        }
+        return list[lo];
+    }
+
+    /**
+     * Sample up to `count` distinct progressions for the input numbers in one pass over the
+     * cached candidate table. With allowBentChoices, ruleFlex is the chance (percent) that a slot
+     * aims one grade lower. Returns [{ progression, meta, gradeDistance }], closest to the
+     * target grade first; meta entries match generateProgression()'s. Candidate pools follow the
+     * harmonization mode (see _candidateView).
+     * @param {Object} [options] - { numbers, gradeTier, complexity, mode, unique = true, random = Math.random }
+     */
+    sampleProgressions(count = 100, options = {}) {
+        const numbers = options.numbers || this.state.inputNumbers || [];
+        if (!numbers.length || count <= 0) return [];
+        const table = this.getCandidateTable();
+        const view = this._candidateView(table, options.mode || this.state.harmonizationMode || 'root');
+        if (!view.length) return [];
+        const random = options.random || Math.random;
+        const gradeTier = options.gradeTier != null ? options.gradeTier : this.state.gradeTier;
+        const complexity = options.complexity != null ? options.complexity : this.state.complexity;
+        const targetCx = complexity < 30 ? 'triad' : complexity < 70 ? 'seventh' : 'extended';
+        const bend = this.state.allowBentChoices ? Math.max(0, Math.min(100, this.state.ruleFlex || 0)) / 100 : 0;
+        const unique = options.unique !== false;
+        const slots = numbers.map(degree => view[((degree - 1) % view.length + view.length) % view.length]);
+
+        const results = [];
+        const seen = new Set();
+        const maxAttempts = count * 4;
+        for (let attempt = 0; attempt < maxAttempts && results.length < count; attempt++) {
+            const progression = [];
+            const meta = [];
+            let distance = 0;
+            slots.forEach((slot, i) => {
+                if (!slot) return;
+                const target = bend && gradeTier > 0 && random() < bend ? gradeTier - 1 : gradeTier;
+                const chord = this._sampleFromView(slot, target, targetCx, random);
+                if (!chord) return;
+                const base = slot.entry.baseChord;
+                distance += Math.abs(chord.__grade - gradeTier);
+                progression.push(chord.fullName);
+                meta.push({
+                    degree: numbers[i],
+                    complexity,
+                    gradeTier,
+                    chordType: chord.chordType,
+                    chordRoot: chord.root,
+                    fullName: chord.fullName,
+                    diatonicNotes: base.diatonicNotes,
+                    chosenGrade: chord.__grade,
+                    isSubstitution: !(chord.__grade === 4 && chord.root === base.root && chord.chordType === base.chordType),
+                    functions: Array.isArray(chord.functions) ? chord.functions : undefined,
+                    scaleMatchPercent: chord.scaleMatchPercent,
+                    flags: { ...chord.flags }
+                });
+            });
+            const id = progression.join(' ');
+            if (!progression.length || (unique && seen.has(id))) continue;
+            seen.add(id);
+            results.push({ progression, meta, gradeDistance: distance / progression.length });
+        }
+        return results.sort((a, b) => a.gradeDistance - b.gradeDistance);
+    }
+
+    /**
+     * Sample a batch of alternative progressions for the current numbers and announce them
+     */
+    generateAlternativeProgressions(count = 100, options = {}) {
+        const alternatives = this.sampleProgressions(count, options);
+        this.state.alternativeProgressions = alternatives;
+        this.emit('alternativesGenerated', { alternatives, key: this.state.currentKey, scale: this.state.currentScale });
+        return alternatives;
+    }
+
+    /**
+     * Make one of the sampled alternatives the current progression
+     */
+    useAlternativeProgression(index) {
+        const alt = (this.state.alternativeProgressions || [])[index];
+        if (!alt) return false;
+        const after = this.applyExploreLogic(alt.progression.slice(), alt.meta.map(m => ({ ...m })));
+        this.state.currentProgression = after.progression;
+        this.state.progressionMeta = after.meta;
+        this.emit('progressionChanged', {
+            progression: after.progression,
+            meta: after.meta,
+            complexity: this.state.complexity,
+            gradeTier: this.state.gradeTier,
+            mode: 'alternative',
+            index
+        });
+        this.render();
+        return true;
+    }
+
     /**
      * Pick a chord for the degree using ContainerChord-style grading + complexity.
      */
@@ -1012,27 +1314,26 @@ class ProgressionBuilder {
             const degreeNote = scaleNotes.length ? scaleNotes[(degree - 1) % scaleNotes.length] : baseChord.root;
             const notes = [degreeNote];
 
-            // Search container chords that include any of the stacked chord notes
-            let candidates = this.musicTheory.findAllContainerChords(notes, scaleNotes) || [];
+            // Container chords for the degree note, graded once per key in the candidate table;
+            // a caller-supplied baseChord that isn't the degree's diatonic chord is graded here
+            const entry = scaleNotes.length ? this._candidateEntry(this.getCandidateTable(key, scale), degree) : null;
+            const tableMatches = entry && entry.baseChord.root === baseChord.root && entry.baseChord.chordType === baseChord.chordType;
+            const allCandidates = tableMatches
+                ? entry.containers
+                : (this.musicTheory.findAllContainerChords(notes, scaleNotes) || []).map(c => ({ ...c, __grade: this.getChordGradeScore(c, baseChord, scaleNotes) }));
 
-            // Compute grade score and filter by EXACT grade tier to allow substitution within same tier
+            // Filter by EXACT grade tier to allow substitution within same tier
             const targetGrade = this.state.gradeTier;
-            console.log(`🎵 Degree ${degree}: targetGrade=${targetGrade}, complexity=${this.state.complexity}`);
-            candidates = candidates.map(c => ({ ...c, __grade: this.getChordGradeScore(c, baseChord, scaleNotes) }));
-            console.log(`   Total candidates before grade filter: ${candidates.length}`);
-            candidates = candidates.filter(c => c.__grade === targetGrade);
-            console.log(`   After exact grade filter (=${targetGrade}): ${candidates.length}`);
+            let candidates = allCandidates.filter(c => c.__grade === targetGrade);
 
             if (candidates.length === 0) {
                 // If no exact match, try adjacent grades (one above or below)
-                const allCandidates = this.musicTheory.findAllContainerChords(notes, scaleNotes).map(c => ({ ...c, __grade: this.getChordGradeScore(c, baseChord, scaleNotes) }));
                 for (let offset of [1, -1, 2, -2]) {
                     const fallbackGrade = targetGrade + offset;
                     if (fallbackGrade >= 0 && fallbackGrade <= 4) {
                         const fallback = allCandidates.filter(c => c.__grade === fallbackGrade);
                         if (fallback.length > 0) {
                             candidates = fallback;
-                            console.log(`   Fallback to grade ${fallbackGrade}: ${candidates.length}`);
                             break;
                         }
                     }
@@ -1360,7 +1661,7 @@ class ProgressionBuilder {
                 }).join('')}
             </div>
             <div class="pb-progression-controls">
-                <button class="btn btn-secondary pb-suggest-alternatives" title="Suggest alternatives for low-tier chords">
+                <button class="btn btn-secondary pb-suggest-alternatives" title="Sample alternative progressions and suggest fixes for low-tier chords">
                     ✨ Suggest Alternatives
                 </button>
                 <button class="btn btn-secondary pb-show-analysis" title="Show grading analysis">
@@ -1903,9 +2204,13 @@ class ProgressionBuilder {
     }
 
     /**
-     * Suggest alternatives for low-tier chords in the progression
+     * Suggest alternatives: whole progressions sampled in one batch from the candidate table,
+     * plus per-chord replacements for low-tier chords in the current progression
      */
     suggestProgressionAlternatives() {
+        const progressions = this.generateAlternativeProgressions(ProgressionBuilder.ALTERNATIVE_BATCH_SIZE)
+            .filter(alt => alt.progression.join(' ') !== this.state.currentProgression.join(' '))
+            .slice(0, ProgressionBuilder.ALTERNATIVES_SHOWN);
         const lowTierChords = [];
         
         // Find chords with low grading tiers (0-1)
@@ -1936,13 +2241,13 @@ class ProgressionBuilder {
             }
         });
         
-        if (lowTierChords.length === 0) {
+        if (lowTierChords.length === 0 && progressions.length === 0) {
             alert('No low-tier chords found that need alternatives. All chords are already well-graded!');
             return;
         }
         
         // Show alternatives in a modal or panel
-        this.showAlternativesPanel(lowTierChords);
+        this.showAlternativesPanel(lowTierChords, progressions);
     }
 
     /**
@@ -1983,18 +2288,41 @@ class ProgressionBuilder {
     /**
      * Show alternatives panel for low-tier chords
      */
-    showAlternativesPanel(lowTierChords) {
+    showAlternativesPanel(lowTierChords, progressions = []) {
         const panel = this.container.querySelector('#pb-sub-panel');
         const content = this.container.querySelector('#pb-sub-content');
         if (!panel || !content) return;
+        const all = this.state.alternativeProgressions || [];
 
         content.innerHTML = `
+            ${progressions.length ? `
+                <div style="margin-bottom: 12px;">
+                    <strong>Alternative Progressions</strong>
+                    <div style="font-size: 0.85rem; color: var(--text-secondary); margin-top: 4px;">
+                        Closest of ${all.length} sampled for the current numbers:
+                    </div>
+                </div>
+                <div style="display: grid; gap: 6px; margin-bottom: 16px;">
+                    ${progressions.map(alt => `
+                        <button class="pb-alt-progression" data-alt-index="${all.indexOf(alt)}"
+                                style="padding: 6px 8px; border: 1px solid var(--border-color); border-radius: 4px;
+                                       background: var(--background-color); cursor: pointer; text-align: left;">
+                            <div style="display: flex; justify-content: space-between; gap: 8px;">
+                                <span style="font-weight: 600;">${alt.progression.join(' – ')}</span>
+                                <span style="color: var(--text-secondary); font-size: 0.8rem;">±${alt.gradeDistance.toFixed(1)}</span>
+                            </div>
+                        </button>
+                    `).join('')}
+                </div>
+            ` : ''}
+            ${lowTierChords.length ? `
             <div style="margin-bottom: 12px;">
                 <strong>Alternative Suggestions</strong>
                 <div style="font-size: 0.85rem; color: var(--text-secondary); margin-top: 4px;">
                     Found ${lowTierChords.length} low-tier chord(s) that could be improved:
                 </div>
             </div>
+            ` : ''}
             ${lowTierChords.map(item => `
                 <div style="margin-bottom: 16px; padding: 12px; border: 1px solid var(--border-color); border-radius: 4px;">
                     <div style="font-weight: 600; margin-bottom: 8px;">
@@ -2028,6 +2356,14 @@ class ProgressionBuilder {
             `).join('')}
         `;
 
+        content.querySelectorAll('.pb-alt-progression').forEach(btn => {
+            btn.addEventListener('click', () => {
+                if (this.useAlternativeProgression(parseInt(btn.getAttribute('data-alt-index'), 10))) {
+                    panel.style.display = 'none';
+                }
+            });
+        });
+
         // Wire up alternative selection
         content.querySelectorAll('.pb-alt-option').forEach(btn => {
             btn.addEventListener('click', () => {
@@ -2134,6 +2470,9 @@ class ProgressionBuilder {
     }
 }
 
+ProgressionBuilder.ALTERNATIVE_BATCH_SIZE = 100; // progressions sampled per Suggest Alternatives click
+ProgressionBuilder.ALTERNATIVES_SHOWN = 8;
+
 // Export for module usage
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = ProgressionBuilder;
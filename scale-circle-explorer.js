@@ -8,6 +8,7 @@
  * @feature Chord progression visualization
  * @feature Integration with scale library
  * @feature Real-time updates
+ * @feature Layered canvas (cached ring/labels bitmaps, highlight layer) with angular O(1) hit-testing
  */
 
 class ScaleCircleExplorer {
@@ -273,6 +274,20 @@ class ScaleCircleExplorer {
         this.containerElement = container;
         this.render();
         this.setupResizeObserver();
+        this._observeTheme();
+    }
+
+    /**
+     * Repaint when the page theme changes (cached layers are keyed on resolved colors)
+     */
+    _observeTheme() {
+        if (this._themeObserver || typeof MutationObserver === 'undefined' || !document.body) return;
+        this._themeObserver = new MutationObserver(() => {
+            if (this.containerElement && this.containerElement.querySelector('#circle-canvas')) {
+                this.renderCircleCanvas();
+            }
+        });
+        this._themeObserver.observe(document.body, { attributes: true, attributeFilter: ['data-theme', 'class'] });
     }
 
     /**
@@ -1298,13 +1313,11 @@ class ScaleCircleExplorer {
     }
 
     /**
-     * Render circle on canvas
+     * Resolve theme-aware colors from the wrapper or container.
+     * Cached between renders; invalidated when the page theme changes.
      */
-    renderCircleCanvas() {
-        const canvas = this.containerElement.querySelector('#circle-canvas');
-        if (!canvas) return;
-        const ctx = canvas.getContext('2d');
-        // Resolve theme-aware colors from the wrapper or container
+    _circleTheme(refresh = true) {
+        if (this._theme && !refresh) return this._theme;
         const cssRoot = this.containerElement.querySelector('.scale-circle-modern-wrapper') || this.containerElement;
         const cs = window.getComputedStyle(cssRoot);
         const getColor = (prop, fallback) => {
@@ -1312,216 +1325,268 @@ class ScaleCircleExplorer {
             if (v && v.trim()) return v.trim();
             return fallback;
         };
-        const hexToRgba = (hex, a) => {
-            if (!hex) return `rgba(255,255,255,${a})`;
-            hex = hex.trim();
-            if (hex.startsWith('rgb')) {
-                return hex.replace('rgb(', 'rgba(').replace(')', `, ${a})`);
-            }
-            if (hex[0] === '#') {
-                const h = hex.substring(1);
-                const bigint = parseInt(h.length === 3 ? h.split('').map(ch => ch+ch).join('') : h, 16);
-                const r = (bigint >> 16) & 255;
-                const g = (bigint >> 8) & 255;
-                const b = bigint & 255;
-                return `rgba(${r}, ${g}, ${b}, ${a})`;
-            }
-            return hex;
+        const colors = {
+            border: getColor('--color-border', '#6b7280'),
+            textPrimary: getColor('--color-text-primary', '#ffffff'),
+            textSecondary: getColor('--color-text-secondary', '#cbd5e1'),
+            textMuted: getColor('--color-text-muted', '#6b7280'),
+            accent: getColor('--color-accent', '#3b82f6'),
+            accentSecondary: getColor('--color-accent-secondary', '#10b981'),
+            warning: getColor('--color-warning', '#f59e0b')
         };
-        const colorBorder = getColor('--color-border', '#6b7280');
-        const colorTextPrimary = getColor('--color-text-primary', '#ffffff');
-        const colorTextSecondary = getColor('--color-text-secondary', '#cbd5e1');
-        const colorTextMuted = getColor('--color-text-muted', '#6b7280');
-        const colorAccent = getColor('--color-accent', '#3b82f6');
-        const colorAccentSecondary = getColor('--color-accent-secondary', '#10b981');
-        const colorWarning = getColor('--color-warning', '#f59e0b');
+        colors.key = Object.values(colors).join('|');
+        this._theme = colors;
+        return colors;
+    }
+
+    _hexToRgba(hex, a) {
+        if (!hex) return `rgba(255,255,255,${a})`;
+        hex = hex.trim();
+        if (hex.startsWith('rgb')) {
+            return hex.replace('rgb(', 'rgba(').replace(')', `, ${a})`);
+        }
+        if (hex[0] === '#') {
+            const h = hex.substring(1);
+            const bigint = parseInt(h.length === 3 ? h.split('').map(ch => ch+ch).join('') : h, 16);
+            const r = (bigint >> 16) & 255;
+            const g = (bigint >> 8) & 255;
+            const b = bigint & 255;
+            return `rgba(${r}, ${g}, ${b}, ${a})`;
+        }
+        return hex;
+    }
+
+    /**
+     * Key point coordinates for the current canvas size and key order.
+     * Doubles as the hit-test table: keys sit evenly on one circle, so the nearest
+     * key to any point is the one nearest in angle.
+     */
+    _circleGeometry(canvas) {
+        const keyOrder = this.getKeyOrder();
+        const key = `${canvas.width}x${canvas.height}:${keyOrder.join(',')}`;
+        if (this._geometry && this._geometry.key === key) return this._geometry;
+
+        const keyPositions = this.getKeyPositions();
+        const keys = Object.keys(keyPositions);
         const centerX = canvas.width / 2;
         const centerY = canvas.height / 2;
         const radius = Math.min(centerX, centerY) * 0.8;
-        
-        // Clear canvas
-        ctx.clearRect(0, 0, canvas.width, canvas.height);
-        
-        // Draw circle
-        ctx.beginPath();
-        ctx.arc(centerX, centerY, radius, 0, 2 * Math.PI);
-        ctx.strokeStyle = colorBorder;
-        ctx.lineWidth = 2;
-        ctx.stroke();
-        
-        const keyPositions = this.getKeyPositions();
-        const keys = Object.keys(keyPositions);
-        
-        // Draw connecting lines for circle of fifths/fourths
-        if (this.state.mode !== 'chromatic') {
-            ctx.beginPath();
-            keys.forEach((key, i) => {
-                const nextKey = keys[(i + 1) % keys.length];
-                const pos1 = keyPositions[key];
-                const pos2 = keyPositions[nextKey];
-                
-                const x1 = centerX + radius * pos1.distance * Math.cos(pos1.angle - Math.PI/2);
-                const y1 = centerY + radius * pos1.distance * Math.sin(pos1.angle - Math.PI/2);
-                const x2 = centerX + radius * pos2.distance * Math.cos(pos2.angle - Math.PI/2);
-                const y2 = centerY + radius * pos2.distance * Math.sin(pos2.angle - Math.PI/2);
-                
-                if (i === 0) {
-                    ctx.moveTo(x1, y1);
-                }
-                ctx.lineTo(x2, y2);
-            });
-            ctx.strokeStyle = hexToRgba(colorTextPrimary, 0.22);
-            ctx.lineWidth = 1;
-            ctx.stroke();
-        }
-        
-        // Draw scale lines
-        if (this.state.showScaleLines && this.state.scaleNotes && this.state.scaleNotes.length > 0) {
-            ctx.beginPath();
-            
-            // Get scale notes in diatonic order (1-2-3-4-5-6-7)
-            const scaleNoteOrder = this.state.scaleNotes; // Already in diatonic order
-            
-            // Find positions of scale notes IN DIATONIC ORDER (with enharmonic matching)
-            const scalePositions = [];
-            scaleNoteOrder.forEach(note => {
-                const pos = this.findKeyPosition(note, keyPositions);
-                if (pos) {
-                    const x = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
-                    const y = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
-                    scalePositions.push({x, y, note});
-                }
-            });
-            
-            // Draw connecting lines in scale order
-            if (scalePositions.length > 1) {
-                ctx.beginPath();
-                ctx.moveTo(scalePositions[0].x, scalePositions[0].y);
-                
-                for (let i = 1; i < scalePositions.length; i++) {
-                    ctx.lineTo(scalePositions[i].x, scalePositions[i].y);
-                }
-                
-                // Close back to root
-                ctx.lineTo(scalePositions[0].x, scalePositions[0].y);
-                
-                ctx.strokeStyle = hexToRgba(colorAccentSecondary, 0.6);
-                ctx.lineWidth = 2;
-                ctx.stroke();
-            }
-        }
-        
-        // Draw keys
-        let hoverHit = null;
-        keys.forEach(key => {
-            const pos = keyPositions[key];
-            const x = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
-            const y = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
-            
-            // Determine highlight type (using enharmonic-aware checks)
-            let highlightType = 'none';
-            const isInScale = this.isNoteInScale(key);
-            const isGenerated = this.isNoteGenerated(key);
-            
-            if (isInScale) {
-                highlightType = 'scale';
+        const points = new Float64Array(keys.length * 2);
+        keys.forEach((k, i) => {
+            const pos = keyPositions[k];
+            points[i * 2] = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
+            points[i * 2 + 1] = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
+        });
+        this._geometry = { key, keys, keyPositions, points, centerX, centerY, radius, step: (2 * Math.PI) / keys.length };
+        return this._geometry;
+    }
+
+    /**
+     * Index of the key nearest (x, y): one atan2, no scan over keys
+     */
+    _keyIndexAt(geom, x, y) {
+        // Keys start at 12 o'clock and run clockwise
+        let angle = Math.atan2(y - geom.centerY, x - geom.centerX) + Math.PI / 2;
+        if (angle < 0) angle += 2 * Math.PI;
+        return Math.round(angle / geom.step) % geom.keys.length;
+    }
+
+    _displayKeyFor(key) {
+        // Handle enharmonic equivalents based on current key signature
+        let displayKey = key;
+
+        // Only show alternative enharmonics when they make sense for the current key
+        if (this.state.currentKey && this.musicTheory.keySignatures[this.state.currentKey]) {
+            const currentKeySig = this.musicTheory.keySignatures[this.state.currentKey];
+
+            // For fifths mode, prefer the enharmonic that matches the key signature
+            if (this.state.mode === 'fifths') {
+                if (key === 'Db' && currentKeySig.type === 'sharp') displayKey = 'C#';
+                if (key === 'C#' && currentKeySig.type === 'flat') displayKey = 'Db';
+                if (key === 'Gb' && currentKeySig.type === 'sharp') displayKey = 'F#';
+                if (key === 'F#' && currentKeySig.type === 'flat') displayKey = 'Gb';
             }
-            if (isGenerated) {
-                highlightType = 'numbers';
+
+            // For fourths mode, prefer the enharmonic that matches the key signature
+            if (this.state.mode === 'fourths') {
+                if (key === 'B' && currentKeySig.type === 'sharp') displayKey = 'Cb';
+                if (key === 'Cb' && currentKeySig.type === 'flat') displayKey = 'B';
+                if (key === 'E' && currentKeySig.type === 'sharp') displayKey = 'Fb';
+                if (key === 'Fb' && currentKeySig.type === 'flat') displayKey = 'E';
             }
-            if (isInScale && isGenerated) {
-                highlightType = 'both';
+        } else {
+            // Fallback to original logic
+            if (key === 'Db' && this.state.mode === 'fifths') displayKey = 'C#';
+            if (key === 'Gb' && this.state.mode === 'fourths') displayKey = 'F#';
+        }
+        return displayKey;
+    }
+
+    /**
+     * Offscreen bitmap for one layer, redrawn only when its key changes
+     */
+    _circleLayer(name, key, width, height, draw) {
+        if (!this._layers) this._layers = {};
+        let layer = this._layers[name];
+        if (!layer || layer.canvas.width !== width || layer.canvas.height !== height) {
+            let canvas = null;
+            if (typeof OffscreenCanvas !== 'undefined') {
+                canvas = new OffscreenCanvas(width, height);
+            } else {
+                canvas = document.createElement('canvas');
+                canvas.width = width;
+                canvas.height = height;
             }
-            
-            // Removed highlight rings for scale and generated notes.
-            // Only the current key will have a ring drawn below.
-            
-            // Detect hover hit area (15px radius)
-            if (this._lastMouse) {
-                const dx = this._lastMouse.x - x;
-                const dy = this._lastMouse.y - y;
-                const dist = Math.sqrt(dx*dx + dy*dy);
-                if (dist <= 16) hoverHit = key;
+            const ctx = canvas.getContext('2d');
+            if (!ctx) return null;
+            layer = this._layers[name] = { canvas, ctx, key: null };
+        }
+        if (layer.key !== key) {
+            layer.ctx.clearRect(0, 0, width, height);
+            draw(layer.ctx);
+            layer.key = key;
+        }
+        return layer.canvas;
+    }
+
+    /**
+     * Render circle on canvas.
+     * Layers, bottom to top: ring + key-order lines (rebuilt on resize/mode/theme),
+     * highlights (scale polygon, key points, current key; rebuilt on state changes),
+     * labels (rebuilt on resize/mode/key signature/theme), then the hover ring drawn live.
+     * @param {Object} options - { hoverOnly } reuse the cached theme (hover/leave repaints)
+     */
+    renderCircleCanvas(options = {}) {
+        const canvas = this.containerElement.querySelector('#circle-canvas');
+        if (!canvas) return;
+        const ctx = canvas.getContext('2d');
+        const theme = this._circleTheme(!options.hoverOnly);
+        const geom = this._circleGeometry(canvas);
+        const { keys, keyPositions, points, centerX, centerY, radius } = geom;
+        const width = canvas.width;
+        const height = canvas.height;
+
+        const ring = this._circleLayer('ring', `${geom.key}:${this.state.mode}:${theme.key}`, width, height, (lctx) => {
+            // Draw circle
+            lctx.beginPath();
+            lctx.arc(centerX, centerY, radius, 0, 2 * Math.PI);
+            lctx.strokeStyle = theme.border;
+            lctx.lineWidth = 2;
+            lctx.stroke();
+
+            // Draw connecting lines for circle of fifths/fourths
+            if (this.state.mode !== 'chromatic') {
+                lctx.beginPath();
+                keys.forEach((key, i) => {
+                    const next = (i + 1) % keys.length;
+                    if (i === 0) {
+                        lctx.moveTo(points[i * 2], points[i * 2 + 1]);
+                    }
+                    lctx.lineTo(points[next * 2], points[next * 2 + 1]);
+                });
+                lctx.strokeStyle = this._hexToRgba(theme.textPrimary, 0.22);
+                lctx.lineWidth = 1;
+                lctx.stroke();
             }
+        });
 
-            // Draw key point
-            ctx.beginPath();
-            ctx.arc(x, y, 12, 0, 2 * Math.PI);
-            ctx.fillStyle = this.state.highlightedKeys.includes(key) ? colorWarning : 
-                            (this.isNoteInScale(key)) ? colorAccentSecondary : colorTextMuted;
-            ctx.fill();
-            
-            // Draw key label with improved contrast and size
-            ctx.fillStyle = colorTextPrimary;
-            ctx.font = 'bold 16px Arial';
-            ctx.textAlign = 'center';
-            ctx.textBaseline = 'middle';
-            // Add subtle dark stroke for readability over complex backgrounds
-            ctx.lineWidth = 3;
-            ctx.strokeStyle = 'rgba(0,0,0,0.75)';
-            
-            // Handle enharmonic equivalents based on current key signature
-            let displayKey = key;
-            
-            // Only show alternative enharmonics when they make sense for the current key
-            if (this.state.currentKey && this.musicTheory.keySignatures[this.state.currentKey]) {
-                const currentKeySig = this.musicTheory.keySignatures[this.state.currentKey];
-                
-                // For fifths mode, prefer the enharmonic that matches the key signature
-                if (this.state.mode === 'fifths') {
-                    if (key === 'Db' && currentKeySig.type === 'sharp') displayKey = 'C#';
-                    if (key === 'C#' && currentKeySig.type === 'flat') displayKey = 'Db';
-                    if (key === 'Gb' && currentKeySig.type === 'sharp') displayKey = 'F#';
-                    if (key === 'F#' && currentKeySig.type === 'flat') displayKey = 'Gb';
-                }
-                
-                // For fourths mode, prefer the enharmonic that matches the key signature
-                if (this.state.mode === 'fourths') {
-                    if (key === 'B' && currentKeySig.type === 'sharp') displayKey = 'Cb';
-                    if (key === 'Cb' && currentKeySig.type === 'flat') displayKey = 'B';
-                    if (key === 'E' && currentKeySig.type === 'sharp') displayKey = 'Fb';
-                    if (key === 'Fb' && currentKeySig.type === 'flat') displayKey = 'E';
+        const highlightKey = JSON.stringify([
+            geom.key, theme.key, this.state.currentKey, this.state.showScaleLines,
+            this.state.scaleNotes, this.state.generatedNotes, this.state.highlightedKeys
+        ]);
+        const highlights = this._circleLayer('highlights', highlightKey, width, height, (lctx) => {
+            // Draw scale lines
+            if (this.state.showScaleLines && this.state.scaleNotes && this.state.scaleNotes.length > 0) {
+                // Find positions of scale notes IN DIATONIC ORDER (with enharmonic matching)
+                const scalePositions = [];
+                this.state.scaleNotes.forEach(note => {
+                    const pos = this.findKeyPosition(note, keyPositions);
+                    if (pos) {
+                        const x = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
+                        const y = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
+                        scalePositions.push({x, y, note});
+                    }
+                });
+
+                // Draw connecting lines in scale order
+                if (scalePositions.length > 1) {
+                    lctx.beginPath();
+                    lctx.moveTo(scalePositions[0].x, scalePositions[0].y);
+                    for (let i = 1; i < scalePositions.length; i++) {
+                        lctx.lineTo(scalePositions[i].x, scalePositions[i].y);
+                    }
+                    // Close back to root
+                    lctx.lineTo(scalePositions[0].x, scalePositions[0].y);
+                    lctx.strokeStyle = this._hexToRgba(theme.accentSecondary, 0.6);
+                    lctx.lineWidth = 2;
+                    lctx.stroke();
                 }
-            } else {
-                // Fallback to original logic
-                if (key === 'Db' && this.state.mode === 'fifths') displayKey = 'C#';
-                if (key === 'Gb' && this.state.mode === 'fourths') displayKey = 'F#';
-            }
-            
-            ctx.strokeText(displayKey, x, y);
-            ctx.fillText(displayKey, x, y);
-            
-            // Draw dice emoji for generated notes
-            if (this.isNoteGenerated(key)) {
-                ctx.font = '20px Arial';
-                ctx.fillText('🎲', x + 15, y - 15);
             }
-            
-            // Hover ring for hovered key
-            if (this.state.hoveredKey === key) {
-                ctx.beginPath();
-                ctx.arc(x, y, 18, 0, 2 * Math.PI);
-                ctx.strokeStyle = colorAccent;
-                ctx.lineWidth = 2;
-                ctx.stroke();
+
+            // Draw key points (only the current key gets a ring)
+            keys.forEach((key, i) => {
+                const x = points[i * 2];
+                const y = points[i * 2 + 1];
+                lctx.beginPath();
+                lctx.arc(x, y, 12, 0, 2 * Math.PI);
+                lctx.fillStyle = this.state.highlightedKeys.includes(key) ? theme.warning :
+                                (this.isNoteInScale(key)) ? theme.accentSecondary : theme.textMuted;
+                lctx.fill();
+
+                // Draw dice emoji for generated notes
+                if (this.isNoteGenerated(key)) {
+                    lctx.fillStyle = theme.textPrimary;
+                    lctx.font = '20px Arial';
+                    lctx.textAlign = 'center';
+                    lctx.textBaseline = 'middle';
+                    lctx.fillText('🎲', x + 15, y - 15);
+                }
+            });
+
+            // Highlight current key (only one ring, red/orange)
+            const currentKeyIndex = keys.indexOf(this.state.currentKey);
+            if (currentKeyIndex !== -1) {
+                lctx.beginPath();
+                lctx.arc(points[currentKeyIndex * 2], points[currentKeyIndex * 2 + 1], 15, 0, 2 * Math.PI);
+                lctx.strokeStyle = theme.warning;
+                lctx.lineWidth = 3;
+                lctx.stroke();
             }
         });
-        // Update cursor based on hover
-        canvas.style.cursor = hoverHit ? 'pointer' : 'default';
-        
-        // Highlight current key (only one ring, red/orange)
-        const currentKeyIndex = keys.indexOf(this.state.currentKey);
-        if (currentKeyIndex !== -1) {
-            const pos = keyPositions[this.state.currentKey];
-            const x = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
-            const y = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
-            
+
+        const displayKeys = keys.map(key => this._displayKeyFor(key));
+        const labels = this._circleLayer('labels', `${geom.key}:${theme.key}:${displayKeys.join(',')}`, width, height, (lctx) => {
+            // Key labels with improved contrast and size
+            lctx.fillStyle = theme.textPrimary;
+            lctx.font = 'bold 16px Arial';
+            lctx.textAlign = 'center';
+            lctx.textBaseline = 'middle';
+            // Add subtle dark stroke for readability over complex backgrounds
+            lctx.lineWidth = 3;
+            lctx.strokeStyle = 'rgba(0,0,0,0.75)';
+            displayKeys.forEach((displayKey, i) => {
+                lctx.strokeText(displayKey, points[i * 2], points[i * 2 + 1]);
+                lctx.fillText(displayKey, points[i * 2], points[i * 2 + 1]);
+            });
+        });
+
+        // Clear canvas and composite
+        ctx.clearRect(0, 0, width, height);
+        if (ring) ctx.drawImage(ring, 0, 0);
+        if (highlights) ctx.drawImage(highlights, 0, 0);
+        if (labels) ctx.drawImage(labels, 0, 0);
+
+        // Hover ring for hovered key
+        const hoverIndex = this.state.hoveredKey ? keys.indexOf(this.state.hoveredKey) : -1;
+        if (hoverIndex !== -1) {
             ctx.beginPath();
-            ctx.arc(x, y, 15, 0, 2 * Math.PI);
-            ctx.strokeStyle = colorWarning;
-            ctx.lineWidth = 3;
+            ctx.arc(points[hoverIndex * 2], points[hoverIndex * 2 + 1], 18, 0, 2 * Math.PI);
+            ctx.strokeStyle = theme.accent;
+            ctx.lineWidth = 2;
             ctx.stroke();
         }
+        // Update cursor based on hover
+        canvas.style.cursor = hoverIndex !== -1 ? 'pointer' : 'default';
     }
 
     /**
@@ -1530,29 +1595,19 @@ class ScaleCircleExplorer {
     handleCanvasClick(e) {
         const canvas = this.containerElement.querySelector('#circle-canvas');
         if (!canvas) return;
-        
+
         const rect = canvas.getBoundingClientRect();
         const x = e.clientX - rect.left;
         const y = e.clientY - rect.top;
-        
-        const centerX = canvas.width / 2;
-        const centerY = canvas.height / 2;
-        const radius = Math.min(centerX, centerY) * 0.8;
-        
+
+        const geom = this._circleGeometry(canvas);
+
         // Check if click is within circle
-        const distance = Math.sqrt(Math.pow(x - centerX, 2) + Math.pow(y - centerY, 2));
-        if (distance > radius) return;
-        
-        // Find closest key
-        const keyPositions = this.getKeyPositions();
-        const keys = Object.keys(keyPositions);
-        const angleStep = (2 * Math.PI) / keys.length;
-        const angle = Math.atan2(y - centerY, x - centerX);
-        
-        let normalizedAngle = angle < 0 ? angle + 2 * Math.PI : angle;
-        const index = Math.round(normalizedAngle / angleStep) % keys.length;
-        
-        const clickedKey = keys[index];
+        const distance = Math.hypot(x - geom.centerX, y - geom.centerY);
+        if (distance > geom.radius) return;
+
+        // Closest key by angle
+        const clickedKey = geom.keys[this._keyIndexAt(geom, x, y)];
         this.setKey(clickedKey, { emitUserEvent: true });
     }
 
@@ -1564,50 +1619,27 @@ class ScaleCircleExplorer {
         const y = e.clientY - rect.top;
         this._lastMouse = { x, y };
 
-        // Identify nearest key similar to click logic but with hit test threshold
-        const centerX = canvas.width / 2;
-        const centerY = canvas.height / 2;
-        const radius = Math.min(centerX, centerY) * 0.8;
-        const distance = Math.sqrt(Math.pow(x - centerX, 2) + Math.pow(y - centerY, 2));
-        if (distance > radius + 20) { // outside
-            this.state.hoveredKey = null;
-            this.showTooltip(null);
-            this.renderCircleCanvas();
-            return;
+        const geom = this._circleGeometry(canvas);
+        const distance = Math.hypot(x - geom.centerX, y - geom.centerY);
+        let hovered = null;
+        if (distance <= geom.radius + 20) {
+            const index = this._keyIndexAt(geom, x, y);
+            const d = Math.hypot(x - geom.points[index * 2], y - geom.points[index * 2 + 1]);
+            if (d <= 18) hovered = geom.keys[index];
         }
 
-        const keyPositions = this.getKeyPositions();
-        const keys = Object.keys(keyPositions);
-        let nearest = null;
-        let nearestDist = Infinity;
-        keys.forEach(key => {
-            const pos = keyPositions[key];
-            const kx = centerX + radius * pos.distance * Math.cos(pos.angle - Math.PI/2);
-            const ky = centerY + radius * pos.distance * Math.sin(pos.angle - Math.PI/2);
-            const d = Math.hypot(x - kx, y - ky);
-            if (d < nearestDist) { nearestDist = d; nearest = { key, x: kx, y: ky, d }; }
-        });
-
-        if (nearest && nearest.d <= 18) {
-            if (this.state.hoveredKey !== nearest.key) {
-                this.state.hoveredKey = nearest.key;
-                this.renderCircleCanvas();
-            }
-            this.showTooltip({ key: nearest.key, x, y });
-        } else {
-            if (this.state.hoveredKey) {
-                this.state.hoveredKey = null;
-                this.renderCircleCanvas();
-            }
-            this.showTooltip(null);
+        if (this.state.hoveredKey !== hovered) {
+            this.state.hoveredKey = hovered;
+            this.renderCircleCanvas({ hoverOnly: true });
         }
+        this.showTooltip(hovered ? { key: hovered, x, y } : null);
     }
 
     handleCanvasLeave() {
         this.state.hoveredKey = null;
         this._lastMouse = null;
         this.showTooltip(null);
-        this.renderCircleCanvas();
+        this.renderCircleCanvas({ hoverOnly: true });
     }
 
     showTooltip(info) {
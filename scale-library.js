@@ -21,6 +21,7 @@ class ScaleLibrary {
             currentScale: 'major',
             selectedNotes: []
         };
+        this._fallbackTaxonomy = null; // { signature, taxonomy } memo for getTaxonomyMeta
 
         // A lightweight stack so generation systems can temporarily borrow/modulate
         // without permanently mutating the global UI selection.
@@ -257,12 +258,21 @@ class ScaleLibrary {
         return categories[category] || [];
     }
 
+    /**
+     * Catalog taxonomy (built by the scale loader, or restored from the derived-index snapshot).
+     * Without one, the fallback derived from the categories is built once per category set.
+     */
     getTaxonomyMeta() {
         const taxonomy = this.musicTheory?.scalesMeta?.taxonomy;
         if (taxonomy && taxonomy.byFamily && taxonomy.byScale) {
             return taxonomy;
         }
-        return this.buildFallbackTaxonomy();
+        const categories = this.getScaleCategories() || {};
+        const signature = JSON.stringify(categories);
+        if (!this._fallbackTaxonomy || this._fallbackTaxonomy.signature !== signature) {
+            this._fallbackTaxonomy = { signature, taxonomy: this.buildFallbackTaxonomy() };
+        }
+        return this._fallbackTaxonomy.taxonomy;
     }
 
     buildFallbackTaxonomy() {
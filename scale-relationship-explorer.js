@@ -63,6 +63,7 @@ class ScaleRelationshipExplorer {
         const btn = this.containerElement.querySelector('#sre-analyze-btn');
 
         if (input) {
+            input.addEventListener('input', (e) => this.handleLiveInput(e.target.value));
             input.addEventListener('change', (e) => this.handleInput(e.target.value));
             input.addEventListener('keydown', (e) => {
                 if (e.key === 'Enter') this.handleInput(e.target.value);
@@ -92,6 +93,20 @@ class ScaleRelationshipExplorer {
         }
     }
 
+    /**
+     * Keystroke path: re-analyze and patch only the results panel so the input keeps focus
+     */
+    handleLiveInput(value) {
+        this.state.inputChord = value;
+        this.analyzeChord(value);
+        const results = this.containerElement ? this.containerElement.querySelector('#sre-results') : null;
+        if (!results) return;
+        results.innerHTML = this.renderResults();
+        this.bindFilterEvents();
+        this.bindApplyScaleEvents();
+        this.bindPreviewEvents();
+    }
+
     analyzeChord(chordStr) {
         if (!chordStr) {
             this.state.parsedChord = null;
@@ -147,107 +162,198 @@ class ScaleRelationshipExplorer {
         return null;
     }
 
+    /**
+     * Complexity score used for ordering (lower = more common)
+     */
+    getScaleComplexity(scaleName) {
+        const name = String(scaleName).toLowerCase();
+        if (name === 'major' || name === 'minor') return 1;
+        if (['dorian', 'phrygian', 'lydian', 'mixolydian', 'aeolian', 'locrian'].includes(name)) return 2;
+        if (name.includes('pentatonic') || name.includes('blues')) return 3;
+        if (name.includes('harmonic') || name.includes('melodic')) return 4;
+        if (name.includes('bebop') || name.includes('diminished') || name.includes('whole')) return 5;
+        return 10;
+    }
+
+    /**
+     * Relationship tier from the interval (semitones) between chord root and scale root
+     */
+    getRelationshipTier(interval) {
+        if (interval === 0) return { tier: 1, label: 'Tonic' };
+        if (interval === 7) return { tier: 2, label: 'Dominant' };
+        if (interval === 5) return { tier: 3, label: 'Subdominant' };
+        if ([3, 4, 8, 9].includes(interval)) return { tier: 4, label: 'Mediant' };
+        return { tier: 5, label: 'Related' };
+    }
+
+    /**
+     * Build (or reuse) the transposition-invariant containment index.
+     * Each scale type gets its pitch-class mask at all 12 roots, and types are grouped
+     * by complexity so queries can emit results already in display order.
+     * Rebuilt when the engine's scale set changes (e.g. after ensureScale).
+     */
+    getScaleIndex() {
+        const types = Object.keys(this.musicTheory.scales || {});
+        if (this._scaleIndex && this._scaleIndex.typeCount === types.length) return this._scaleIndex;
+
+        const roots = ['C', 'C#', 'D', 'D#', 'E', 'F', 'F#', 'G', 'G#', 'A', 'A#', 'B'];
+        const getVal = (n) => this.musicTheory.noteValues ? this.musicTheory.noteValues[n] : -1;
+        const rotations = new Uint16Array(types.length * 12);
+        const complexity = new Uint8Array(types.length);
+
+        types.forEach((type, t) => {
+            // Same interval source getScaleNotes uses (normalized id, major fallback)
+            const scaleId = this.musicTheory.normalizeScaleId ? this.musicTheory.normalizeScaleId(type) : type;
+            const intervals = this.musicTheory.scales[scaleId] || this.musicTheory.scales.major || [];
+            let mask = 0;
+            (Array.isArray(intervals) ? intervals : []).forEach(iv => { mask |= 1 << (((Number(iv) % 12) + 12) % 12); });
+            for (let r = 0; r < 12; r++) {
+                rotations[t * 12 + r] = ((mask << r) | (mask >>> (12 - r))) & 0xFFF;
+            }
+            complexity[t] = this.getScaleComplexity(type);
+        });
+
+        // Types per complexity rank, in engine order (stable tiebreak of the old sort)
+        const ranks = Array.from(new Set(complexity)).sort((a, b) => a - b);
+        const typesByRank = ranks.map(rank => {
+            const list = [];
+            for (let t = 0; t < types.length; t++) if (complexity[t] === rank) list.push(t);
+            return list;
+        });
+
+        const rootOrder = roots.map((root, pc) => ({ root, pc, value: getVal(root) }))
+            .sort((a, b) => a.root.localeCompare(b.root));
+
+        this._scaleIndex = {
+            typeCount: types.length,
+            types,
+            roots,
+            rootOrder,
+            rotations,
+            complexity,
+            ranks,
+            typesByRank,
+            diatonicBase: new Map()
+        };
+        this._lastContainment = null;
+        return this._scaleIndex;
+    }
+
+    /**
+     * Bitmap of (type, root) slots whose scale contains every pitch class in `mask`.
+     * When the new mask is a superset of the previous query's (typing "C" -> "Cm" -> "Cm7"),
+     * only the previous hits are re-tested.
+     */
+    _containmentFor(index, mask) {
+        const last = this._lastContainment;
+        const hits = new Uint8Array(index.rotations.length);
+        if (last && last.index === index && (mask & last.mask) === last.mask) {
+            for (let i = 0; i < hits.length; i++) {
+                if (last.hits[i] && (index.rotations[i] & mask) === mask) hits[i] = 1;
+            }
+        } else {
+            for (let i = 0; i < hits.length; i++) {
+                if ((index.rotations[i] & mask) === mask) hits[i] = 1;
+            }
+        }
+        this._lastContainment = { index, mask, hits };
+        return hits;
+    }
+
+    /**
+     * Whether the diatonic I chord of (root, scaleName) has the same base quality as chordType
+     */
+    _isDiatonicMatch(index, root, scaleName, chordType) {
+        if (!this.musicTheory || typeof this.musicTheory.getDiatonicChord !== 'function') return false;
+        const cacheKey = root + '|' + scaleName;
+        let diaBase = index.diatonicBase.get(cacheKey);
+        if (diaBase === undefined) {
+            diaBase = null;
+            try {
+                // Check if the input chord type matches the diatonic chord for degree I
+                const diatonicI = this.musicTheory.getDiatonicChord(1, root, scaleName);
+                if (diatonicI && diatonicI.chordType) {
+                    // Normalize: strip numeric suffixes for comparison
+                    diaBase = String(diatonicI.chordType).toLowerCase().replace(/[0-9]/g, '').replace(/maj/, 'major').replace(/min/, 'm');
+                }
+            } catch (e) {
+                // If engine lookup fails, fall back to just "contains all notes" logic
+            }
+            index.diatonicBase.set(cacheKey, diaBase);
+        }
+        if (diaBase === null) return false;
+        // Exact match or close match (e.g., 'maj' matches 'maj7', 'maj9', etc.)
+        const inpBase = String(chordType).toLowerCase().replace(/[0-9]/g, '').replace(/maj/, 'major').replace(/min/, 'm');
+        return diaBase === inpBase;
+    }
+
     findContainingScales(chordNotes) {
-        const allScales = this.getAllScales(); 
+        const index = this.getScaleIndex();
         const containing = [];
+        const diatonicMatches = [];
 
         // Use engine's note values if available, otherwise fallback
         const getVal = (n) => this.musicTheory.noteValues ? this.musicTheory.noteValues[n] : -1;
-        const chordSemis = chordNotes.map(n => getVal(n));
+        let chordMask = 0;
+        chordNotes.forEach(n => {
+            const v = getVal(n);
+            if (v !== undefined && v >= 0) chordMask |= 1 << (v % 12);
+        });
         
         // Get root value for sorting (handle enharmonics)
         const chordRootVal = this.state.parsedChord ? getVal(this.state.parsedChord.root) : -1;
         const parsedChordRoot = this.state.parsedChord ? this.state.parsedChord.root : null;
         const parsedChordType = this.state.parsedChord ? this.state.parsedChord.type : null;
 
-        allScales.forEach(scale => {
-            // Filter: Must have a link/citation to be shown
-            const citation = this.musicTheory.scaleCitations ? this.musicTheory.scaleCitations[scale.name] : null;
+        // Filter: Must have a link/citation to be shown (citations can arrive after the index is built)
+        const citations = this.musicTheory.scaleCitations || {};
+        const citationFor = index.types.map(type => {
+            const citation = citations[type];
             const hasLink = citation && (citation.url || (citation.references && citation.references.length > 0));
-            
-            if (!hasLink) return;
+            return hasLink ? citation : null;
+        });
+        if (!citationFor.some(Boolean)) {
+            this.state.containingScales = [];
+            return;
+        }
 
-            const scaleNotes = this.musicTheory.getScaleNotes(scale.root, scale.name);
-            const scaleSemis = scaleNotes.map(n => getVal(n));
-            
-            // Check if all chord notes are in scale
-            const allIn = chordSemis.every(cSemi => scaleSemis.includes(cSemi));
-            
-            if (allIn) {
-                // Determine match quality: exact (diatonic) vs. just "contains notes"
-                // Exact matches will be prioritized in sorting
-                let isDiatonicMatch = false;
-                if (this.musicTheory && typeof this.musicTheory.getDiatonicChord === 'function' && 
-                    scale.root === parsedChordRoot && parsedChordType) {
-                    try {
-                        // Check if the input chord type matches the diatonic chord for degree I
-                        const diatonicI = this.musicTheory.getDiatonicChord(1, scale.root, scale.name);
-                        if (diatonicI && diatonicI.chordType) {
-                            // Exact match or close match (e.g., 'maj' matches 'maj7', 'maj9', etc.)
-                            const diaCT = String(diatonicI.chordType).toLowerCase();
-                            const inpCT = String(parsedChordType).toLowerCase();
-                            // Normalize: strip numeric suffixes for comparison
-                            const diaBase = diaCT.replace(/[0-9]/g, '').replace(/maj/, 'major').replace(/min/, 'm');
-                            const inpBase = inpCT.replace(/[0-9]/g, '').replace(/maj/, 'major').replace(/min/, 'm');
-                            isDiatonicMatch = diaBase === inpBase;
-                        }
-                    } catch (e) {
-                        // If engine lookup fails, fall back to just "contains all notes" logic
-                    }
-                }
-                // Calculate complexity score
-                let complexity = 10;
-                const name = scale.name.toLowerCase();
-                if (name === 'major' || name === 'minor') complexity = 1;
-                else if (['dorian', 'phrygian', 'lydian', 'mixolydian', 'aeolian', 'locrian'].includes(name)) complexity = 2;
-                else if (name.includes('pentatonic') || name.includes('blues')) complexity = 3;
-                else if (name.includes('harmonic') || name.includes('melodic')) complexity = 4;
-                else if (name.includes('bebop') || name.includes('diminished') || name.includes('whole')) complexity = 5;
-                
-                // Calculate relationship tier based on interval from chord root to scale root
-                const scaleRootVal = getVal(scale.root);
-                const interval = (scaleRootVal - chordRootVal + 12) % 12;
-                
-                let relationshipTier = 5; // Default (Other)
-                let relationshipLabel = 'Related';
-
-                if (interval === 0) {
-                    relationshipTier = 1; // Tonic (Same root)
-                    relationshipLabel = 'Tonic';
-                } else if (interval === 7) {
-                    relationshipTier = 2; // Dominant (Perfect 5th above)
-                    relationshipLabel = 'Dominant';
-                } else if (interval === 5) {
-                    relationshipTier = 3; // Subdominant (Perfect 4th above)
-                    relationshipLabel = 'Subdominant';
-                } else if ([3, 4, 8, 9].includes(interval)) {
-                    relationshipTier = 4; // Mediant/Relative (3rds/6ths)
-                    relationshipLabel = 'Mediant';
-                }
+        const hits = this._containmentFor(index, chordMask);
 
-                containing.push({ 
-                    ...scale, 
-                    complexity, 
-                    citation, 
-                    relationshipTier, 
-                    relationshipLabel,
-                    isDiatonicMatch  // Track whether this is an exact diatonic match
-                });
-            }
+        // Roots grouped by relationship tier, each group in root-name order
+        const tiers = [[], [], [], [], []];
+        index.rootOrder.forEach(entry => {
+            const interval = (entry.value - chordRootVal + 12) % 12;
+            const rel = this.getRelationshipTier(interval);
+            tiers[rel.tier - 1].push({ ...entry, tier: rel.tier, label: rel.label });
         });
 
-        // Sort: exact diatonic matches first, then by Relationship Tier, then Complexity, then Root
-        containing.sort((a, b) => {
-            // Prioritize exact diatonic matches (same root + matching chord type)
-            if (a.isDiatonicMatch !== b.isDiatonicMatch) {
-                return a.isDiatonicMatch ? -1 : 1;  // Diatonic matches come first
-            }
-            if (a.relationshipTier !== b.relationshipTier) return a.relationshipTier - b.relationshipTier;
-            if (a.complexity !== b.complexity) return a.complexity - b.complexity;
-            return a.root.localeCompare(b.root);
+        // Emit in display order: tier, then complexity, then root name, then engine order.
+        // Exact diatonic matches (same root + matching chord type) are pulled to the front.
+        tiers.forEach(tierRoots => {
+            index.typesByRank.forEach((typeList, rankIdx) => {
+                const complexity = index.ranks[rankIdx];
+                tierRoots.forEach(rootEntry => {
+                    typeList.forEach(t => {
+                        if (!hits[t * 12 + rootEntry.pc] || !citationFor[t]) return;
+                        const name = index.types[t];
+                        const isDiatonicMatch = rootEntry.root === parsedChordRoot && !!parsedChordType
+                            && this._isDiatonicMatch(index, rootEntry.root, name, parsedChordType);
+                        const entry = {
+                            root: rootEntry.root,
+                            name,
+                            complexity,
+                            citation: citationFor[t],
+                            relationshipTier: rootEntry.tier,
+                            relationshipLabel: rootEntry.label,
+                            isDiatonicMatch  // Track whether this is an exact diatonic match
+                        };
+                        (isDiatonicMatch ? diatonicMatches : containing).push(entry);
+                    });
+                });
+            });
         });
 
-        this.state.containingScales = containing;
+        this.state.containingScales = diatonicMatches.concat(containing);
     }
 
     getAllScales() {
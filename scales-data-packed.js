@@ -0,0 +1,8 @@
+// Generated by scripts/pack-scales.js from scales-data-embedded.js - do not edit by hand.
+window.EMBEDDED_SCALES_PACKED = {
+  "format": "mask12-v1",
+  "count": 1486,
+  "defaults": {"aiTransformed":false,"baseScale":true,"baseName":""},
+  "strings": "Major|major|Chromatic Hypodorian|chromatic_hypodorian|Dorian|dorian|Dorian +2|dorian_2|Dorian +24|dorian_24|Dorian +4|dorian_4|Dorian 2|Dorian 24|Dorian 4|Dorian 5|dorian_5|Dorian Augmented|dorian_augmented|Blues Phrygian|blues_phrygian|Chromatic Phrygian Inverse|chromatic_phrygian_inverse|Phrygian|phrygian|Phrygian 347|phrygian_347|Phrygian Hungarian Minor|phrygian_hungarian_minor|Chromatic Hypolydian|chromatic_hypolydian|Chromatic Lydian|chromatic_lydian|Chromatic Lydian Inverse|chromatic_lydian_inverse|Chromatic Mixolydian|chromatic_mixolydian|Lydian|lydian|Lydian +23|lydian_23|Lydian +32|lydian_32|Lydian 23|Lydian 236|lydian_236|Lydian 2367|lydian_2367|Lydian 3|lydian_3|Lydian 36|lydian_36|Lydian 7+2|lydian_7_2|Lydian 7+23|lydian_7_23|Lydian 7+3|lydian_7_3|Lydian 7+32|lydian_7_32|Lydian 72|lydian_72|Lydian 723|lydian_723|Lydian 7263|lydian_7263|Lydian 73|lydian_73|Lydian 732|lydian_732|Lydian 7623|lydian_7623|Lydian 7632|lydian_7632|Lydian Diminished|lydian_diminished|Lydian Harmonic Major|lydian_harmonic_major|Lydian Minor|lydian_minor|Lydian Minor 3|lydian_minor_3|Mixolydian|mixolydian|Mixolydian 5|mixolydian_5|Mixolydian 6|mixolydian_6|Mixolydian Augmented|mixolydian_augmented|Aeolian|aeolian|Locrian|locrian|Locrian 267|locrian_267|Locrian 3|locrian_3|Locrian 36|locrian_36|Locrian 367|locrian_367|Locrian 37|locrian_37|Locrian 6|locrian_6|Locrian 63|locrian_63|Locrian 67|locrian_67|Locrian 7|locrian_7|Locrian Dominant|locrian_dominant|Major Locrian|major_locrian|Major Locrian 2|major_locrian_2|Major Locrian 267|major_locrian_267|Major Locrian 27|major_locrian_27|Major Locrian 6|major_locrian_6|Major Locrian 67|major_locrian_67|Major Locrian 7|major_locrian_7|Midlocrian|midlocrian|Mixolocrian|mixolocrian|Ultralocrian|ultralocrian|Ultralocrian 3|ultralocrian_3|Ultralocrian 5|ultralocrian_5|Bebop Melodic Minor|bebop_melodic_minor|Melodic Minor|melodic_minor|Lydian Augmented|lydian_augmented|Lydian Augmented 2|lydian_augmented_2|Lydian Augmented 23|lydian_augmented_23|Lydian Augmented 3|lydian_augmented_3|Lydian Augmented Pentatonic|lydian_augmented_pentatonic|Acoustic|acoustic|Altered Major Pentatonic|altered_major_pentatonic|Altered Pentatonic|altered_pentatonic|Altered Pentatonic II|altered_pentatonic_ii|Harmonic Minor|harmonic_minor|Harmonic Minor 4|harmonic_minor_4|Harmonic Minor 5|harmonic_minor_5|Harmonic Minor Tetrachord|harmonic_minor_tetrachord|Ionian Augmented 2|ionian_augmented_2|Phrygian Dominant|phrygian_dominant|Harmonic Major|harmonic_major|Harmonic Major 5|harmonic_major_5|Byzantine|byzantine|Byzantine Minor|byzantine_minor|Double Harmonic|double_harmonic|Double Harmonic Minor|double_harmonic_minor|Hungarian Minor 2|hungarian_minor_2|Major Pentatonic|major_pentatonic|Major Pentatonic 2|major_pentatonic_2|Major Pentatonic 3|major_pentatonic_3|Major Pentatonic 79|major_pentatonic_79|Phrygian Major Pentatonic|phrygian_major_pentatonic|Common Minor Pentatonic 7|common_minor_pentatonic_7|Minor Pentatonic|minor_pentatonic|Iwato|iwato|Kyemyonjo|kyemyonjo|Aeolian Pentatonic|aeolian_pentatonic|Augmented Pentatonic|augmented_pentatonic|Augmented Pentatonic 2|augmented_pentatonic_2|Balinese Pentatonic|balinese_pentatonic|Common Pentatonic 5|common_pentatonic_5|Dominant 13 Pentatonic|dominant_13_pentatonic|Dominant Pentatonic|dominant_pentatonic|Dorian Pentatonic|dorian_pentatonic|Dorian Pentatonic 4|dorian_pentatonic_4|Dorian Pentatonic 5|dorian_pentatonic_5|Locrian Pentatonic 2|locrian_pentatonic_2|Lydian Pentatonic|lydian_pentatonic|Major 7 Augmented Pentatonic|major_7_augmented_pentatonic|Minor 6 9 Pentatonic|minor_6_9_pentatonic|Mixolydian Pentatonic|mixolydian_pentatonic|Pentatonic Chromatic|pentatonic_chromatic|Pentatonic Chromatic II|pentatonic_chromatic_ii|Pentatonic Major 25|pentatonic_major_25|Phrygian Pentatonic|phrygian_pentatonic|Phrygian Pentatonic 4|phrygian_pentatonic_4|Scottish Pentatonic|scottish_pentatonic|Blues Dorian Hexatonic|blues_dorian_hexatonic|Blues Hexatonic|blues_hexatonic|Blues Major|blues_major|Blues Minor Maj7|blues_minor_maj7|Second Blues Scale Mode V|second_blues_scale_mode_v|Third Blues Scale Mode II|third_blues_scale_mode_ii|Third Blues Scale Mode III|third_blues_scale_mode_iii|Third Blues Scale Mode V|third_blues_scale_mode_v|African-American Blues I|african_american_blues_i|African-American Blues II|african_american_blues_ii|African-American Blues III|african_american_blues_iii|Blues Enneatonic II|blues_enneatonic_ii|Blues Pentacluster|blues_pentacluster|Blues Phrygian 4|blues_phrygian_4|Blues Scale II|blues_scale_ii|Blues V|blues_v|Dorian Blues|dorian_blues|Modified Blues|modified_blues|Diminished|diminished|Half-Diminished Bebop|half_diminished_bebop|JG Octatonic|jg_octatonic|Octatonic|octatonic|Octatonic Chromatic 2|octatonic_chromatic_2|Van der Horst Octatonic|van_der_horst_octatonic|Augmented|augmented|Tritone Scale|tritone_scale|Five-Note Prometheus|five_note_prometheus|Liszt's Prometheus|liszt_s_prometheus|Prometheus Neapolitan|prometheus_neapolitan|Scriabin's Prometheus|scriabin_s_prometheus|Bebop Major|bebop_major|Bebop Minor|bebop_minor|Hijaz Major|hijaz_major|Maqam Saba Zamzam|maqam_saba_zamzam|Maqam Tarzanuyn|maqam_tarzanuyn|Spanish Octamode 4th Rotation|spanish_octamode_4th_rotation|Spanish Octamode 6th Rotation|spanish_octamode_6th_rotation|Spanish Phrygian|spanish_phrygian|Harmonic Neapolitan Minor|harmonic_neapolitan_minor|Neapolitan Maj 45|neapolitan_maj_45|Neapolitan Major|neapolitan_major|Neapolitan Major 4|neapolitan_major_4|Neapolitan Major 45|neapolitan_major_45|Neapolitan Major 5|neapolitan_major_5|Neapolitan Minor|neapolitan_minor|Neapolitan Minor 4|neapolitan_minor_4|Neapolitan Mixed|neapolitan_mixed|Enigmatic Atonal 1|enigmatic_atonal_1|ALUian|aluian|AMPian|ampian|ATOian|atoian|BOZian|bozian|Bugle|bugle|CAHian|cahian|CHOian|choian|Chord Sus2|chord_sus2|DEPian|depian|Diminished Triad|diminished_triad|Enigma Three-Tone|enigma_three_tone|GEQian|geqian|GIJian|gijian|GOCian|gocian|Hexatonic Trichord|hexatonic_trichord|Italian Sixth|italian_sixth|Karen 3 Tone Type 3|karen_3_tone_type_3|Karen 3 Tone Type 6|karen_3_tone_type_6|Lahuzu 3 Tone Type 1|lahuzu_3_tone_type_1|MODian|modian|MOPian|mopian|MOTian|motian|Major Seventh Omit 3|major_seventh_omit_3|Major Seventh Trichord|major_seventh_trichord|Major Triad|major_triad|Minor Seventh Trichord|minor_seventh_trichord|Minor Triad|minor_triad|Minor Trichord|minor_trichord|OLLian|ollian|PODian|podian|POWian|powian|Peruvian Tritonic II|peruvian_tritonic_ii|Phrygian Trichord|phrygian_trichord|Rāga Bilwadala|r_ga_bilwadala|Rāga Ongkari|r_ga_ongkari|Sansagari|sansagari|Suspended Fourth Triad|suspended_fourth_triad|Tense Fifth|tense_fifth|Tense Fourth|tense_fourth|Tense Major Sixth|tense_major_sixth|Tense Major Third|tense_major_third|Tense Minor Sixth|tense_minor_sixth|Tense Minor Third|tense_minor_third|Tritonic Chromatic|tritonic_chromatic|Tritonic Chromatic II|tritonic_chromatic_ii|Ute Tritonic|ute_tritonic|Ute Tritonic Augmented|ute_tritonic_augmented|Viennese Trichord|viennese_trichord|Vietnamese Tritonic|vietnamese_tritonic|Wholetone Trichord|wholetone_trichord|ADUian|aduian|AFUian|afuian|AGGian|aggian|AHOian|ahoian|ALKian|alkian|ALOian|aloian|APHian|aphian|ARFian|arfian|ARUian|aruian|ATTian|attian|ATUian|atuian|Aeoloric|aeoloric|Akha 4 Tone Type II|akha_4_tone_type_ii|All-Interval Tetrachord I|all_interval_tetrachord_i|All-Interval Tetrachord II|all_interval_tetrachord_ii|All-Interval Tetrachord III|all_interval_tetrachord_iii|All-Interval Tetrachord IV|all_interval_tetrachord_iv|Alternate Tetramirror|alternate_tetramirror|BABian|babian|BAFian|bafian|BAJian|bajian|BAPian|bapian|BEKian|bekian|BEMian|bemian|BOBian|bobian|BOCian|bocian|Bi Yu|bi_yu|CAJian|cajian|CEBian|cebian|CIWian|ciwian|CIXian|cixian|CUJian|cujian|Chord 7+5|chord_7_5|Chord M6|chord_m6|Chord M7+5|chord_m7_5|Chord m6|Closed Pair|closed_pair|DEBian|debian|DEGian|degian|DEHian|dehian|DEYian|deyian|DOCian|docian|DUXian|duxian|DUYian|duyian|Dalic|dalic|Diminished Major Seventh|diminished_major_seventh|Dominant Seventh|dominant_seventh|Dorian Tetrachord|dorian_tetrachord|Dream|dream|EDRian|edrian|EDWian|edwian|EMPian|empian|ESOian|esoian|ESUian|esuian|Epogic|epogic|FAHian|fahian|FEBian|febian|FOPian|fopian|GIBian|gibian|GIDian|gidian|GIKian|gikian|GISian|gisian|GIVian|givian|GIYian|giyian|GIZian|gizian|GOSian|gosian|GUWian|guwian|Genus Primum|genus_primum|Genus Primum Inverse|genus_primum_inverse|Gonic|gonic|HICian|hician|HURian|hurian|HUSian|husian|HUVian|huvian|Half-Diminished Seventh|half_diminished_seventh|IDWian|idwian|ILOian|iloian|IMSian|imsian|IPRian|iprian|Inuit Tetratonic|inuit_tetratonic|JIKian|jikian|JILian|jilian|JOCian|jocian|JONian|jonian|JOSian|josian|JUWian|juwian|KEJian|kejian|Karen 4 Tone Type 1|karen_4_tone_type_1|Karen 4 Tone Type 3|karen_4_tone_type_3|Karen 4 Tone Type 4|karen_4_tone_type_4|LAJian|lajian|Lahuzu 4 Tone Type 1|lahuzu_4_tone_type_1|Lahuzu 5 Tone Type 2|lahuzu_5_tone_type_2|Lanic|lanic|Lonic|lonic|Lothic|lothic|Lydic|lydic|MOFian|mofian|MOGian|mogian|MOQian|moqian|MORian|morian|MOVian|movian|MOWian|mowian|MOYian|moyian|MUJian|mujian|MUYian|muyian|Major 7 Chord|major_7_chord|Major 7 Chord 2|major_7_chord_2|Major Seventh|major_seventh|Major Tetrachord|major_tetrachord|Major Triad Add 4|major_triad_add_4|Messiaen Mode 5 Truncation 1|messiaen_mode_5_truncation_1|Messiaen Mode 5 Truncation 2|messiaen_mode_5_truncation_2|Messiaen Truncated Mode 6|messiaen_truncated_mode_6|Messiaen Truncated Mode 6 Inverse|messiaen_truncated_mode_6_inverse|Minor Major Seventh|minor_major_seventh|Mixolyric|mixolyric|NELian|nelian|NEMian|nemian|NIDian|nidian|NOXian|noxian|OCOian|ocoian|OCUian|ocuian|ODWian|odwian|OFFian|offian|OGOian|ogoian|OSRian|osrian|PACian|pacian|PEDian|pedian|POFian|pofian|POGian|pogian|PUJian|pujian|PUNian|punian|PUXian|puxian|Phratic|phratic|Phrygian Tetrachord|phrygian_tetrachord|Pyrric|pyrric|RUHian|ruhian|Rāga Bhavani|r_ga_bhavani|Rāga Gowleeswari|r_ga_gowleeswari|Rāga Haripriya|r_ga_haripriya|Rāga Lavangi|r_ga_lavangi|Rāga Nigamagamini|r_ga_nigamagamini|Rāga Shilangi|r_ga_shilangi|Rāga Sumukam|r_ga_sumukam|Saric|saric|Savasri Add 6|savasri_add_6|Tetratonic Chromatic|tetratonic_chromatic|Tetratonic Chromatic II|tetratonic_chromatic_ii|UDWian|udwian|Vietnamese Tetratonic|vietnamese_tetratonic|Warao Tetratonic|warao_tetratonic|Y-Cell|y_cell|1+ + 1dim|1_1dim|1+ + 2min|1_2min|1+ + 4maj|1_4maj|1+ + 6maj|1_6maj|1+ + 6min|1_6min|1dim + 2maj|1dim_2maj|1dim + 4maj|1dim_4maj|1m69|1maj + 3maj|1maj_3maj|1maj + 5+|1maj_5|1min + 6min|1min_6min|1min + 7+|1min_7|1∅ + 3m|1_3m|1∅ Add 3|1_add_3|2+ Add 2|2_add_2|2+ Add 7|2_add_7|2d + 4maj|2d_4maj|2maj + 4maj|2maj_4maj|2min + 4min|2min_4min|2min + 6min|2min_6min|2sus4 Add 2|2sus4_add_2|2∅ Add 3|2_add_3|3dim + 6maj|3dim_6maj|3maj + 5maj|3maj_5maj|3min + 4+|3min_4|4d + 6maj|4d_6maj|4m + 6d|4m_6d|4∅ Add 3|4_add_3|4∆ Add 2|4_add_2|5dom|5maj + 6min|5maj_6min|6∅ Add 7|6_add_7|75 Add 11|75_add_11|AGOian|agoian|AJUian|ajuian|ANUian|anuian|ASOian|asoian|ASRian|asrian|Aeritonic|aeritonic|Augmented 6/7|augmented_6_7|Augmented Leading Note I|augmented_leading_note_i|Augmented Leading Note II|augmented_leading_note_ii|Augmented Leading Note IV|augmented_leading_note_iv|Augmented Leading Note V|augmented_leading_note_v|Augmented Leading Note VII|augmented_leading_note_vii|Augmented Ninth Mode I|augmented_ninth_mode_i|Augmented Ninth Mode II|augmented_ninth_mode_ii|Augmented Ninth Mode IV|augmented_ninth_mode_iv|BACian|bacian|BILian|bilian|BODian|bodian|Bartók Beta Chord|bart_k_beta_chord|Bartók Gamma Chord|bart_k_gamma_chord|Centered Pentamirror|centered_pentamirror|Chaio|chaio|DABian|dabian|DEDian|dedian|Diminished Add 3|diminished_add_3|Diminished Add 5|diminished_add_5|Diminished Add 9/11 Mode I|diminished_add_9_11_mode_i|Diminished Add 9/11 Mode II|diminished_add_9_11_mode_ii|Diminished Add 9/11 Mode III|diminished_add_9_11_mode_iii|Diminished Add 9/11 Mode IV|diminished_add_9_11_mode_iv|Diminished Add 9/11 Mode V|diminished_add_9_11_mode_v|Dominant Add 4|dominant_add_4|Fifth Add 6/6/7 Mode I|fifth_add_6_6_7_mode_i|Fifth Add 6/6/7 Mode II|fifth_add_6_6_7_mode_ii|Fifth Add 6/6/7 Mode III|fifth_add_6_6_7_mode_iii|Fifth Add 6/7/7 Mode II|fifth_add_6_7_7_mode_ii|Fifth Add 6/7/7 Mode III|fifth_add_6_7_7_mode_iii|Fifth Add 6/7/7 Mode IV|fifth_add_6_7_7_mode_iv|GABian|gabian|GICian|gician|GIXian|gixian|Gyritonic|gyritonic|Han-Kumoi|han_kumoi|IGOian|igoian|Japanese Pentachord|japanese_pentachord|Kokin-Joshi|kokin_joshi|Kung|kung|LAKian|lakian|LALian|lalian|LIWian|liwian|LUKian|lukian|Locrian Pentamirror|locrian_pentamirror|Lydian Pentachord|lydian_pentachord|MOXian|moxian|MUBian|mubian|MUHian|muhian|MUKian|mukian|Major 6/6|major_6_6|Major Add 46|major_add_46|Major Add 9/11 Mode I|major_add_9_11_mode_i|Major Add 9/11 Mode II|major_add_9_11_mode_ii|Major Add 9/11 Mode III|major_add_9_11_mode_iii|Major Add 9/11 Mode IV|major_add_9_11_mode_iv|Major Add 9/11 Mode V|major_add_9_11_mode_v|Major Add 9/9 Mode I|major_add_9_9_mode_i|Major Add 9/9 Mode II|major_add_9_9_mode_ii|Major Add 9/9 Mode III|major_add_9_9_mode_iii|Major Add 9/9 Mode IV|major_add_9_9_mode_iv|Major Add 9/9 Mode V|major_add_9_9_mode_v|Minor Add 11/11 Mode I|minor_add_11_11_mode_i|Minor Add 11/11 Mode II|minor_add_11_11_mode_ii|Minor Add 11/11 Mode III|minor_add_11_11_mode_iii|Minor Add 11/11 Mode IV|minor_add_11_11_mode_iv|Minor Add 9/11 Mode I|minor_add_9_11_mode_i|Minor Add 9/11 Mode II|minor_add_9_11_mode_ii|Minor Add 9/11 Mode III|minor_add_9_11_mode_iii|Minor Add 9/11 Mode IV|minor_add_9_11_mode_iv|Minor Add 9/11 Mode V|minor_add_9_11_mode_v|Minor ∆ Add 2|minor_add_2|Mothitonic|mothitonic|Màn Gong|m_n_gong|NENian|nenian|PUHian|puhian|PUKian|pukian|Qing Yu|qing_yu|RUJian|rujian|Ryukyu|ryukyu|Rāga Abhogi|r_ga_abhogi|Rāga Audav Tukhari|r_ga_audav_tukhari|Rāga Bhinna Shadja|r_ga_bhinna_shadja|Rāga Bhupeshwari|r_ga_bhupeshwari|Rāga Budhamanohari|r_ga_budhamanohari|Rāga Chandrakauns|r_ga_chandrakauns|Rāga Chaya Todi|r_ga_chaya_todi|Rāga Chitthakarshini|r_ga_chitthakarshini|Rāga Desh|r_ga_desh|Rāga Deshgaur|r_ga_deshgaur|Rāga Devaranjani|r_ga_devaranjani|Rāga Dhavalashri|r_ga_dhavalashri|Rāga Gauri|r_ga_gauri|Rāga Girija|r_ga_girija|Rāga Guhamanohari|r_ga_guhamanohari|Rāga Gyankali|r_ga_gyankali|Rāga Hamsadhvani|r_ga_hamsadhvani|Rāga Harikauns|r_ga_harikauns|Rāga Jayakauns|r_ga_jayakauns|Rāga Khamaji Durga|r_ga_khamaji_durga|Rāga Kokil Pancham|r_ga_kokil_pancham|Rāga Kshanika|r_ga_kshanika|Rāga Kumarapriya|r_ga_kumarapriya|Rāga Kumurdaki|r_ga_kumurdaki|Rāga Kuntvarali|r_ga_kuntvarali|Rāga Lilavati|r_ga_lilavati|Rāga Mamata|r_ga_mamata|Rāga Manaranjani|r_ga_manaranjani|Rāga Mand|r_ga_mand|Rāga Marga Hindola|r_ga_marga_hindola|Rāga Matha Kokila|r_ga_matha_kokila|Rāga Megharamji|r_ga_megharamji|Rāga Megharanjani|r_ga_megharanjani|Rāga Mohanangi|r_ga_mohanangi|Rāga Multani|r_ga_multani|Rāga Nabhomani|r_ga_nabhomani|Rāga Neroshta|r_ga_neroshta|Rāga Priyadharshini|r_ga_priyadharshini|Rāga Purnalalita|r_ga_purnalalita|Rāga Puruhutika|r_ga_puruhutika|Rāga Putrika|r_ga_putrika|Rāga Ramkali 2|r_ga_ramkali_2|Rāga Rasranjani|r_ga_rasranjani|Rāga Reva|r_ga_reva|Rāga Rukmangi|r_ga_rukmangi|Rāga Samudhra Priya|r_ga_samudhra_priya|Rāga Sanjh Ka Hindol|r_ga_sanjh_ka_hindol|Rāga Shailaja|r_ga_shailaja|Rāga Shri Kalyan|r_ga_shri_kalyan|Rāga Shubravarni|r_ga_shubravarni|Rāga Vaijayanti|r_ga_vaijayanti|Rāga Valaji|r_ga_valaji|Rāga Varamu|r_ga_varamu|Rāga Yashranjani|r_ga_yashranjani|Rāga Zeelaf|r_ga_zeelaf|Sakura|sakura|Staptitonic|staptitonic|Sus 2 Add 11/11 Mode I|sus_2_add_11_11_mode_i|Sus 2 Add 11/11 Mode II|sus_2_add_11_11_mode_ii|Sus 2 Add 11/11 Mode III|sus_2_add_11_11_mode_iii|Sus 2 Add 11/11 Mode IV|sus_2_add_11_11_mode_iv|Sus 2 Add 11/13 Mode II|sus_2_add_11_13_mode_ii|Sus 2 Add 11/13 Mode IV|sus_2_add_11_13_mode_iv|Sus 2 Add 13/13 Mode I|sus_2_add_13_13_mode_i|Sus 2 Add 13/13 Mode II|sus_2_add_13_13_mode_ii|Sus 2 Add 13/13 Mode III|sus_2_add_13_13_mode_iii|Sus 2 Add 13/13 Mode IV|sus_2_add_13_13_mode_iv|Sus 2 ∆ Add 13 Mode I|sus_2_add_13_mode_i|Sus 2 ∆ Add 13 Mode III|sus_2_add_13_mode_iii|Sus 2 ∆ Add 13 Mode IV|sus_2_add_13_mode_iv|Sus 2 ∆ Add 13 Mode V|sus_2_add_13_mode_v|Sus 27 Add 13 Mode I|sus_27_add_13_mode_i|Sus 27 Add 13 Mode II|sus_27_add_13_mode_ii|Sus 27 Add 13 Mode III|sus_27_add_13_mode_iii|Sus 27 Add 13 Mode IV|sus_27_add_13_mode_iv|Sus 27 Add 13 Mode V|sus_27_add_13_mode_v|Sus 4 ∆ Add 13 Mode I|sus_4_add_13_mode_i|Sus 47 Add 13 Mode I|sus_47_add_13_mode_i|Sus4 59|sus4_59|Zilaf Mode II|zilaf_mode_ii|Zilaf Mode V|zilaf_mode_v|Zokuso|zokuso|∆ Add 2|add_2|1+ & 2MI|1_2mi|1+ & 3MI|1_3mi|1+ & 5MA|1_5ma|1+ & 5MI|1_5mi|1MA & 2+|1ma_2|1MA & 2◦|1MA & 3MI|1ma_3mi|1MA & 3SUS4|1ma_3sus4|1MA & 3◦|1ma_3|1MI & 2+|1mi_2|1MI & 2MI|1mi_2mi|1MI & 5MA|1mi_5ma|1MI & 7◦|1mi_7|1SUS4 & 2SUS4|1sus4_2sus4|1SUS4 & 3◦|1sus4_3|1SUS4 & 5MA|1sus4_5ma|1SUS4 & 5MI|1sus4_5mi|1SUS4 & 7MI|1sus4_7mi|1SUS4 & 7SUS4|1sus4_7sus4|1◦ & 3SUS4|1_3sus4|1◦ & 4◦|1_4|1◦ & 6MA|1_6ma|1◦ & 6SUS4|1_6sus4|1◦ & 7MA|1_7ma|1◦ & 7◦|1_7|2+ & 4MI|2_4mi|2+ & 6◦|2_6|2MA & 4MI|2ma_4mi|2MA & 4SUS4|2ma_4sus4|2MI & 6MA|2mi_6ma|2SUS4 & 4MI|2sus4_4mi|2SUS4 & 6MA|2sus4_6ma|3+ & 5◦|3_5|3MA & 4MA|3ma_4ma|3MA & 5◦|3ma_5|3MI & 5◦|3mi_5|3SUS4 & 5◦|3sus4_5|4MA & 3+|4ma_3|4MA & 3MI|4ma_3mi|4MA & 5MA|4ma_5ma|4MA & 5SUS4|4ma_5sus4|4MA & 6MI|4ma_6mi|4MA & 6◦|4ma_6|4MA & 7MA|4ma_7ma|4MA & 7MI|4ma_7mi|4MA & 7SUS4|4ma_7sus4|4MI & 3MI|4mi_3mi|4MI & 3◦|4mi_3|4MI & 5SUS4|4mi_5sus4|4SUS4 & 2SUS4|4sus4_2sus4|4◦ & 5◦|4_5|5SUS4 & 2MA|5sus4_2ma|5SUS4 & 5MA|5sus4_5ma|5SUS4 & 6SUS4|5sus4_6sus4|5SUS4 & 7MI|5sus4_7mi|5SUS4 & 7◦|5sus4_7|5◦ & 5◦|5_5|5◦ & 6MI|5_6mi|5◦ & 6◦|5_6|6MA & 7MA|6ma_7ma|6MA & 7◦|6ma_7|6MI & 3SUS4|6mi_3sus4|6MI & 6◦|6mi_6|6SUS4 & 6MA|6sus4_6ma|6◦ & 2MA|6_2ma|6◦ & 2MI|6_2mi|6◦ & 2SUS4|6_2sus4|6◦ & 5MA|6_5ma|6◦ & 5SUS4|6_5sus4|6◦ & 6◦|6_6|6◦ & 7◦|6_7|ARKian|arkian|AROian|aroian|ASUian|asuian|ATWian|atwian|Aeoladimic|aeoladimic|Aeolaptimic|aeolaptimic|Aeoloptimic|aeoloptimic|Aeolycrimic|aeolycrimic|Aeralimic|aeralimic|Aeraptimic|aeraptimic|Aerodimic|aerodimic|Aerothimic|aerothimic|Aerycrimic|aerycrimic|African Pentatonic 3|african_pentatonic_3|All-Trichord Hexachord|all_trichord_hexachord|BAMian|bamian|BEBian|bebian|BEDian|bedian|BEFian|befian|BEQian|beqian|BEWian|bewian|BIFian|bifian|BIHian|bihian|BIJian|bijian|BIVian|bivian|BIYian|biyian|BOMian|bomian|BOQian|boqian|Bogimic|bogimic|Bolimic|bolimic|Borimic|borimic|Bothimic|bothimic|Bygimic|bygimic|DENian|denian|Dathimic|dathimic|Docrimic|docrimic|Donimic|donimic|Dorimic|dorimic|Double Phrygian|double_phrygian|Dylimic|dylimic|Dyptimic|dyptimic|ETUian|etuian|Epagimic|epagimic|Epalimic|epalimic|Eparimic|eparimic|Epolimic|epolimic|Epytimic|epytimic|Equal Temperaments 3/4 Mixed|equal_temperaments_3_4_mixed|FOSian|fosian|GACian|gacian|GAVian|gavian|GIHian|gihian|GORian|gorian|GOWian|gowian|GOYian|goyian|GOZian|gozian|Gadimic|gadimic|Galimic|galimic|Ganimic|ganimic|Gaptimic|gaptimic|Genus Tertium|genus_tertium|Golimic|golimic|Guidonian Hexachord|guidonian_hexachord|Gynimic|gynimic|HUYian|huyian|Hawaiian|hawaiian|Hexatonic Chromatic|hexatonic_chromatic|Hexatonic Chromatic II|hexatonic_chromatic_ii|Hirajōshi Mode 1 Leading Tone|hiraj_shi_mode_1_leading_tone|Honchoshi Plagal Form|honchoshi_plagal_form|Hungarian Major No5|hungarian_major_no5|IMPian|impian|Inuit Hexatonic|inuit_hexatonic|Inuit Hexatonic II|inuit_hexatonic_ii|Ionathimic|ionathimic|Ionocrimic|ionocrimic|Ionogimic|ionogimic|Ionorimic|ionorimic|Ionothimic|ionothimic|Ionygimic|ionygimic|Ionylimic|ionylimic|Istrian|istrian|JEPian|jepian|JORian|jorian|JOWian|jowian|JOZian|jozian|KEMian|kemian|KUQian|kuqian|Kadimic|kadimic|Katagimic|katagimic|Kataptimic|kataptimic|Kathimic|kathimic|Katoptimic|katoptimic|Katothimic|katothimic|Katygimic|katygimic|Katyrimic|katyrimic|Kocrimic|kocrimic|Korimic|korimic|Kydimic|kydimic|Kynimic|kynimic|Kyptimic|kyptimic|Kytrimic|kytrimic|LAMian|lamian|LAPian|lapian|LAQian|laqian|LIXian|lixian|LOQian|loqian|LULian|lulian|LUMian|lumian|Lagimic|lagimic|Locrian 27|locrian_27|Lydian 2 Hexatonic|lydian_2_hexatonic|Lydian Hexatonic|lydian_hexatonic|Lylimic|lylimic|Lynimic|lynimic|MACian|macian|MEWian|mewian|MUMian|mumian|MURian|murian|MUTian|mutian|MUVian|muvian|Macrimic|macrimic|Malimic|malimic|Messiaen Mode 5|messiaen_mode_5|Messiaen Mode 5 Rotation 2|messiaen_mode_5_rotation_2|Minor Hexatonic|minor_hexatonic|Mixolydian Hexatonic|mixolydian_hexatonic|Mogimic|mogimic|Mycrimic|mycrimic|Mydimic|mydimic|NAFian|nafian|NAKian|nakian|NAMian|namian|NANian|nanian|NATian|natian|NECian|necian|NEFian|nefian|NEWian|newian|ODUian|oduian|PAGian|pagian|PIKian|pikian|PUMian|pumian|PURian|purian|PUTian|putian|PUVian|puvian|Panimic|panimic|Pathimic|pathimic|Phrathimic|phrathimic|Phronimic|phronimic|Phrydimic|phrydimic|Phrygian Hexatonic|phrygian_hexatonic|Phrygimic|phrygimic|Pogimic|pogimic|Pylimic|pylimic|Pynimic|pynimic|Pyramid Hexatonic|pyramid_hexatonic|RAKian|rakian|RIVian|rivian|RONian|ronian|RULian|rulian|RUNian|runian|Ralimic|ralimic|Ranimic|ranimic|Raptimic|raptimic|Ritsu|ritsu|Rynimic|rynimic|Rythimic|rythimic|Rāga Adi Bhairavi|r_ga_adi_bhairavi|Rāga Amarasenapriya|r_ga_amarasenapriya|Rāga Andhali|r_ga_andhali|Rāga Bangal Bhairav|r_ga_bangal_bhairav|Rāga Bauli|r_ga_bauli|Rāga Bhinna Pancama|r_ga_bhinna_pancama|Rāga Chandra Kalyan|r_ga_chandra_kalyan|Rāga Chandrajyoti|r_ga_chandrajyoti|Rāga Dhavalangam|r_ga_dhavalangam|Rāga Din Ki Puriya|r_ga_din_ki_puriya|Rāga Dipak|r_ga_dipak|Rāga Gandharavam|r_ga_gandharavam|Rāga Gangatarangini|r_ga_gangatarangini|Rāga Gangeshwari|r_ga_gangeshwari|Rāga Gaula|r_ga_gaula|Rāga Gauri Velavali|r_ga_gauri_velavali|Rāga Ghantana|r_ga_ghantana|Rāga Gujari Todi|r_ga_gujari_todi|Rāga Hamsa VInodini|r_ga_hamsa_vinodini|Rāga Hari Nata|r_ga_hari_nata|Rāga Hejjajji|r_ga_hejjajji|Rāga Imratkauns|r_ga_imratkauns|Rāga Jaganmohanam|r_ga_jaganmohanam|Rāga Jait|r_ga_jait|Rāga Jaiwanti|r_ga_jaiwanti|Rāga Janasamohini|r_ga_janasamohini|Rāga Jivantika|r_ga_jivantika|Rāga Jog|r_ga_jog|Rāga Jogeshwari|r_ga_jogeshwari|Rāga Jyoti|r_ga_jyoti|Rāga Kalagada|r_ga_kalagada|Rāga Kalakanthi|r_ga_kalakanthi|Rāga Khamas|r_ga_khamas|Rāga Kolhaas|r_ga_kolhaas|Rāga Kumudvati|r_ga_kumudvati|Rāga Latika|r_ga_latika|Rāga Madhakauns|r_ga_madhakauns|Rāga Madhuranjani|r_ga_madhuranjani|Rāga Malavastri|r_ga_malavastri|Rāga Malavi|r_ga_malavi|Rāga Malayamarutam|r_ga_malayamarutam|Rāga Malin|r_ga_malin|Rāga Mandari|r_ga_mandari|Rāga Mangal Gujari|r_ga_mangal_gujari|Rāga Marwa|r_ga_marwa|Rāga Meghranjani|r_ga_meghranjani|Rāga Milan Gandhar|r_ga_milan_gandhar|Rāga Mohankauns|r_ga_mohankauns|Rāga Nalinakanti|r_ga_nalinakanti|Rāga Nattaikurinji|r_ga_nattaikurinji|Rāga Navamanohari|r_ga_navamanohari|Rāga Neelangi|r_ga_neelangi|Rāga Nishadi|r_ga_nishadi|Rāga Padi|r_ga_padi|Rāga Paraju|r_ga_paraju|Rāga Parameshwari|r_ga_parameshwari|Rāga Phenadyuti|r_ga_phenadyuti|Rāga Raj Kalyan|r_ga_raj_kalyan|Rāga Ranjani|r_ga_ranjani|Rāga Ras Chandra|r_ga_ras_chandra|Rāga Rasamanjari|r_ga_rasamanjari|Rāga Rasavali|r_ga_rasavali|Rāga Ratnakanthi|r_ga_ratnakanthi|Rāga Rudra Pancama|r_ga_rudra_pancama|Rāga Rāgamalini|r_ga_r_gamalini|Rāga Saheli Todi|r_ga_saheli_todi|Rāga Salagavarali|r_ga_salagavarali|Rāga Sarasanana|r_ga_sarasanana|Rāga Sarasvati|r_ga_sarasvati|Rāga Saravati|r_ga_saravati|Rāga Shivawanti|r_ga_shivawanti|Rāga Shreevanti|r_ga_shreevanti|Rāga Simantini|r_ga_simantini|Rāga Simharava|r_ga_simharava|Rāga Sohini|r_ga_sohini|Rāga Sriranjani|r_ga_sriranjani|Rāga Suddha Mukhari|r_ga_suddha_mukhari|Rāga Syamalam|r_ga_syamalam|Rāga Takka|r_ga_takka|Rāga Trimurti|r_ga_trimurti|Rāga Udasi Bhairav|r_ga_udasi_bhairav|Rāga Vasanta|r_ga_vasanta|Rāga Vasantha|r_ga_vasantha|Rāga Vijayasri|r_ga_vijayasri|Rāga Viyogavarali|r_ga_viyogavarali|Rāga Vutari|r_ga_vutari|Rāga Yamuna Kalyani|r_ga_yamuna_kalyani|SAVian|savian|SIJian|sijian|SIKian|sikian|SMOian|smoian|SOBian|sobian|Saptimic|saptimic|Schoenberg Hexachord|schoenberg_hexachord|Stagimic|stagimic|Stodimic|stodimic|Stoptimic|stoptimic|Stothimic|stothimic|Stynimic|stynimic|Superlocrian Hexamirror|superlocrian_hexamirror|Sycrimic|sycrimic|Sythimic|sythimic|T4 First Rotation|t4_first_rotation|T4 Prime Mode|t4_prime_mode|Takemitsu Linea I|takemitsu_linea_i|Takemitsu Linea II|takemitsu_linea_ii|Tharimic|tharimic|Thogimic|thogimic|Tholimic|tholimic|Thycrimic|thycrimic|Thydimic|thydimic|Thyptimic|thyptimic|Thyrimic|thyrimic|UFFian|uffian|Zagimic|zagimic|Zanimic|zanimic|Zycrimic|zycrimic|Zygimic|zygimic|1+ + 2+ + 2maj|1_2_2maj|1+ + 2+ + 2min|1_2_2min|1+ + 2+ + 5maj|1_2_5maj|1+ + 2+ + 6maj|1_2_6maj|1+ + 2+ + 7maj|1_2_7maj|1+ + 2min + 7min|1_2min_7min|1+ + 5+ + 7min|1_5_7min|1+ + 6dim + 7min|1_6dim_7min|1aug + 1∅ + 2maj|1aug_1_2maj|1maj + 2maj + 2min|1maj_2maj_2min|1maj + 2maj + 3min|1maj_2maj_3min|1maj + 2maj + 6dim|1maj_2maj_6dim|1maj + 6dim + 6dim|1maj_6dim_6dim|1maj + 6dim + 7maj|1maj_6dim_7maj|1maj + 6maj + 6maj|1maj_6maj_6maj|1min + 2+ + 3min|1min_2_3min|1∅7 & 6∆7|1_7_6_7|1∆7 & 2∆7|1_7_2_7|1◦7 & 27|1_7_27|1◦7 & 37|1_7_37|1◦7 & 77|1_7_77|2+ + 2+ + 5dim|2_2_5dim|2+ + 3maj + 5dim|2_3maj_5dim|2+ + 5maj + 6maj|2_5maj_6maj|27 & 27|27_27|27 & 37|27_37|2maj + 2d + 7maj|2maj_2d_7maj|2maj + 6min + 7min|2maj_6min_7min|2∅7 & 3∅7|2_7_3_7|2◦7 & 67|2_7_67|37 & 47|37_47|3∅7 & 67|3_7_67|47 & 2∅7|47_2_7|47 & 57|47_57|4m7 + 5min|4m7_5min|4∅7 & 5∅7|4_7_5_7|5∅7 & 5∅7|5_7_5_7|67 & 67|67_67|6∅7 & 7∅7|6_7_7_7|Adonai Malakh|adonai_malakh|Aeolanyllic|aeolanyllic|Aeolaptyllic|aeolaptyllic|Aerocryllic|aerocryllic|Aerogyllic|aerogyllic|Aerylyllic|aerylyllic|Algerian|algerian|Bothyllic|bothyllic|Bylyllic|bylyllic|Chromatic Octamode|chromatic_octamode|Dacryllic|dacryllic|Doryllic|doryllic|Dygyllic|dygyllic|Dythyllic|dythyllic|Epacryllic|epacryllic|Esplá's Scale|espl_s_scale|Gonyllic|gonyllic|Goryllic|goryllic|Gygyllic|gygyllic|Gynyllic|gynyllic|Gythyllic|gythyllic|Ionaryllic|ionaryllic|Ionathyllic|ionathyllic|Ionian 5 Add 2 Mode I|ionian_5_add_2_mode_i|Ionian 5 Add 2 Mode II|ionian_5_add_2_mode_ii|Ionian 5 Add 2 Mode III|ionian_5_add_2_mode_iii|Ionian 5 Add 2 Mode IV|ionian_5_add_2_mode_iv|Ionian 5 Add 2 Mode VII|ionian_5_add_2_mode_vii|Ionian 5 Add 2 Mode VIII|ionian_5_add_2_mode_viii|Ionian 5 Add 7 Mode II|ionian_5_add_7_mode_ii|Ionian 5 Add 7 Mode III|ionian_5_add_7_mode_iii|Ionian 5 Add 7 Mode VI|ionian_5_add_7_mode_vi|Ionian 5 Add 7 Mode VII|ionian_5_add_7_mode_vii|Ionothyllic|ionothyllic|Ionyryllic|ionyryllic|Ishikosucho|ishikosucho|Kadyllic|kadyllic|Kantamani Add 2 Mode I|kantamani_add_2_mode_i|Kantamani Add 2 Mode II|kantamani_add_2_mode_ii|Kantamani Add 2 Mode III|kantamani_add_2_mode_iii|Kantamani Add 2 Mode V|kantamani_add_2_mode_v|Kantamani Add 2 Mode VI|kantamani_add_2_mode_vi|Katalyllic|katalyllic|Kataryllic|kataryllic|Katoryllic|katoryllic|Katycryllic|katycryllic|Katydyllic|katydyllic|Kocryllic|kocryllic|Koptyllic|koptyllic|Kycryllic|kycryllic|Laryllic|laryllic|Locrian Add 6|locrian_add_6|Lodyllic|lodyllic|Logyllic|logyllic|Lolyllic|lolyllic|Lydian Add 2|lydian_add_2|Lylyllic|lylyllic|Madyllic|madyllic|Magen Abot|magen_abot|Major Add 2 Mode III|major_add_2_mode_iii|Major Add 2 Mode IV|major_add_2_mode_iv|Malyllic|malyllic|Mela Jalarnava|mela_jalarnava|Messiaen Mode 4|messiaen_mode_4|Messiaen Mode 4 Rotation 3|messiaen_mode_4_rotation_3|Messiaen Mode 6 Rotation 2|messiaen_mode_6_rotation_2|Mirage Scale|mirage_scale|Mixolydian Add 2|mixolydian_add_2|Mixolydyllic|mixolydyllic|Mixonyphyllic|mixonyphyllic|Moryllic|moryllic|Mygyllic|mygyllic|Mythyllic|mythyllic|Palyllic|palyllic|Pavani Add 6 Mode IV|pavani_add_6_mode_iv|Pavani Add 6 Mode V|pavani_add_6_mode_v|Pavani Add 6 Mode VIII|pavani_add_6_mode_viii|Phracryllic|phracryllic|Phralyllic|phralyllic|Phraptyllic|phraptyllic|Phrygian Locrian|phrygian_locrian|Phryptyllic|phryptyllic|Pocryllic|pocryllic|Poptyllic|poptyllic|Pycryllic|pycryllic|Pyryllic|pyryllic|Rodyllic|rodyllic|Rolyllic|rolyllic|Rydyllic|rydyllic|Rynyllic|rynyllic|Rāga Asa Bhairav|r_ga_asa_bhairav|Rāga Asavari|r_ga_asavari|Rāga Chinthamani|r_ga_chinthamani|Rāga Dev Gandhar|r_ga_dev_gandhar|Rāga Devata Bhairav|r_ga_devata_bhairav|Rāga Hafiz Kauns|r_ga_hafiz_kauns|Rāga Haunskinkini|r_ga_haunskinkini|Rāga Hijaj Bhairav|r_ga_hijaj_bhairav|Rāga Lalitavari|r_ga_lalitavari|Rāga Mukhari|r_ga_mukhari|Rāga Nandavati|r_ga_nandavati|Rāga Pancham|r_ga_pancham|Rāga Ramkali|r_ga_ramkali|Rāga Saurashtra|r_ga_saurashtra|Rāga Suha Todi|r_ga_suha_todi|Rāga Viranch Mukhi|r_ga_viranch_mukhi|Rāga Virat Bhairav|r_ga_virat_bhairav|Sarasangi Add 2 Mode I|sarasangi_add_2_mode_i|Sarasangi Add 2 Mode II|sarasangi_add_2_mode_ii|Sarasangi Add 2 Mode III|sarasangi_add_2_mode_iii|Sarasangi Add 2 Mode VIII|sarasangi_add_2_mode_viii|Shostakovich|shostakovich|Sideways Scale|sideways_scale|Sodyllic|sodyllic|Stacryllic|stacryllic|Stolyllic|stolyllic|Stydyllic|stydyllic|Sulini Add 7 Mode II|sulini_add_7_mode_ii|Sulini Add 7 Mode V|sulini_add_7_mode_v|Sulini Add 7 Mode VI|sulini_add_7_mode_vi|Thocryllic|thocryllic|Thoptyllic|thoptyllic|Thorcryllic|thorcryllic|Thyphyllic|thyphyllic|Zadyllic|zadyllic|Zagyllic|zagyllic|Zalyllic|zalyllic|Zanyllic|zanyllic|Zocryllic|zocryllic|Zogyllic|zogyllic|Zothyllic|zothyllic|Aeolacrygic|aeolacrygic|Aeolathygic|aeolathygic|Aeolocrygic|aeolocrygic|Aeolygic|aeolygic|Aeolyrygic|aeolyrygic|Aeradyllian|aeradyllian|Aeranygic|aeranygic|Aerocrygic|aerocrygic|Aerygyllian|aerygyllian|Aerythygic|aerythygic|Barygic|barygic|Boptygic|boptygic|Bythygic|bythygic|Chromatic Decamirror|chromatic_decamirror|Chromatic Nonamode|chromatic_nonamode|Chromatic Undecamode|chromatic_undecamode|Danyllian|danyllian|Dathyllian|dathyllian|Decatonic Chromatic II|decatonic_chromatic_ii|Diatonic Dorian Mixed|diatonic_dorian_mixed|Diminishing Nonamode 2nd Rotation|diminishing_nonamode_2nd_rotation|Diminishing Nonamode Basic|diminishing_nonamode_basic|Dothygic|dothygic|Dydygic|dydygic|Epilygic|epilygic|Gaptygic|gaptygic|Gonygic|gonygic|Gothygic|gothygic|Gythygic|gythygic|Houseini|houseini|Ionodygic|ionodygic|Ionycrygic|ionycrygic|Katogyllian|katogyllian|Katycrygic|katycrygic|Katygic|katygic|Katylygic|katylygic|Kiourdi|kiourdi|Ladygic|ladygic|Laptygic|laptygic|Locrian/Aeolian Mixed|locrian_aeolian_mixed|Lydygic|lydygic|Major Add 26 Mode II|major_add_26_mode_ii|Major Add 26 Mode III|major_add_26_mode_iii|Major Add 26 Mode IX|major_add_26_mode_ix|Major Add 26 Mode VI|major_add_26_mode_vi|Marygic|marygic|Messiaen Mode 7 Rotation 4|messiaen_mode_7_rotation_4|Mixodyllian|mixodyllian|Mocrygic|mocrygic|Nonatonic 2|nonatonic_2|Nonatonic Chromatic II|nonatonic_chromatic_ii|Padygic|padygic|Phradygic|phradygic|Pylygic|pylygic|Raphygic|raphygic|Raptygic|raptygic|Rocryllian|rocryllian|Rodygic|rodygic|Rāga Abheri Todi|r_ga_abheri_todi|Rāga Ahi Mohini|r_ga_ahi_mohini|Rāga Gambhir Basant|r_ga_gambhir_basant|Rāga Kamod|r_ga_kamod|Rāga Lakshmi Todi|r_ga_lakshmi_todi|Rāga Maru|r_ga_maru|Rāga Tilak Bhairav|r_ga_tilak_bhairav|Sacrygic|sacrygic|Sarygic|sarygic|Stadygic|stadygic|Stonygic|stonygic|Styptygic|styptygic|Sydygic|sydygic|Sylygic|sylygic|Sythygic|sythygic|Thacrygic|thacrygic|Tharygic|tharygic|Triple Chromatic I|triple_chromatic_i|Youlan|youlan|Zacrygic|zacrygic|Zanygic|zanygic|Zodygic|zodygic|Zolygic|zolygic|1MI & 2∆7|1mi_2_7|1SUS4 & 3∅7|1sus4_3_7|1SUS4 & 77|1sus4_77|4∆7 & 7MA|4_7_7ma|Aeolian 457|aeolian_457|Aeolian Flat|aeolian_flat|Aeolian Harmonic|aeolian_harmonic|Alt 2|alt_2|Alt 25|alt_25|Alt 256|alt_256|Alt 2567|alt_2567|Alt 26|alt_26|Alt 267|alt_267|Alt 275|alt_275|Alt 2756|alt_2756|Alt 34|alt_34|Alt 345|alt_345|Alt 3456|alt_3456|Alt 34567|alt_34567|Alt 3457|alt_3457|Alt 346|alt_346|Alt 356|alt_356|Alt 357|alt_357|Alt 36|alt_36|Alt 367|alt_367|Alt 5|alt_5|Alt 534|alt_534|Alt 5437|alt_5437|Alt 56|alt_56|Alt 567|alt_567|Alt 57|alt_57|Alt 5734|alt_5734|Alt 6|alt_6|Alt 63|alt_63|Alt 634|alt_634|Alt 6345|alt_6345|Alt 635|alt_635|Alt 65|alt_65|Alt 653|alt_653|Alt 6534|alt_6534|Alt 67|alt_67|Alt 6734|alt_6734|Alt 67345|alt_67345|Alt 6735|alt_6735|Alt 675|alt_675|Alt 67534|alt_67534|Alt 7|alt_7|Alt 734|alt_734|Alt 7345|alt_7345|Alt 73456|alt_73456|Alt 7346|alt_7346|Alt 7356|alt_7356|Alt 756|alt_756|Alternating Heptamode|alternating_heptamode|Apathetic|apathetic|Apathetic Minor|apathetic_minor|Arcadian|arcadian|Arcadian Minor|arcadian_minor|Astrocyte|astrocyte|Bohemian|bohemian|Bohemian Minor|bohemian_minor|Borean Mode II|borean_mode_ii|Borean Mode VI|borean_mode_vi|Bucolic|bucolic|Ceiling Scale|ceiling_scale|Debussy's Heptatonic|debussy_s_heptatonic|Dominant +2|dominant_2|Dominant +23|dominant_23|Dominant +234|dominant_234|Dominant +24|dominant_24|Dominant +324|dominant_324|Dominant +34|dominant_34|Dominant +342|dominant_342|Dominant +4|dominant_4|Dominant 2|Dominant 25|dominant_25|Dysphoric|dysphoric|Eccentric|eccentric|Elephant Scale|elephant_scale|Erratic|erratic|Erratic Minor|erratic_minor|Euphoric|euphoric|Eurean Mode III|eurean_mode_iii|Exotic|exotic|Exotic Minor|exotic_minor|Half-Diminished|half_diminished|Harmonic Maj 25|harmonic_maj_25|Heptatonic Chromatic|heptatonic_chromatic|Hungarian Major|hungarian_major|Hungarian Major Inverse|hungarian_major_inverse|Incoherent|incoherent|Infra-Alt 5|infra_alt_5|Infra-Alt 56|infra_alt_56|Infra-Alt 567|infra_alt_567|Infra-Alt 57|infra_alt_57|Infra-Alt 576|infra_alt_576|Infra-Alt 6|infra_alt_6|Infra-Alt 64|infra_alt_64|Infra-Alt 67|infra_alt_67|Infra-Alt 674|infra_alt_674|Infra-Alt 7|infra_alt_7|Infra-Alt 74|infra_alt_74|Infra-Alt 75|infra_alt_75|Ionian +2|ionian_2|Ionian +23|ionian_23|Ionian +234|ionian_234|Ionian +24|ionian_24|Ionian +324|ionian_324|Ionian +4|ionian_4|Ionian 2567|ionian_2567|Ionian 5|ionian_5|Jeths' Mode|jeths_mode|Jyoti Swarupini|jyoti_swarupini|Kaikian Mode II|kaikian_mode_ii|Kaikian Mode V|kaikian_mode_v|Kanakangi|kanakangi|Leading Whole-Tone Inverse|leading_whole_tone_inverse|Lipsean Mode II|lipsean_mode_ii|Major Augmented|major_augmented|Major Third Ditone|major_third_ditone|Mararanjani|mararanjani|Mela Bhavapriya|mela_bhavapriya|Mela Dhatuvardhani|mela_dhatuvardhani|Mela Dhavalambari|mela_dhavalambari|Mela Gamanasrama|mela_gamanasrama|Mela Ganamurti|mela_ganamurti|Mela Gavambodhi|mela_gavambodhi|Mela Kantamani|mela_kantamani|Mela Sanmukhapriya|mela_sanmukhapriya|Mela Sucaritra|mela_sucaritra|Mela Syamalangi|mela_syamalangi|Melodic +|melodic|Melodic +4|melodic_4|Melodic 4|Minor Second Ditone|minor_second_ditone|Minor Third Ditone|minor_third_ditone|Namanarayani|namanarayani|Navaneetam|navaneetam|Noh|noh|Nomadic|nomadic|Nomadic Minor|nomadic_minor|Pacific Minor|pacific_minor|Perfect Fourth|perfect_fourth|Persichetti|persichetti|Phlegmatic|phlegmatic|Phlegmatic Minor|phlegmatic_minor|Phrygian Double-Flat|phrygian_double_flat|Quixotic|quixotic|Quixotic Minor|quixotic_minor|Raghupriya V|raghupriya_v|Rāga Bhanumati|r_ga_bhanumati|Rāga Cudamani|r_ga_cudamani|Rāga Dvigandharabushini|r_ga_dvigandharabushini|Rāga Ganavaridhi|r_ga_ganavaridhi|Rāga Hindolita|r_ga_hindolita|Rāga Jhankara Bhramavi|r_ga_jhankara_bhramavi|Rāga Kalahamsa|r_ga_kalahamsa|Rāga Malini|r_ga_malini|Rāga Manoranjani|r_ga_manoranjani|Rāga Pushp Ranjani|r_ga_pushp_ranjani|Rāga Ravikosh|r_ga_ravikosh|Rāga Sailadesakshi|r_ga_sailadesakshi|Rāga Sauviram|r_ga_sauviram|Rāga Sthavarajam|r_ga_sthavarajam|Rāga Suddha Pancama|r_ga_suddha_pancama|Rāga Supradhipam|r_ga_supradhipam|Rāga Varali|r_ga_varali|Sabach|sabach|Superlocrian|superlocrian|Superlocrian 267|superlocrian_267|Superlocrian 27|superlocrian_27|Superlocrian 37|superlocrian_37|Superlocrian 567|superlocrian_567|Superlocrian 6|superlocrian_6|Supine|supine|Supine Minor|supine_minor|Synthetic Mixture 5|synthetic_mixture_5|Tanarupi IV|tanarupi_iv|Tanarupi V|tanarupi_v|Triadic Heptatonic 29|triadic_heptatonic_29|Tsinganikos|tsinganikos|Ultra-Alt 67|ultra_alt_67|Ultra-Alt 7|ultra_alt_7|Unison|unison|Unorthodox|unorthodox|Unorthodox Minor|unorthodox_minor|Vietnamese Ditonic|vietnamese_ditonic|Zephyrean Mode V|zephyrean_mode_v|Zephyrean Mode VI|zephyrean_mode_vi",
+  "records": [0,1,2741,23,2,3,925,23,4,5,1709,23,6,7,1835,23,8,9,1931,23,10,11,1933,23,10,11,1821,23,12,7,1707,23,13,9,1691,23,14,11,1741,23,14,11,1693,23,15,16,1645,23,17,18,1837,23,19,20,1259,23,21,22,919,23,23,24,1451,23,25,26,911,23,27,28,743,23,29,30,2515,23,31,32,2675,23,33,34,2507,23,35,36,1255,23,37,38,2773,23,39,40,2915,23,39,40,2891,23,41,42,2929,23,43,40,2759,23,43,40,2787,23,44,45,2531,23,44,45,2545,23,44,45,2537,23,46,47,1001,23,46,47,1009,23,46,47,995,23,48,49,2789,23,50,51,2533,23,52,53,1881,23,54,55,1897,23,54,55,1863,23,54,55,1867,23,56,57,1893,23,56,57,1869,23,58,59,1905,23,60,61,1747,23,62,63,1769,23,62,63,1763,23,64,65,1507,23,66,67,1765,23,68,69,1777,23,70,71,1513,23,72,73,1521,23,74,75,2765,23,76,77,2517,23,78,79,1493,23,80,81,1509,23,82,83,1717,23,84,85,1653,23,86,87,1461,23,88,89,1845,23,90,91,1453,23,92,93,1387,23,94,95,493,23,94,95,749,23,96,97,1383,23,98,99,1267,23,100,101,487,23,102,103,871,23,102,103,883,23,104,105,1643,23,106,107,1639,23,108,109,491,23,110,111,2411,23,110,111,875,23,112,113,1395,23,114,115,1397,23,116,117,1401,23,118,119,761,23,118,119,499,23,118,119,505,23,120,121,889,23,122,123,1269,23,124,125,501,23,126,127,885,23,128,129,1687,23,130,131,827,23,132,133,859,23,134,135,855,23,136,137,699,23,138,139,2797,8,140,141,2733,7,142,143,2901,23,144,145,2899,23,146,147,2921,23,148,149,2893,23,148,149,2917,23,150,151,837,21,152,153,1749,7,154,155,309,21,156,157,675,21,158,159,339,21,160,161,2477,7,162,163,2461,7,164,165,2413,7,166,167,77,4,168,169,2873,23,170,171,1459,23,172,173,2485,23,174,175,2421,23,176,177,2335,7,178,179,2207,7,180,181,2483,7,182,183,2509,7,184,185,2511,8,186,187,661,21,188,189,659,21,190,191,587,21,192,193,1177,21,194,195,1329,21,196,197,2217,21,198,199,1193,21,200,201,1123,5,202,203,681,5,204,205,397,21,206,207,409,21,208,209,2385,21,210,211,211,21,212,213,789,21,214,215,1425,21,216,217,1173,21,218,219,1165,21,218,219,653,21,220,221,1221,21,222,223,1125,21,224,225,1113,21,226,227,2257,21,228,229,2325,21,230,231,555,21,232,233,1201,21,234,235,31,21,236,237,2063,21,238,239,595,21,240,241,1571,21,242,243,1305,21,244,245,677,21,246,247,667,22,248,249,1257,22,250,251,669,22,252,253,2281,22,254,255,1833,22,256,257,917,22,258,259,1253,22,260,261,679,22,262,263,1785,24,264,265,735,24,266,267,2415,24,268,269,1789,25,270,271,79,21,272,273,1101,21,274,275,1773,24,276,277,2153,21,278,279,1629,23,280,281,1261,23,282,283,2925,8,284,285,2539,8,286,287,1723,8,288,289,1755,8,290,291,2175,8,292,293,2795,8,294,295,2393,6,296,297,1235,6,298,299,1109,5,300,301,819,6,302,303,1619,6,304,305,1621,6,306,307,2997,24,308,309,1725,8,308,309,2989,8,310,311,1891,23,312,313,1435,7,314,315,2043,10,316,317,1517,8,318,319,1973,8,320,321,1467,24,322,323,2479,8,324,325,2955,7,326,327,2731,23,328,329,2715,23,330,331,2843,23,332,333,2667,23,332,333,2859,23,334,335,2475,7,336,337,2459,7,338,339,2987,8,340,341,867,22,342,343,517,3,344,345,1029,3,346,347,131,3,348,349,261,3,350,351,545,3,352,353,321,3,354,355,1153,3,356,357,69,3,358,359,515,3,360,361,73,3,362,363,2113,3,364,365,1027,3,366,367,259,3,368,369,1089,3,370,371,19,3,372,373,1041,3,374,375,289,3,376,377,81,3,378,379,641,3,380,381,2081,3,382,383,2057,3,384,385,2065,3,386,387,2177,19,388,389,35,19,390,391,145,19,392,393,37,3,394,395,137,3,396,397,13,3,398,399,2305,3,400,401,2561,3,402,403,2053,3,404,405,521,3,406,407,11,19,408,409,529,3,410,411,193,3,412,413,1057,3,414,415,161,3,416,417,385,3,418,419,97,3,420,421,1537,19,422,423,49,19,424,425,769,3,426,427,25,3,428,429,7,3,430,431,2051,3,432,433,1033,3,434,435,265,3,436,437,67,3,438,439,41,3,440,441,21,3,442,443,29,4,444,445,39,4,446,447,89,4,448,449,57,4,450,451,1157,4,452,453,71,4,454,455,23,4,456,457,51,4,458,459,113,4,460,461,135,4,462,463,537,4,464,465,785,4,466,467,1313,4,468,469,83,4,470,471,139,4,472,473,101,4,474,475,209,4,476,477,27,4,478,479,141,4,480,481,147,4,482,483,153,4,484,485,163,4,486,487,197,4,488,489,201,4,490,491,267,4,492,493,269,4,494,495,1161,4,496,497,323,4,498,499,353,4,500,501,387,4,502,503,389,4,504,505,449,4,506,507,1297,4,508,509,657,4,510,511,2321,4,512,509,649,4,513,514,2097,4,515,516,523,4,517,518,531,4,519,520,533,4,521,522,519,4,523,524,609,4,525,526,643,4,527,528,645,4,529,530,275,4,531,532,2121,20,533,534,1169,4,535,536,45,20,537,538,225,4,539,540,705,4,541,542,105,4,543,544,777,4,545,546,771,4,547,548,773,4,549,550,401,4,551,552,801,4,553,554,833,4,555,556,897,4,557,558,1045,4,559,560,1049,4,561,562,1059,4,563,564,1031,4,565,566,1035,4,567,568,579,4,569,570,1043,4,571,572,1073,4,573,574,1121,4,575,576,165,4,577,578,1185,4,579,580,305,4,581,582,1217,4,583,584,1283,4,585,586,1285,4,587,588,1289,4,589,590,1097,4,591,592,525,4,593,594,75,4,595,596,1409,4,597,598,99,4,599,600,149,4,601,602,1539,4,603,604,1541,4,605,606,1569,4,607,608,1545,4,609,610,1553,4,611,612,1601,4,613,614,1665,4,615,616,1065,4,617,618,297,4,619,620,1061,4,621,622,1793,4,623,624,673,4,625,626,2689,4,627,628,281,4,629,630,329,4,631,632,393,4,633,634,1093,4,635,636,2083,4,637,638,2085,4,639,640,2059,4,641,642,2061,4,643,644,2067,4,645,646,2069,4,647,648,2073,4,649,650,2089,4,651,652,2115,4,653,654,553,20,655,656,581,20,657,658,2193,20,659,660,53,20,661,662,177,20,663,664,195,4,665,666,2145,4,667,668,325,4,669,670,1105,4,671,672,2185,20,673,674,277,4,675,676,2179,4,677,678,2181,4,679,680,2209,4,681,682,2241,4,683,684,2307,4,685,686,2309,4,687,688,2625,4,689,690,2369,4,691,692,2337,4,693,694,2313,4,695,696,2433,4,697,698,1091,4,699,700,2563,4,701,702,2565,4,703,704,2569,4,705,706,2577,4,707,708,2593,4,709,710,561,4,711,712,43,20,713,714,547,4,715,716,2817,4,717,718,549,4,719,720,291,4,721,722,293,4,723,724,1155,4,725,726,2129,4,727,728,337,4,729,730,2117,4,731,732,593,4,733,734,417,4,735,736,15,4,737,738,2055,4,739,740,263,4,741,742,169,4,743,744,1037,4,745,746,85,4,747,748,345,5,749,750,1299,5,751,752,817,5,753,754,787,5,755,756,849,5,757,758,589,5,759,760,617,5,761,761,357,21,762,763,2449,5,764,765,2201,5,766,767,2441,5,768,769,2697,5,770,771,1099,5,772,773,1617,5,774,775,551,5,776,777,2595,5,776,777,1095,5,778,779,613,5,780,781,803,5,782,783,805,5,784,785,565,21,786,787,327,5,788,789,2373,21,790,791,841,5,792,793,2329,5,794,795,563,5,796,797,809,5,798,799,361,5,800,801,651,5,802,803,625,5,804,804,1107,5,805,806,793,5,807,808,453,5,809,810,1137,5,811,812,47,5,813,814,61,5,815,816,93,5,817,818,121,5,819,820,87,5,821,822,583,5,823,824,1809,5,825,826,369,5,827,828,279,5,829,830,285,5,831,832,905,5,833,834,2323,5,835,836,1301,5,837,838,1349,5,839,840,341,5,841,842,143,5,843,844,241,5,845,846,271,5,847,848,2633,5,849,850,2377,5,851,852,313,5,853,854,1317,5,855,856,481,5,857,858,527,5,859,860,601,5,861,862,713,5,863,864,91,5,863,864,157,5,865,866,1063,21,865,866,2101,5,865,866,2093,5,867,868,1549,5,867,868,1547,5,867,868,2579,21,869,870,1411,5,869,870,2821,5,871,872,2753,5,871,872,929,5,871,872,1729,5,873,874,1233,5,875,876,2945,5,877,878,55,5,879,880,2075,5,881,882,59,5,883,884,2077,5,885,886,1543,5,887,888,961,5,889,890,1047,5,891,892,1039,5,893,894,295,5,895,896,421,21,897,898,1347,5,899,900,203,21,901,902,1187,5,903,904,597,5,905,906,1795,5,907,908,1797,5,909,910,1857,5,911,912,1921,5,913,914,107,21,915,916,213,21,917,918,2071,5,919,920,2119,5,921,922,2087,5,923,924,2091,5,925,926,913,21,927,928,465,21,929,930,185,21,929,930,179,21,929,930,217,21,931,932,539,21,931,932,1077,21,931,932,1069,21,931,932,2137,21,931,932,535,21,933,934,779,21,933,934,781,21,933,934,1291,21,933,934,2317,21,933,934,2315,21,933,934,1293,21,935,936,2693,21,935,936,1603,21,935,936,2437,21,935,936,1219,21,937,938,2849,21,937,938,1633,21,937,938,1825,21,937,938,2657,21,939,940,155,21,939,940,151,21,941,942,2125,21,941,942,2123,21,943,944,1555,21,945,946,2825,21,945,946,1801,21,947,948,865,21,947,948,737,21,949,950,233,5,951,952,541,5,953,954,1159,21,955,956,2627,21,957,958,171,5,957,958,205,5,959,960,1075,21,959,960,1067,5,959,960,2149,5,961,962,1561,5,961,962,1557,5,961,962,2585,5,963,964,835,21,963,964,707,21,963,964,1413,5,965,966,1441,5,965,966,1377,5,965,966,2401,5,967,968,2187,5,969,970,569,5,971,972,1321,5,973,974,2183,5,975,976,2567,5,977,978,2571,5,979,980,1189,5,981,982,2819,5,983,984,2225,5,985,986,557,21,987,988,301,21,989,990,2609,5,991,992,405,21,993,994,181,5,995,996,2345,5,997,998,331,5,999,1000,299,5,1001,1002,2213,21,1003,1004,2435,5,1005,1006,2465,5,1007,1008,721,5,1009,1010,2211,5,1011,1012,2353,5,1013,1014,1573,21,1015,1016,1315,5,1017,1018,2189,5,1017,1018,2197,21,1019,1020,1609,5,1019,1020,1353,5,1021,1022,1129,5,1023,1024,1585,5,1025,1026,425,5,1027,1028,2339,5,1029,1030,2311,5,1031,1032,2133,5,1033,1034,1697,5,1035,1036,1673,5,1037,1038,2705,5,1039,1040,1171,5,1041,1042,689,5,1043,1044,2601,5,1045,1046,1669,5,1047,1048,2099,5,1049,1050,307,5,1051,1052,665,5,1053,1054,2249,5,1055,1056,199,5,1057,1058,2581,5,1059,1060,2341,5,1061,1062,173,5,1063,1064,2721,5,1065,1066,775,5,1067,1068,395,5,1069,1070,2597,21,1071,1072,403,5,1073,1074,1163,5,1075,1076,1225,5,1077,1078,2641,5,1079,1080,1417,5,1081,1082,709,21,1083,1084,1605,21,1083,1084,2629,21,1085,1086,2245,5,1087,1088,1681,5,1089,1090,1577,5,1091,1092,451,5,1093,1094,433,5,1095,1096,419,5,1097,1098,457,5,1099,1100,227,5,1099,1100,229,5,1101,1102,2161,5,1101,1102,1081,5,1103,1104,647,21,1103,1104,391,5,1105,1106,2371,21,1105,1106,2243,5,1107,1108,2273,5,1109,1110,2147,5,1111,1112,901,5,1111,1112,899,5,1113,1114,1249,5,1115,1116,167,21,1115,1116,103,5,1117,1118,2131,21,1119,1120,2691,5,1121,1122,117,5,1121,1122,115,5,1123,1124,1053,5,1123,1124,2105,5,1125,1126,1287,5,1127,1128,1667,5,1129,1130,2881,5,1131,1132,109,5,1133,1134,1051,5,1135,1136,2573,5,1137,1138,2497,5,1139,1140,1473,5,1141,1142,611,5,132,133,333,21,1143,1144,283,5,1145,1146,2833,5,1147,1148,355,5,1149,1150,2195,5,1151,1152,821,6,1153,1154,1369,6,1155,1156,1363,6,1157,1158,1429,6,1159,1160,1237,6,1161,1160,437,6,1162,1163,1241,6,1164,1165,1433,6,1166,1167,729,6,1168,1169,683,6,1170,1171,411,22,1172,1173,1227,6,1174,1175,1179,6,1176,1177,483,6,1178,1179,745,6,1180,1181,1251,22,1182,1183,739,22,1184,1185,2277,6,1186,1187,2289,6,1188,1189,2649,6,1190,1191,2409,6,1192,1193,603,6,1194,1195,605,6,1196,1197,1133,6,1198,1199,2157,6,1200,1201,1381,6,1202,1203,1613,6,1204,1205,869,6,1206,1207,1637,6,1208,1209,813,6,1210,1211,933,6,1212,1213,909,6,1214,1215,2761,6,1216,1217,2865,6,1218,1219,2897,6,1220,1221,2769,6,1222,1223,1865,6,1224,1225,2729,6,1226,1227,1641,6,1228,1229,1635,22,1230,1231,2659,22,1232,1233,2857,6,1234,1235,2853,6,1236,1237,2665,6,1238,1239,2661,6,1240,1241,2673,6,1242,1243,1385,6,1244,1245,873,6,1246,1247,2403,22,1248,1249,1379,6,1250,1251,2913,6,1252,1253,423,22,1254,1255,1223,22,1256,1257,399,6,1258,1259,1191,6,1260,1261,1175,6,1262,1263,1731,6,1264,1265,2889,6,1266,1267,2885,6,1268,1269,1325,6,1270,1271,1307,6,1272,1273,1817,6,1274,1275,2837,6,1276,1277,797,6,1278,1279,811,6,1280,1281,795,22,1282,1283,843,6,1284,1285,1611,6,1286,1287,2635,6,1288,1289,2829,6,1290,1291,1563,6,1290,1291,2605,6,1292,1293,95,6,1294,1295,111,6,1296,1297,123,6,1298,1299,125,6,1300,1301,567,22,1302,1303,2375,22,1304,1305,791,22,1306,1307,1929,6,1308,1309,473,6,1310,1311,1351,6,1312,1313,1167,22,1314,1315,881,6,1316,1317,2513,6,1318,1319,2841,22,1320,1321,407,22,1322,1323,159,6,1324,1325,183,6,1326,1327,187,6,1328,1329,189,6,1330,1331,207,6,1332,1333,175,6,1334,1335,231,6,1336,1337,235,6,1338,1339,237,6,1340,1341,215,6,1342,1343,221,6,1344,1345,243,6,1346,1347,249,6,1348,1349,921,6,1350,1351,1649,6,1352,1353,349,6,1354,1355,359,22,1356,1357,2961,6,1358,1359,543,6,1360,1361,1873,6,1362,1363,2361,6,1364,1365,2233,6,1366,1367,2203,22,1368,1369,619,22,1370,1371,2331,22,1372,1373,2199,22,1374,1375,783,6,1376,1377,373,6,1378,1379,2327,22,1380,1381,1127,22,1382,1383,1303,6,1384,1385,1607,22,1386,1387,857,6,1388,1389,903,6,1390,1391,963,6,1392,1393,993,6,1394,1395,1055,6,1396,1397,1071,6,1398,1399,1079,6,1400,1401,1083,6,1402,1403,1085,6,1404,1405,2603,6,1406,1407,1937,6,1408,1409,413,6,1410,1411,591,6,1412,1413,2457,6,1414,1415,303,22,1416,1417,693,6,1418,1419,287,6,1420,1421,1295,6,1422,1423,2701,6,1424,1425,63,6,1426,1427,2079,6,1428,1429,2445,6,1430,1431,1131,6,1432,1433,1625,22,1434,1435,1415,6,1436,1437,853,6,1438,1439,2389,6,1440,1441,839,22,1442,1443,2205,6,1444,1445,969,6,1446,1447,343,6,1448,1449,965,6,1450,1451,2835,22,1452,1453,2953,6,1454,1455,219,6,1456,1457,1505,6,1458,1459,1551,6,1460,1461,1559,6,1462,1463,1565,6,1464,1465,1671,6,1466,1467,1761,6,1468,1469,497,6,1470,1471,1181,6,1472,1473,655,22,1474,1475,377,6,1476,1477,2851,22,1478,1479,1813,6,1480,1481,1827,22,1482,1483,469,6,1484,1485,977,6,1486,1487,317,6,1488,1489,633,6,1490,1491,571,22,1492,1493,1811,22,1494,1495,753,6,1496,1497,1799,6,1498,1499,1803,6,1500,1501,1805,6,1502,1503,1859,6,1504,1505,1889,6,1506,1507,1923,6,1508,1509,1925,6,1510,1511,697,6,1512,1513,365,22,110,111,363,22,1514,1515,2713,22,1516,1517,2709,22,1516,1517,2725,22,1518,1519,559,22,1520,1521,1103,22,1522,1523,1953,6,1524,1525,1985,6,1526,1527,2095,6,1528,1529,2103,6,1530,1531,2107,6,1532,1533,2109,6,1534,1535,2631,22,1536,1537,2599,22,1538,1539,2275,6,1540,1541,455,6,1542,1543,1197,6,1544,1545,1701,22,1546,1547,627,6,1548,1549,1393,6,1550,1551,2505,6,1552,1553,2127,6,1554,1555,2135,6,1556,1557,2139,6,1558,1559,2141,6,1560,1561,2151,6,1562,1563,2165,6,1564,1565,2169,6,1566,1567,2155,6,1568,1569,2319,6,1570,1571,2439,6,1572,1573,2529,6,1574,1575,2575,6,1576,1577,2583,6,1578,1579,2587,6,1580,1581,2589,6,1582,1583,2443,22,1584,1585,1829,6,1586,1587,489,6,1588,1589,1319,6,1590,1591,2219,6,1592,1593,1449,22,1594,1595,1861,6,1596,1597,1309,6,1598,1599,2617,6,1600,1601,1265,6,1602,1603,621,6,1604,1605,2695,6,1606,1607,2755,6,1608,1609,2785,6,1610,1611,2823,6,1612,1613,2827,6,1614,1615,2501,6,1616,1617,2215,22,1618,1619,1117,6,1620,1621,1323,6,1622,1623,1141,6,1624,1625,371,22,1626,1627,429,6,1628,1629,2253,6,1630,1631,1205,6,1632,1633,435,22,1634,1635,2451,6,1636,1637,2469,6,1638,1639,2499,6,1640,1641,711,22,1642,1643,467,22,1644,1645,2387,6,1646,1647,245,6,1648,1649,1195,6,1650,1651,2417,6,1652,1653,1457,6,1654,1655,1203,6,1654,1655,2227,22,1656,1657,685,6,1658,1659,2349,6,1660,1661,2379,6,1662,1663,2613,6,1664,1665,2737,6,1666,1667,851,6,1668,1669,1333,6,1670,1671,1477,6,1672,1673,663,6,1674,1675,459,22,1676,1677,1685,6,1678,1679,2723,6,1680,1681,1209,6,1682,1683,1593,6,1684,1685,1489,6,1686,1687,915,6,1686,1687,1427,6,1688,1689,931,22,1690,1691,1713,6,1692,1693,1677,6,1694,1695,741,6,1696,1697,2453,6,1698,1699,1737,6,1700,1701,2221,6,1702,1703,1705,6,1704,1705,723,6,1706,1707,1683,6,1708,1709,2707,6,1710,1711,2259,22,1712,1713,1355,6,1714,1715,2643,6,1716,1717,2163,6,1718,1719,1689,6,1720,1721,1337,6,1722,1723,2229,6,1724,1725,1589,6,1726,1727,1445,6,1728,1729,845,6,1730,1731,2757,6,1732,1733,2467,22,1734,1735,2481,6,1736,1737,1579,6,1738,1739,1443,6,1740,1741,2645,6,1742,1743,2637,6,1744,1745,629,6,1746,1747,2265,6,1748,1749,1699,6,1750,1751,2261,6,1752,1753,1587,22,1754,1755,691,6,1756,1757,1419,6,1758,1759,1675,6,1760,1761,2357,6,1762,1763,1733,6,1764,1765,945,6,1766,1767,717,6,1768,1769,2251,22,1770,1771,427,6,1772,1773,1229,6,1774,1775,2355,6,1776,1777,1581,6,1778,1779,807,6,1780,1781,461,6,1782,1783,2473,6,1784,1785,1421,6,1786,1787,1139,22,1788,1789,2611,22,1790,1791,1331,6,1792,1793,2247,6,1794,1795,2347,6,1796,1797,1745,6,1798,1799,725,6,1800,1801,2883,6,1802,1803,2947,6,1804,1805,2949,6,1806,1807,119,6,1808,1809,2977,6,1810,1811,573,6,1812,1813,615,6,1814,1815,311,22,1816,1817,315,22,1818,1819,485,6,1820,1821,937,6,1822,1823,2333,6,1824,1825,1115,22,1826,1827,1111,6,1828,1829,2699,6,1830,1831,2405,6,1832,1833,715,6,1834,1835,2381,6,1836,1837,1357,6,1838,1839,2343,6,1840,1841,1841,6,1842,1843,907,22,1844,1845,441,6,1846,1847,2191,6,1848,1849,825,6,1850,1851,599,6,1852,1853,1475,6,132,133,347,22,1854,1855,1481,6,1856,1857,335,22,1858,1859,1575,22,1860,1861,1145,6,1862,1863,887,8,1864,1865,1909,8,1866,1867,1907,8,1868,1869,1879,8,1870,1871,1847,8,1872,1873,2933,8,1874,1875,1399,8,1876,1877,1851,8,1878,1879,1885,8,1880,1881,951,8,1882,1883,1757,8,1884,1885,955,8,1886,1887,2973,8,1888,1889,2525,8,1890,1891,2971,8,1892,1893,1771,8,1894,1895,1883,8,1896,1897,2775,8,1898,1899,2923,8,1900,1901,2909,8,1902,1903,1901,8,1904,1905,1767,8,1906,1907,2931,8,1908,1909,2875,8,1910,1911,2919,8,1912,1913,1743,8,1914,1915,1895,8,1916,1917,1655,8,1918,1919,879,8,1920,1921,1499,8,1922,1923,2877,8,1924,1925,1501,8,1926,1927,2747,8,1928,1929,1659,8,1930,1931,1751,8,1932,1933,2937,8,1934,1935,1779,8,1936,1937,987,8,1938,1939,1947,8,1940,1941,1711,8,1942,1943,1215,8,1944,1945,2553,8,1946,1947,703,8,1948,1949,2863,8,1950,1951,2623,8,1952,1953,2541,8,1954,1955,1375,8,1956,1957,999,8,1958,1959,255,8,1960,1961,2239,8,1962,1963,763,8,1964,1965,2959,8,1966,1967,1017,8,1968,1969,751,8,1970,1971,1403,8,1972,1973,1661,8,1974,1975,1405,8,1976,1977,2005,8,1978,1979,2735,8,1980,1981,2809,8,1982,1983,639,8,1984,1985,2463,8,1986,1987,2685,24,1988,1989,1695,24,1990,1991,2895,24,1992,1993,1959,24,1994,1995,957,24,1994,1995,1005,24,1996,1997,1263,24,1996,1997,1275,24,1998,1999,1949,24,2000,2001,1511,24,2002,2003,943,24,2004,2005,2519,24,2006,2007,509,8,2008,2009,1003,8,2010,2011,2805,8,2012,2013,2429,8,2014,2015,989,8,2016,2017,1271,8,2018,2019,2683,8,2020,2021,1871,8,2022,2023,2983,8,2024,2025,759,8,2026,2027,1529,8,2028,2029,2427,8,2030,2031,2021,8,2032,2033,2767,8,2034,2035,479,8,2036,2037,927,8,2038,2039,1011,8,2040,2041,2367,8,2042,2043,1899,24,2044,2045,2287,8,2046,2047,383,8,2048,2049,2003,8,2050,2051,2781,24,2052,2053,2671,8,2054,2055,2967,8,2056,2057,2907,8,2058,2059,2903,24,2060,2061,1391,24,2062,2063,1943,8,2064,2065,2791,8,2066,2067,2535,8,2068,2069,975,8,2070,2071,1495,8,2072,2073,2523,8,2074,2075,1719,24,2076,2077,2025,8,2078,2079,765,8,2080,2081,507,8,2082,2083,1247,8,2084,2085,1151,8,2086,2087,2019,8,2088,2089,495,8,2090,2091,2295,8,2092,2093,1935,8,2094,2095,2847,8,2096,2097,1823,8,2098,2099,2299,8,2100,2101,1515,24,2102,2103,1991,8,2104,2105,1599,8,2106,2107,2271,8,2108,2109,893,8,2110,2111,863,8,2112,2113,831,8,2114,2115,1439,8,2116,2117,2549,8,2118,2119,1631,8,2120,2121,2743,8,2122,2123,1455,8,2124,2125,1997,8,2126,2127,1469,8,2128,2129,2491,8,2130,2131,1977,8,2132,2133,2749,8,2134,2135,1463,8,2136,2137,2679,8,2138,2139,1965,8,2140,2141,1781,8,2142,2143,2803,8,2144,2145,2547,8,2146,2147,2995,8,2148,2149,1963,8,2150,2151,2301,8,2152,2153,1971,8,2154,2155,2493,8,2154,2155,2487,8,2156,2157,1647,8,2158,2159,2871,8,2160,2161,891,8,2162,2163,2779,8,2164,2165,1995,8,2166,2167,1525,8,2168,2169,2009,8,2170,2171,2033,8,2172,2173,1013,8,2174,2175,983,8,2176,2177,1853,8,2178,2179,1487,8,2180,2181,2655,8,2182,2183,503,8,2184,2185,2423,8,2186,2187,447,8,2188,2189,1277,8,2190,2191,1913,8,2192,2193,1343,8,2194,2195,2399,8,2196,2197,2719,8,2198,2199,1839,8,2200,2201,1523,8,2202,2203,2041,9,2204,2205,895,9,2206,2207,2495,9,2208,2209,991,9,2210,2211,1527,9,2212,2213,2815,10,2214,2215,1019,9,2216,2217,1887,9,2218,2219,1791,10,2220,2221,2035,9,2222,2223,2811,9,2224,2225,2027,9,2226,2227,2555,9,2228,2229,1023,10,2230,2231,511,9,2232,2233,2047,11,2234,2235,2039,10,2236,2237,2943,10,2238,2239,2559,10,2240,2241,1967,25,2242,2243,2939,9,2244,2245,1903,9,2246,2247,2557,9,2248,2249,2543,9,2250,2251,2799,9,2252,2253,2975,9,2254,2255,1951,9,2256,2257,2783,9,2258,2259,2431,9,2260,2261,1981,9,2262,2263,1015,9,2264,2265,1007,9,2266,2267,2045,10,2268,2269,1533,9,2270,2271,2911,9,2272,2273,959,9,2274,2275,2029,9,2276,2277,1021,9,2278,2279,2941,9,2280,2281,1519,25,2282,2283,1663,9,2284,2285,1775,25,2286,2287,2935,25,2288,2289,1915,25,2290,2291,1975,25,2292,2293,1855,9,2294,2295,2015,10,2296,2297,1535,10,2298,2299,2013,9,2300,2301,1787,9,2302,2303,2303,9,2304,2305,1503,9,2306,2307,2527,9,2308,2309,1759,9,2310,2311,2011,9,2312,2313,767,9,2314,2315,1919,10,2316,2317,2927,9,2318,2319,1471,9,2320,2321,1979,9,2322,2323,2031,10,2324,2325,2807,9,2326,2327,1983,10,2328,2329,2551,9,2330,2331,2999,9,2332,2333,1917,9,2334,2335,1279,9,2336,2337,2879,9,2338,2339,2007,9,2340,2341,1531,9,2342,2343,1727,9,2344,2345,2751,9,2346,2347,2037,9,2348,2349,2687,9,2350,2351,1407,9,2352,2353,1911,9,2354,2355,1783,9,2356,2357,1999,9,2358,2359,2991,9,2360,2361,2023,9,2362,2363,2813,9,2364,2365,719,7,2366,2367,747,7,2368,2369,2793,7,2370,2371,2681,7,2372,2373,829,23,2374,2375,2905,23,2376,2377,2777,23,2378,2379,1373,7,2380,2381,1341,7,2382,2383,1149,7,2382,2383,1213,7,2384,2385,445,7,2384,2385,701,7,2384,2385,381,7,2384,2385,253,7,2386,2387,1245,7,2388,2389,477,7,2390,2391,2365,7,2392,2393,2173,7,2392,2393,2237,7,2394,2395,1359,7,2396,2397,1327,7,2396,2397,1311,7,2398,2399,1199,7,2400,2401,687,7,2402,2403,815,7,2404,2405,1231,7,2406,2407,1207,7,2406,2407,1143,7,2408,2409,823,7,2410,2411,1239,7,2412,2413,471,7,2414,2415,1339,7,2416,2417,1423,7,2418,2419,967,7,2420,2421,1147,7,2422,2423,443,7,2422,2423,251,7,2424,2425,923,7,2426,2427,2447,7,2428,2429,1243,7,2430,2431,1623,7,2432,2433,1615,7,2434,2435,1583,7,2434,2435,1567,7,2436,2437,1591,7,2438,2439,1819,7,2438,2439,1595,7,2440,2441,1815,7,2442,2443,1927,7,2442,2443,1807,7,2444,2445,475,7,2446,2447,2639,7,2448,2449,2607,7,2450,2451,2615,7,2452,2453,2619,7,2454,2455,2831,7,2456,2457,2395,7,2458,2459,2383,7,2460,2461,2351,7,2462,2463,2143,7,2462,2463,2111,7,2464,2465,2255,7,2466,2467,2167,7,2468,2469,2171,7,2470,2471,731,7,2472,2473,2407,7,2474,2475,2279,7,2476,2477,2231,7,2478,2479,2223,7,2480,2481,1431,7,2482,2483,2647,7,2484,2485,2455,7,2486,2487,247,7,2488,2489,2951,7,2490,2491,2293,7,2492,2493,1211,7,2494,2495,637,7,2496,2497,1843,7,2498,2499,1831,7,2500,2501,1987,7,2500,2501,1993,7,2500,2501,1955,7,2500,2501,1961,7,2500,2501,2001,7,2502,2503,1945,7,2502,2503,1939,7,2504,2505,1969,7,2506,2507,1957,7,2506,2507,1989,7,2508,2509,2017,7,2510,2511,1941,7,2512,2497,1715,7,2513,2514,1657,7,2515,2516,2651,7,2517,2518,2397,7,2519,2520,1335,7,2521,2522,2711,7,2523,2524,2703,7,2525,2526,2621,7,2527,2528,1135,7,2529,2530,2267,7,2531,2532,2235,7,2533,2534,1389,7,2535,2536,2425,7,2537,2538,127,7,2539,2540,1753,23,2541,2542,877,23,2543,2544,319,7,2545,2546,671,7,2547,2548,575,7,2547,2548,799,7,2547,2548,607,7,2549,2550,351,7,2549,2550,1119,7,2551,2552,415,7,2551,2552,1183,7,2553,2554,1087,7,2555,2556,623,7,2557,2558,631,7,2559,2560,367,7,2559,2560,239,7,2561,2562,375,7,2563,2564,431,7,2565,2566,439,7,2567,2568,463,7,2569,2570,2867,23,2571,2572,2855,23,2573,2574,2979,23,2573,2574,2985,23,2575,2576,2963,23,2575,2576,2969,23,2577,2578,2993,23,2579,2580,2965,23,2581,2582,755,23,2583,2584,2677,23,2585,2586,2669,7,2587,2588,1497,7,2589,2590,379,7,2591,2592,2839,7,2593,2594,935,7,2595,2596,1367,7,2597,2598,757,7,2599,2600,2869,23,2601,2602,272,33,2603,2604,949,7,2605,2606,1483,7,2607,2608,2521,7,2609,2610,979,7,2611,2612,2771,7,2613,2614,2471,7,2615,2616,971,7,2064,2065,1479,7,2617,2618,981,7,2619,2620,1485,7,2621,2622,985,7,2623,2624,973,7,2625,2626,2861,7,2627,2628,2845,7,2627,2628,2957,7,2629,2628,2717,7,2630,2631,2050,33,2632,2633,520,33,2634,2635,1491,7,2636,2637,1735,7,2638,2639,2981,7,2640,2641,2653,7,2642,2643,2269,7,2644,2645,2283,7,2646,2647,160,33,2648,2649,1875,7,2650,2651,2391,7,2652,2653,2263,7,2654,2655,695,23,2656,2657,2591,7,2658,2659,2159,7,2660,2661,2297,7,2662,2663,1703,7,2664,2665,1465,7,2666,2667,1849,7,2668,2669,1721,7,1650,1651,2489,7,2670,2671,2801,7,2672,2673,941,7,2674,2675,953,7,1688,1689,947,7,2676,2677,939,7,2678,2679,2727,7,1738,1739,1447,7,2680,2681,2291,7,2682,2683,1597,7,2684,2685,2745,7,2686,2687,2763,7,2688,2689,1739,7,2690,2691,2419,7,2692,2693,2739,7,2694,2695,2503,7,2696,2697,1437,7,2698,2699,1371,23,2700,2701,733,23,2702,2703,861,23,2704,2705,847,23,2706,2707,635,23,2708,2709,1627,23,2710,2711,2285,7,2712,2713,2663,7,2714,2715,1877,7,2716,2717,997,7,2718,2719,1273,7,2720,2721,727,7,2722,2723,1651,7,2724,2725,191,7,2726,2727,223,7,2728,2729,4096,33,2730,2731,2363,7,2732,2733,2359,7,2734,2735,1028,33,2736,2737,1679,7,2738,2739,2887,7]
+};
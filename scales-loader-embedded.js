@@ -2,47 +2,174 @@
  * @module ScalesLoader (Embedded Version)
  * @description Loads 1,486 scales from embedded data (no fetch required - CORS-safe)
  * @exports window.SCALES (intervals, meta, categories)
+ * @exports window.ScaleCatalogPacked (lazy record lookup when the packed catalog is loaded)
+ * @feature Restores window.SCALES from the derived-index snapshot (derived-index-snapshot.js) when its hash matches
  */
 
 (function() {
     'use strict';
     
     console.log('ScalesLoader: Loading 1,486 scales from embedded data...');
+
+    /**
+     * Index over the packed catalog (scales-data-packed.js, see scripts/pack-scales.js).
+     * Only ids, names, masks and flags are decoded up front; full legacy records
+     * ({ name, id, intervals, noteCount, ... }) are built the first time they are asked for.
+     */
+    function createPackedCatalog(packed) {
+        const strings = String(packed.strings || '').split('|');
+        const records = packed.records || [];
+        const defaults = packed.defaults || {};
+        const count = Math.floor(records.length / 4);
+
+        const ids = new Array(count);
+        const names = new Array(count);
+        const masks = new Uint16Array(count);
+        const flags = new Uint8Array(count);
+        const lastIndexById = new Map(); // later duplicates override earlier ones, as in buildScaleCatalog
+        for (let i = 0; i < count; i++) {
+            names[i] = strings[records[i * 4]];
+            ids[i] = strings[records[i * 4 + 1]];
+            masks[i] = records[i * 4 + 2];
+            flags[i] = records[i * 4 + 3];
+            lastIndexById.set(ids[i], i);
+        }
+
+        const fullRecords = new Array(count);
+        let byNameKey = null;
+
+        function decodeMask(mask) {
+            const out = [];
+            for (let bit = 0; bit < 16; bit++) {
+                if (mask & (1 << bit)) out.push(bit);
+            }
+            return out;
+        }
+
+        // Fields ScaleTaxonomy.buildScaleCatalog needs for the library list
+        function describe(i) {
+            return {
+                id: ids[i],
+                name: names[i],
+                intervals: decodeMask(masks[i]),
+                noteCount: flags[i] & 15,
+                essential: !!(flags[i] & 16),
+                baseScale: defaults.baseScale
+            };
+        }
+
+        function recordAt(i) {
+            if (!fullRecords[i]) {
+                const intervals = decodeMask(masks[i]);
+                fullRecords[i] = {
+                    name: names[i],
+                    id: ids[i],
+                    // Keep the original string form for the few entries written that way upstream
+                    intervals: (flags[i] & 32) ? JSON.stringify(intervals).replace(/,/g, ', ') : intervals,
+                    noteCount: flags[i] & 15,
+                    aiTransformed: defaults.aiTransformed,
+                    essential: !!(flags[i] & 16),
+                    baseScale: defaults.baseScale,
+                    baseName: defaults.baseName
+                };
+            }
+            return fullRecords[i];
+        }
+
+        return {
+            count,
+            has(id) { return lastIndexById.has(id); },
+            getMask(id) { return lastIndexById.has(id) ? masks[lastIndexById.get(id)] : null; },
+            getIntervals(id) { return lastIndexById.has(id) ? decodeMask(masks[lastIndexById.get(id)]) : null; },
+            getRecord(id) { return lastIndexById.has(id) ? recordAt(lastIndexById.get(id)) : null; },
+            // Lookup by lowercased id, or by name with whitespace collapsed to underscores
+            findByIdOrName(key) {
+                const k = String(key || '').toLowerCase();
+                if (!byNameKey) {
+                    byNameKey = new Map();
+                    for (let i = 0; i < count; i++) {
+                        const idKey = String(ids[i]).toLowerCase();
+                        const nameKey = String(names[i]).toLowerCase().replace(/\s+/g, '_');
+                        if (!byNameKey.has(idKey)) byNameKey.set(idKey, i);
+                        if (!byNameKey.has(nameKey)) byNameKey.set(nameKey, i);
+                    }
+                }
+                return byNameKey.has(k) ? recordAt(byNameKey.get(k)) : null;
+            },
+            describeAll() {
+                const out = new Array(count);
+                for (let i = 0; i < count; i++) out[i] = describe(i);
+                return out;
+            },
+            allRecords() {
+                const out = new Array(count);
+                for (let i = 0; i < count; i++) out[i] = recordAt(i);
+                return out;
+            }
+        };
+    }
+
+    const PACKED = window.EMBEDDED_SCALES_PACKED || null;
+    if (PACKED && !window.EMBEDDED_SCALES_DATA) {
+        const catalog = createPackedCatalog(PACKED);
+        window.ScaleCatalogPacked = catalog;
+        // Legacy consumers still read EMBEDDED_SCALES_DATA.scales; materialize it only if they do
+        let legacy = null;
+        Object.defineProperty(window, 'EMBEDDED_SCALES_DATA', {
+            configurable: true,
+            get() {
+                if (!legacy) legacy = { scales: catalog.allRecords() };
+                return legacy;
+            }
+        });
+    }
     
     // Embedded scales data - generated from scraped-scales-data.json
     // This avoids CORS issues when running from file:// protocol
-    const EMBEDDED_SCALES_DATA = window.EMBEDDED_SCALES_DATA || null;
+    const catalogSource = window.ScaleCatalogPacked
+        ? { scales: window.ScaleCatalogPacked.describeAll() }
+        : (window.EMBEDDED_SCALES_DATA || null);
     
-    if (!EMBEDDED_SCALES_DATA) {
-        console.error('ScalesLoader: EMBEDDED_SCALES_DATA not found! Make sure scales-data-embedded.js is loaded first.');
+    if (!catalogSource) {
+        console.error('ScalesLoader: scale data not found! Make sure scales-data-packed.js (or scales-data-embedded.js) is loaded first.');
         useFallbackScales();
         return;
     }
     
+    const snapshot = window.derivedIndexSnapshot || null;
+    const SNAPSHOT_SECTION = 'scaleCatalog';
+    const SNAPSHOT_SIGNATURE = 'catalog-v1'; // bump when buildScaleCatalog's output changes shape
+
     try {
-        const data = EMBEDDED_SCALES_DATA;
+        const data = catalogSource;
         console.log(`ScalesLoader: Loaded ${data.scales.length} scales`);
 
+        const publishCatalog = (catalog, origin) => {
+            window.SCALES = catalog;
+
+            console.log(`ScalesLoader: ✓ Scales ${origin} and available as window.SCALES`);
+            console.log(`  - ${Object.keys(window.SCALES.intervals).length} scales`);
+            console.log(`  - ${Object.keys(window.SCALES.meta.categories).length} families`);
+            console.log(`  - ${window.SCALES.meta.essentialScales.length} essential scales`);
+
+            // Dispatch event to notify app that scales are ready
+            window.dispatchEvent(new CustomEvent('scalesLoaded', {
+                detail: {
+                    scaleCount: data.scales.length,
+                    categories: Object.keys(window.SCALES.meta.categories),
+                    essentialCount: window.SCALES.meta.essentialScales.length
+                }
+            }));
+        };
+
         const buildFromEmbedded = (attemptsLeft) => {
             const taxonomyUtils = window.ScaleTaxonomy;
             if (taxonomyUtils && typeof taxonomyUtils.buildScaleCatalog === 'function') {
                 try {
                     const cats = data.categories || null;
-                    window.SCALES = taxonomyUtils.buildScaleCatalog(data.scales, cats);
-
-                    console.log('ScalesLoader: ✓ Scales loaded and available as window.SCALES');
-                    console.log(`  - ${Object.keys(window.SCALES.intervals).length} scales`);
-                    console.log(`  - ${Object.keys(window.SCALES.meta.categories).length} families`);
-                    console.log(`  - ${window.SCALES.meta.essentialScales.length} essential scales`);
-
-                    // Dispatch event to notify app that scales are ready
-                    window.dispatchEvent(new CustomEvent('scalesLoaded', {
-                        detail: {
-                            scaleCount: data.scales.length,
-                            categories: Object.keys(window.SCALES.meta.categories),
-                            essentialCount: window.SCALES.meta.essentialScales.length
-                        }
-                    }));
+                    const catalog = taxonomyUtils.buildScaleCatalog(data.scales, cats);
+                    publishCatalog(catalog, 'loaded');
+                    if (snapshot) snapshot.put(SNAPSHOT_SECTION, SNAPSHOT_SIGNATURE, () => encodeCatalog(catalog));
                     return;
                 } catch (e) {
                     console.error('ScalesLoader: Error building catalog from embedded data:', e);
@@ -59,12 +186,91 @@
             }
         };
 
-        buildFromEmbedded(20);
+        let materialized = false;
+        let deferred = false;
+        const materialize = () => {
+            if (materialized) return;
+            materialized = true;
+            if (deferred) delete window.SCALES; // drop the getter so the build below assigns a plain value
+            const restored = restoreCatalog(snapshot && snapshot.take(SNAPSHOT_SECTION, SNAPSHOT_SIGNATURE));
+            if (restored) publishCatalog(restored, 'restored from snapshot');
+            else buildFromEmbedded(20);
+        };
+
+        if (snapshot && !snapshot.loaded) {
+            deferred = true;
+            // Wait for the stored catalog, but build on the spot if anything reads SCALES before it lands
+            Object.defineProperty(window, 'SCALES', {
+                configurable: true,
+                enumerable: true,
+                get() { materialize(); return window.SCALES; },
+                set(value) {
+                    materialized = true;
+                    Object.defineProperty(window, 'SCALES', { value, writable: true, configurable: true, enumerable: true });
+                }
+            });
+            snapshot.ready.then(materialize);
+        } else {
+            materialize();
+        }
     } catch (error) {
         console.error('ScalesLoader: Failed to process embedded scales:', error);
         useFallbackScales();
     }
-    
+
+    /**
+     * Snapshot payload: scale ids with interval masks, plus the meta tree as JSON.
+     * Interval lists a mask can't reproduce exactly (unsorted, duplicates, > 15) are kept verbatim.
+     */
+    function encodeCatalog(catalog) {
+        const ids = Object.keys(catalog.intervals);
+        const masks = new Uint16Array(ids.length);
+        const irregular = {};
+        ids.forEach((id, i) => {
+            const intervals = catalog.intervals[id];
+            let mask = 0;
+            let last = -1;
+            const regular = Array.isArray(intervals) && intervals.every(n => {
+                const ok = Number.isInteger(n) && n > last && n < 16;
+                last = n;
+                mask |= 1 << n;
+                return ok;
+            });
+            if (regular) masks[i] = mask;
+            else irregular[id] = intervals;
+        });
+        return {
+            ids: DerivedIndexSnapshot.joinStrings(ids),
+            masks,
+            irregular: JSON.stringify(irregular),
+            meta: JSON.stringify(catalog.meta)
+        };
+    }
+
+    function restoreCatalog(payload) {
+        if (!payload) return null;
+        try {
+            const ids = DerivedIndexSnapshot.splitStrings(payload.ids);
+            const irregular = JSON.parse(payload.irregular);
+            const intervals = {};
+            ids.forEach((id, i) => {
+                if (Object.prototype.hasOwnProperty.call(irregular, id)) {
+                    intervals[id] = irregular[id];
+                    return;
+                }
+                const out = [];
+                for (let bit = 0; bit < 16; bit++) {
+                    if (payload.masks[i] & (1 << bit)) out.push(bit);
+                }
+                intervals[id] = out;
+            });
+            return { intervals, meta: JSON.parse(payload.meta) };
+        } catch (e) {
+            console.warn('ScalesLoader: Stored catalog unreadable, rebuilding', e);
+            return null;
+        }
+    }
+
     function useFallbackScales() {
         // Fallback to minimal scales so app doesn't break
         window.SCALES = {
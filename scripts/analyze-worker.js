@@ -0,0 +1,14 @@
+// worker_threads entry for scripts/analyze.js: builds one warm analyzer, then answers
+// { batch: [[seq, record], ...] } with { batch: [[seq, result], ...], timings }.
+
+const { parentPort, workerData } = require('worker_threads');
+const { createBatchAnalyzer } = require('./batch-analysis.js');
+
+const analyzer = createBatchAnalyzer(workerData || {});
+parentPort.postMessage({ ready: true });
+
+parentPort.on('message', ({ batch }) => {
+  const timings = {};
+  const results = batch.map(([seq, record]) => [seq, analyzer.analyze(record, timings)]);
+  parentPort.postMessage({ batch: results, timings });
+});
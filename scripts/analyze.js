@@ -0,0 +1,244 @@
+// Headless batch analysis: newline-delimited JSON in, newline-delimited JSON out.
+// Usage: `npm run analyze -- corpus.ndjson > results.ndjson`
+//        `cat corpus.ndjson | node scripts/analyze.js --workers=4 --batch=32 --unordered`
+//
+// Flags: --workers=N       pool size (default: CPU count - 1; 0 runs in this thread)
+//        --batch=N         records per worker message (default 32)
+//        --unordered       write results as they finish instead of in input order
+//        --output=FILE     write to FILE instead of stdout
+//        --grading-mode=M  functional | emotional | color
+//        --top=N           container chords kept per record (default 12)
+//        --quiet           no progress lines (the final summary is always printed)
+//
+// Record format is documented in scripts/batch-analysis.js. Each worker loads the engines
+// once and keeps them warm; throughput and per-op time go to stderr so stdout stays NDJSON.
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const readline = require('readline');
+const { Worker } = require('worker_threads');
+const { createBatchAnalyzer } = require('./batch-analysis.js');
+
+function parseArgs(argv) {
+  const args = {
+    input: null, output: null, workers: Math.max(1, os.cpus().length - 1), batch: 32,
+    ordered: true, gradingMode: null, topContainers: 12, quiet: false
+  };
+  argv.forEach(arg => {
+    if (!arg.startsWith('--')) { args.input = arg; return; }
+    const [flag, value] = arg.slice(2).split('=');
+    if (flag === 'workers') args.workers = Math.max(0, Number(value) | 0);
+    else if (flag === 'batch') args.batch = Math.max(1, Number(value) | 0);
+    else if (flag === 'unordered') args.ordered = false;
+    else if (flag === 'output') args.output = value;
+    else if (flag === 'grading-mode') args.gradingMode = value;
+    else if (flag === 'top') args.topContainers = Math.max(1, Number(value) | 0);
+    else if (flag === 'quiet') args.quiet = true;
+  });
+  return args;
+}
+
+/**
+ * Fixed pool of analyzer workers. Each worker holds at most `maxInFlight` batches, and
+ * submit() waits for a free slot, so input is read only as fast as workers drain it.
+ */
+class AnalyzerPool {
+  constructor(size, workerData, onResults) {
+    this.onResults = onResults;
+    this.maxInFlight = 2;
+    this.waiters = [];
+    this.workers = Array.from({ length: size }, () => this._spawn(workerData));
+  }
+
+  _spawn(workerData) {
+    const slot = { worker: new Worker(path.join(__dirname, 'analyze-worker.js'), { workerData }), inFlight: [] };
+    slot.ready = new Promise((resolve, reject) => {
+      slot.worker.once('error', reject);
+      slot.worker.on('message', (msg) => {
+        if (msg.ready) { resolve(); return; }
+        slot.inFlight.shift();
+        this.onResults(msg.batch, msg.timings);
+        this._wake();
+      });
+    });
+    slot.worker.on('error', (err) => {
+      // A crashed worker fails the records it held rather than hanging the run
+      const lost = slot.inFlight.splice(0);
+      lost.forEach(batch => this.onResults(batch.map(([seq, record]) => [seq, {
+        id: record && record.id, ok: false, error: `worker crashed: ${err.message}`
+      }]), {}));
+      slot.dead = true;
+      this._wake();
+    });
+    return slot;
+  }
+
+  start() {
+    return Promise.all(this.workers.map(slot => slot.ready));
+  }
+
+  async submit(batch) {
+    let slot;
+    while (!(slot = this._freeSlot())) {
+      if (this.workers.every(w => w.dead)) throw new Error('all analysis workers crashed');
+      await new Promise(resolve => this.waiters.push(resolve));
+    }
+    slot.inFlight.push(batch);
+    slot.worker.postMessage({ batch });
+  }
+
+  async drain() {
+    while (this.workers.some(slot => !slot.dead && slot.inFlight.length)) {
+      await new Promise(resolve => this.waiters.push(resolve));
+    }
+  }
+
+  terminate() {
+    return Promise.all(this.workers.map(slot => slot.worker.terminate()));
+  }
+
+  _freeSlot() {
+    let best = null;
+    this.workers.forEach(slot => {
+      if (slot.dead || slot.inFlight.length >= this.maxInFlight) return;
+      if (!best || slot.inFlight.length < best.inFlight.length) best = slot;
+    });
+    return best;
+  }
+
+  _wake() {
+    this.waiters.splice(0).forEach(resolve => resolve());
+  }
+}
+
+/**
+ * Writes results to the stream, holding early arrivals until their predecessors land when ordered
+ */
+class ResultWriter {
+  constructor(stream, ordered) {
+    this.stream = stream;
+    this.ordered = ordered;
+    this.pending = new Map();
+    this.next = 0;
+    this.buffer = [];
+  }
+
+  add(seq, result) {
+    if (!this.ordered) {
+      this.buffer.push(JSON.stringify(result));
+      return;
+    }
+    this.pending.set(seq, result);
+    while (this.pending.has(this.next)) {
+      this.buffer.push(JSON.stringify(this.pending.get(this.next)));
+      this.pending.delete(this.next++);
+    }
+  }
+
+  async flush() {
+    if (!this.buffer.length) return;
+    const chunk = this.buffer.join('\n') + '\n';
+    this.buffer = [];
+    if (!this.stream.write(chunk)) await new Promise(resolve => this.stream.once('drain', resolve));
+  }
+}
+
+function createStats() {
+  return { started: process.hrtime.bigint(), records: 0, errors: 0, timings: {} };
+}
+
+function addTimings(stats, timings) {
+  Object.entries(timings || {}).forEach(([op, ms]) => { stats.timings[op] = (stats.timings[op] || 0) + ms; });
+}
+
+function formatStats(stats, workers) {
+  const seconds = Number(process.hrtime.bigint() - stats.started) / 1e9;
+  const rate = stats.records / (seconds || 1);
+  const ops = Object.entries(stats.timings)
+    .map(([op, ms]) => `${op} ${(ms / (stats.records || 1)).toFixed(2)}ms`)
+    .join(', ');
+  return `[analyze] ${stats.records} records (${stats.errors} errors) in ${seconds.toFixed(1)}s, ` +
+    `${rate.toFixed(1)} records/s on ${workers || 'main'} ${workers === 1 ? 'worker' : workers ? 'workers' : 'thread'}` +
+    (ops ? `; per record: ${ops}` : '');
+}
+
+function parseLine(line, lineNumber) {
+  try {
+    return { record: JSON.parse(line) };
+  } catch (err) {
+    return { error: { ok: false, line: lineNumber, error: `invalid JSON: ${err.message}` } };
+  }
+}
+
+async function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const input = args.input ? fs.createReadStream(args.input) : process.stdin;
+  const output = args.output ? fs.createWriteStream(args.output) : process.stdout;
+  const writer = new ResultWriter(output, args.ordered);
+  const stats = createStats();
+  const analyzerOptions = { gradingMode: args.gradingMode, topContainers: args.topContainers };
+
+  const onResults = (results, timings) => {
+    results.forEach(([seq, result]) => {
+      stats.records++;
+      if (!result.ok) stats.errors++;
+      writer.add(seq, result);
+    });
+    addTimings(stats, timings);
+  };
+
+  const analyzer = args.workers === 0 ? createBatchAnalyzer(analyzerOptions) : null;
+  const pool = analyzer ? null : new AnalyzerPool(args.workers, analyzerOptions, onResults);
+  if (pool) await pool.start();
+  // Engine warmup isn't charged to throughput
+  stats.started = process.hrtime.bigint();
+
+  const progress = args.quiet ? null : setInterval(() => process.stderr.write(formatStats(stats, args.workers) + '\n'), 2000);
+  if (progress) progress.unref();
+
+  const lines = readline.createInterface({ input, crlfDelay: Infinity });
+  let seq = 0;
+  let lineNumber = 0;
+  let batch = [];
+  const dispatch = async () => {
+    if (!batch.length) return;
+    const current = batch;
+    batch = [];
+    if (pool) {
+      await pool.submit(current);
+    } else {
+      const timings = {};
+      onResults(current.map(([s, record]) => [s, analyzer.analyze(record, timings)]), timings);
+    }
+    await writer.flush();
+  };
+
+  for await (const line of lines) {
+    lineNumber++;
+    if (!line.trim()) continue;
+    const { record, error } = parseLine(line, lineNumber);
+    if (error) {
+      onResults([[seq++, error]], {});
+      continue;
+    }
+    batch.push([seq++, record]);
+    if (batch.length >= args.batch) await dispatch();
+  }
+  await dispatch();
+  if (pool) {
+    await pool.drain();
+    await pool.terminate();
+  }
+  await writer.flush();
+  if (progress) clearInterval(progress);
+  if (args.output) await new Promise(resolve => output.end(resolve));
+
+  process.stderr.write(formatStats(stats, args.workers) + '\n');
+  if (stats.errors) process.exitCode = 2;
+}
+
+main().catch(err => {
+  console.error('[analyze]', err && err.stack ? err.stack : err);
+  process.exitCode = 1;
+});
@@ -0,0 +1,117 @@
+// Per-record analysis for the headless batch CLI (scripts/analyze.js).
+// One analyzer owns one warm set of engines; the CLI creates one per worker thread.
+//
+// Input record (one JSON object per line; a bare JSON string is treated as { text }):
+//   { "id": "a1", "key": "C", "scale": "major",
+//     "notes": ["C", "E"],                      container chords holding these notes, graded
+//     "progression": ["Cmaj7", "Am7", "G7"],    voice-leading cost, per-chord grade and attributes
+//     "text": "dark lonely night",              context parse -> scale recommendation
+//     "ops": ["containers", "voiceLeading"] }   optional subset of OPS (default: all that apply)
+
+const { loadBrowserScripts, ENGINE_FILES } = require('./engine-sandbox.js');
+
+const OPS = ['containers', 'voiceLeading', 'grades', 'attributes', 'context'];
+
+function createBatchAnalyzer(options = {}) {
+  const ctx = loadBrowserScripts(ENGINE_FILES, { verbose: options.verbose });
+  const AnalysisService = ctx.get('AnalysisService');
+  const engines = AnalysisService.createEngineProvider();
+  const handlers = AnalysisService.createAnalysisHandlers(engines);
+  const theory = engines.musicTheory();
+  if (options.gradingMode) theory.setGradingMode(options.gradingMode);
+
+  let attributes = null;
+  let containerTool = null;
+  const attributeEngine = () => attributes || (attributes = new (ctx.get('ChordAttributeEngine'))());
+  const chordTool = () => containerTool || (containerTool = new (ctx.get('ContainerChordTool'))(theory));
+  const topContainers = options.topContainers || 12;
+
+  const sections = {
+    containers(record) {
+      if (!Array.isArray(record.notes) || !record.notes.length) return undefined;
+      const scaleNotes = theory.getScaleNotes(record.key, record.scale) || [];
+      const chords = handlers.findAllContainerChords({ notes: record.notes, scaleNotes });
+      // ContainerChordTool grades relative to a selected note; use the first input note
+      const tool = chordTool();
+      Object.assign(tool.state, { selectedNote: record.notes[0], currentKey: record.key, currentScale: record.scale });
+      const graded = chords.map(chord => ({ chord, grade: tool.getChordGrade(chord) }))
+        .sort((a, b) => b.grade.tier - a.grade.tier || b.chord.scaleMatchPercent - a.chord.scaleMatchPercent);
+      return {
+        count: chords.length,
+        top: graded.slice(0, topContainers).map(({ chord, grade }) => ({
+          name: chord.fullName,
+          notes: chord.chordNotes,
+          scaleMatchPercent: chord.scaleMatchPercent,
+          functions: chord.functions,
+          tier: grade.tier,
+          grade: grade.label
+        }))
+      };
+    },
+    voiceLeading(record) {
+      if (!Array.isArray(record.progression) || record.progression.length < 2) return undefined;
+      const voicings = handlers.generateVoiceLeading({ chordSymbols: record.progression });
+      return {
+        cost: engines.voiceLeading().calculatePathCost(voicings),
+        voicings: voicings.map(step => ({ chord: step.chord, voices: step.voices, movement: step.movement }))
+      };
+    },
+    grades(record) {
+      if (!Array.isArray(record.progression) || !record.progression.length) return undefined;
+      return record.progression.map(chord => {
+        const { tier, info } = theory.getElementGrading(chord, { key: record.key, scaleType: record.scale, elementType: 'chord' });
+        return { chord, tier, grade: info.label };
+      });
+    },
+    attributes(record) {
+      if (!Array.isArray(record.progression) || !record.progression.length) return undefined;
+      return record.progression.map(chord => {
+        const { attributes: a } = attributeEngine().analyzeChord(chord);
+        return { chord, tension: a.tension, brightness: a.brightness, stability: a.stability, warmth: a.warmth, mood: a.mood };
+      });
+    },
+    context(record) {
+      if (typeof record.text !== 'string' || !record.text.trim()) return undefined;
+      const parsed = handlers.parseInput({ input: record.text });
+      const profile = parsed.harmonicProfile || {};
+      return {
+        emotionalTone: parsed.emotionalTone,
+        intensity: parsed.intensity,
+        root: profile.root,
+        recommendedScale: profile.recommendedScale,
+        approachScale: profile.approachScale,
+        alternatives: profile.alternatives,
+        scaleNotes: profile.scaleNotes
+      };
+    }
+  };
+
+  /**
+   * Analyze one record. Never throws: failures come back as { ok: false, error }.
+   * `timings` (op -> ms) accumulates per-op cost for throughput reporting.
+   */
+  function analyze(input, timings = {}) {
+    const record = typeof input === 'string' ? { text: input } : input;
+    if (!record || typeof record !== 'object' || Array.isArray(record)) {
+      return { ok: false, error: 'record must be a JSON object or string' };
+    }
+    const normalized = { ...record, key: record.key || 'C', scale: record.scale || 'major' };
+    const ops = Array.isArray(record.ops) ? record.ops.filter(op => OPS.includes(op)) : OPS;
+    const out = { id: record.id, ok: true, key: normalized.key, scale: normalized.scale };
+    try {
+      ops.forEach(op => {
+        const t0 = process.hrtime.bigint();
+        const result = sections[op](normalized);
+        timings[op] = (timings[op] || 0) + Number(process.hrtime.bigint() - t0) / 1e6;
+        if (result !== undefined) out[op] = result;
+      });
+    } catch (err) {
+      return { id: record.id, ok: false, error: (err && err.message) || String(err) };
+    }
+    return out;
+  }
+
+  return { analyze, engines };
+}
+
+module.exports = { OPS, createBatchAnalyzer };
@@ -0,0 +1,61 @@
+// Loads the browser engine scripts into a Node vm sandbox (window/self stand-ins, quiet console).
+// Shared by the batch analysis CLI (scripts/analyze.js) and the bench suite (bench/).
+
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const ROOT = path.resolve(__dirname, '..');
+
+const CATALOG_FILES = ['scales-data-packed.js', 'scale-taxonomy.js', 'scales-loader-embedded.js'];
+
+// Same load order as analysis-worker.js, plus the engines it doesn't need
+const ENGINE_FILES = [
+  ...CATALOG_FILES,
+  'music-theory-engine.js',
+  'voice-leading-engine.js',
+  'unified-chord-explorer.js',
+  'scale-relationship-explorer.js',
+  'chord-attribute-engine.js',
+  'container-chord-tool.js',
+  'compromise.min.js',
+  'nrc-lexicon.js',
+  'lexicon-index.js',
+  'offline-thesaurus.js',
+  'local-music-lexicon.js',
+  'word-database.js',
+  'scale-intelligence-engine.js',
+  'context-engine.js',
+  'analysis-service.js'
+];
+
+const scriptCache = new Map();
+function compileScript(file) {
+  if (!scriptCache.has(file)) {
+    const source = fs.readFileSync(path.join(ROOT, file), 'utf8');
+    scriptCache.set(file, new vm.Script(source, { filename: file }));
+  }
+  return scriptCache.get(file);
+}
+
+/**
+ * Evaluate browser scripts in one sandbox. Top-level classes become readable through ctx.get('ClassName').
+ */
+function loadBrowserScripts(files, options = {}) {
+  const quiet = { log() {}, info() {}, warn() {}, error: console.error, debug() {} };
+  const ctx = {
+    console: options.verbose ? console : quiet,
+    setTimeout, clearTimeout, setInterval, clearInterval, performance,
+    CustomEvent: class CustomEvent { constructor(type, init) { this.type = type; this.detail = init && init.detail; } },
+    dispatchEvent() { return true; }, addEventListener() {}, removeEventListener() {}
+  };
+  ctx.window = ctx;
+  ctx.self = ctx;
+  ctx.globalThis = ctx;
+  vm.createContext(ctx);
+  files.forEach(file => compileScript(file).runInContext(ctx));
+  ctx.get = (name) => vm.runInContext(`typeof ${name} !== 'undefined' ? ${name} : undefined`, ctx);
+  return ctx;
+}
+
+module.exports = { ROOT, CATALOG_FILES, ENGINE_FILES, compileScript, loadBrowserScripts };
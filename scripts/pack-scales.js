@@ -0,0 +1,93 @@
+// Packs scales-data-embedded.js into scales-data-packed.js (compact catalog loaded by the page).
+// Usage: `npm run pack:scales` after editing the embedded scale data.
+//
+// Format 'mask12-v1':
+//   strings: interned scale names/ids joined with '|'
+//   records: flat int array, 4 ints per scale in source order:
+//     [nameIndex, idIndex, intervalMask, flags]
+//     intervalMask: bit n set when interval n is in the scale (source data also has a single [12])
+//     flags: bits 0-3 noteCount, bit 4 essential, bit 5 intervals were written as a string literal
+//   defaults: fields that are identical for every scale
+
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const ROOT = path.resolve(__dirname, '..');
+const SOURCE = path.join(ROOT, 'scales-data-embedded.js');
+const TARGET = path.join(ROOT, 'scales-data-packed.js');
+
+const DEFAULTS = { aiTransformed: false, baseScale: true, baseName: '' };
+
+function loadEmbedded() {
+  const sandbox = { window: {} };
+  vm.runInNewContext(fs.readFileSync(SOURCE, 'utf8'), sandbox, { filename: SOURCE });
+  const data = sandbox.window.EMBEDDED_SCALES_DATA;
+  if (!data || !Array.isArray(data.scales)) throw new Error('EMBEDDED_SCALES_DATA.scales not found');
+  return data.scales;
+}
+
+function parseIntervals(raw) {
+  if (Array.isArray(raw)) return { list: raw, fromString: false };
+  if (typeof raw === 'string') return { list: JSON.parse(raw.replace(/'/g, '"')), fromString: true };
+  throw new Error(`Unsupported intervals value: ${JSON.stringify(raw)}`);
+}
+
+function pack(scales) {
+  const strings = [];
+  const stringIndex = new Map();
+  const intern = (s) => {
+    const value = String(s);
+    if (value.includes('|')) throw new Error(`String contains separator: ${value}`);
+    if (!stringIndex.has(value)) {
+      stringIndex.set(value, strings.length);
+      strings.push(value);
+    }
+    return stringIndex.get(value);
+  };
+
+  const records = [];
+  scales.forEach((scale) => {
+    Object.keys(DEFAULTS).forEach((key) => {
+      if (scale[key] !== DEFAULTS[key]) {
+        throw new Error(`Scale ${scale.id} has non-default ${key}; extend the packed format first`);
+      }
+    });
+
+    const { list, fromString } = parseIntervals(scale.intervals);
+    let mask = 0;
+    list.forEach((iv, i) => {
+      if (!Number.isInteger(iv) || iv < 0 || iv > 12) throw new Error(`Scale ${scale.id} has interval ${iv}`);
+      if (i > 0 && iv <= list[i - 1]) throw new Error(`Scale ${scale.id} intervals are not ascending`);
+      mask |= (1 << iv);
+    });
+    if (!Number.isInteger(scale.noteCount) || scale.noteCount < 0 || scale.noteCount > 15) {
+      throw new Error(`Scale ${scale.id} has noteCount ${scale.noteCount}`);
+    }
+
+    const flags = scale.noteCount | (scale.essential ? 16 : 0) | (fromString ? 32 : 0);
+    records.push(intern(scale.name), intern(scale.id), mask, flags);
+  });
+
+  return { format: 'mask12-v1', count: scales.length, defaults: DEFAULTS, strings: strings.join('|'), records };
+}
+
+function main() {
+  const scales = loadEmbedded();
+  const packed = pack(scales);
+  const body = [
+    '// Generated by scripts/pack-scales.js from scales-data-embedded.js - do not edit by hand.',
+    'window.EMBEDDED_SCALES_PACKED = {',
+    `  "format": ${JSON.stringify(packed.format)},`,
+    `  "count": ${packed.count},`,
+    `  "defaults": ${JSON.stringify(packed.defaults)},`,
+    `  "strings": ${JSON.stringify(packed.strings)},`,
+    `  "records": [${packed.records.join(',')}]`,
+    '};',
+    ''
+  ].join('\n');
+  fs.writeFileSync(TARGET, body);
+  console.log(`[pack-scales] ${packed.count} scales -> ${path.basename(TARGET)} (${body.length} bytes)`);
+}
+
+main();
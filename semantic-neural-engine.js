@@ -1,69 +1,452 @@
 /**
  * semantic-neural-engine.js
- * 
+ *
  * THE ULTIMATE UPGRADE.
  * This script enables local LLM-based semantic understanding using Transformers.js.
- * 
+ *
  * It requires the following files to be present in your project:
  * 1. transformers.min.js
  * 2. /models/all-MiniLM-L6-v2/ (ONNX model files)
+ *
+ * The pipeline runs in semantic-neural-worker.js when Workers are available
+ * (main thread otherwise). Texts requested in the same frame are embedded as
+ * one batch; embeddings are kept in an LRU and in IndexedDB keyed by
+ * normalized text. Mood and scale anchors are embedded once into a matrix so
+ * a profile is one matrix-vector product.
  */
 
 class SemanticNeuralEngine {
-    constructor() {
+    /**
+     * @param {Object} options - { workerUrl, useWorker, model, cacheLimit, persist }
+     */
+    constructor(options = {}) {
         this.model = null;
         this.tokenizer = null;
         this.isReady = false;
         this.physicsEngine = new SemanticContourEngine(); // Fallback
+
+        this.modelId = options.model || 'Xenova/all-MiniLM-L6-v2';
+        this.workerUrl = options.workerUrl || 'semantic-neural-worker.js';
+        this.useWorker = options.useWorker !== false;
+        this.worker = null;
+        this.pipe = null;
+        this.dim = 0;
+
+        this.cacheLimit = options.cacheLimit || 512;
+        this.cache = new Map();         // normalized text -> Float32Array (LRU by insertion order)
+        this.persist = options.persist !== false;
+        this.dbPromise = null;
+
+        this.queue = new Map();         // normalized text -> [{ resolve, reject }]
+        this.flushScheduled = false;
+        this.requests = new Map();      // batch id -> { texts, resolve, reject }
+        this.nextRequestId = 1;
+
+        this.anchors = null;            // { labels, kinds, matrix: Float32Array(count * dim) }
+        this.stats = { hits: 0, persistedHits: 0, embedded: 0, batches: 0 };
     }
 
     async init() {
-        if (typeof pipeline === 'undefined') {
-            console.warn('Transformers.js not found. Neural Engine disabled. Using Physics Engine fallback.');
-            return;
+        if (this.useWorker && typeof Worker !== 'undefined' && await this._initWorker()) {
+            this.isReady = true;
+        } else {
+            if (typeof pipeline === 'undefined') {
+                console.warn('Transformers.js not found. Neural Engine disabled. Using Physics Engine fallback.');
+                return;
+            }
+
+            try {
+                console.log('🧠 Initializing Local Neural Engine (100MB model)...');
+
+                // This expects the model to be in a local /models/ folder
+                // You can download this from HuggingFace
+                this.pipe = await pipeline('feature-extraction', this.modelId, SemanticNeuralEngine.PIPELINE_OPTIONS);
+                this.isReady = true;
+            } catch (err) {
+                console.error('❌ Neural Engine failed to load:', err);
+                return;
+            }
         }
 
         try {
-            console.log('🧠 Initializing Local Neural Engine (100MB model)...');
-            
-            // This expects the model to be in a local /models/ folder
-            // You can download this from HuggingFace
-            this.pipe = await pipeline('feature-extraction', 'Xenova/all-MiniLM-L6-v2', {
-                local_files_only: true, // Force offline
-                model_file_name: 'model_quantized', // Use smaller 30MB version
-            });
-
-            this.isReady = true;
+            await this._buildAnchors();
             console.log('✅ Neural Engine Ready.');
         } catch (err) {
-            console.error('❌ Neural Engine failed to load:', err);
+            console.error('❌ Neural Engine anchors failed:', err);
+            this.isReady = false;
         }
     }
 
+    _initWorker() {
+        return new Promise((resolve) => {
+            let worker;
+            try {
+                worker = new Worker(this.workerUrl);
+            } catch (err) {
+                console.warn('[SemanticNeuralEngine] Worker unavailable, using main thread:', err && err.message);
+                resolve(false);
+                return;
+            }
+            const fail = (message) => {
+                console.warn('[SemanticNeuralEngine] Worker pipeline failed:', message);
+                worker.terminate();
+                if (this.worker === worker) this._abandonWorker(message);
+                resolve(false);
+            };
+            worker.onmessage = (e) => {
+                const msg = e.data || {};
+                if (msg.type === 'ready') {
+                    this.worker = worker;
+                    this.dim = msg.dim;
+                    worker.onmessage = (ev) => this._onWorkerMessage(ev.data || {});
+                    resolve(true);
+                } else if (msg.type === 'fatal') {
+                    fail(msg.error);
+                }
+            };
+            worker.onerror = (e) => fail(e && e.message);
+            worker.postMessage({ type: 'init', model: this.modelId, options: SemanticNeuralEngine.PIPELINE_OPTIONS });
+        });
+    }
+
+    _onWorkerMessage(msg) {
+        const request = this.requests.get(msg.id);
+        if (!request) return;
+        this.requests.delete(msg.id);
+        if (msg.error) request.reject(new Error(msg.error));
+        else request.resolve({ data: msg.data, dim: msg.dim });
+    }
+
+    _abandonWorker(reason) {
+        this.worker = null;
+        this.isReady = !!this.pipe;
+        for (const [, request] of this.requests) request.reject(new Error(reason || 'Neural worker stopped'));
+        this.requests.clear();
+    }
+
     async parseInput(text) {
         if (!this.isReady) {
             return this.physicsEngine.parseInput(text);
         }
 
         // 1. Get Neural Embeddings
-        const output = await this.pipe(text, { pooling: 'mean', normalize: true });
-        const vector = output.data;
+        let vector;
+        try {
+            vector = await this.embed(text);
+        } catch (err) {
+            console.warn('[SemanticNeuralEngine] Embedding failed, using physics profile:', err && err.message);
+            return this.physicsEngine.parseInput(text);
+        }
 
         // 2. Map high-dimensional vector to Musical Archetypes
         // (This uses pre-calculated "anchor" vectors for Dark, Bright, etc.)
         const profile = this.mapVectorToMusicalProfile(vector, text);
-        
+
         return profile;
     }
 
+    /**
+     * Profiles for several texts; all uncached embeddings go out as one batch
+     */
+    async parseInputMany(texts) {
+        if (!this.isReady) return texts.map(text => this.physicsEngine.parseInput(text));
+        const vectors = await this.embedMany(texts);
+        return texts.map((text, i) => this.mapVectorToMusicalProfile(vectors[i], text));
+    }
+
     mapVectorToMusicalProfile(vector, text) {
-        // This is where the magic happens. 
+        // This is where the magic happens.
         // We compare your input's "Neural DNA" to the DNA of musical concepts.
-        
-        // Placeholder for the Vector-to-Music logic
         const profile = this.physicsEngine.parseInput(text);
         profile.neuralEnhanced = true;
-        
+        if (!vector || !this.anchors) return profile;
+
+        const scores = this.scoreAnchors(vector);
+        const { labels, kinds } = this.anchors;
+        const archetypes = [];
+        let bestScale = null;
+        for (let i = 0; i < labels.length; i++) {
+            if (kinds[i] === 'archetype') {
+                archetypes.push({ name: labels[i], score: scores[i] });
+            } else if (!bestScale || scores[i] > bestScale.score) {
+                bestScale = { name: labels[i], score: scores[i] };
+            }
+        }
+        archetypes.sort((a, b) => b.score - a.score);
+
+        profile.neural = {
+            archetypes: archetypes.slice(0, 3),
+            scale: bestScale,
+            scores
+        };
         return profile;
     }
+
+    /**
+     * Cosine similarity against every anchor (vectors are unit-normalized): anchors x vector
+     */
+    scoreAnchors(vector) {
+        const { matrix, labels } = this.anchors;
+        const dim = vector.length;
+        const out = new Float32Array(labels.length);
+        for (let row = 0, base = 0; row < labels.length; row++, base += dim) {
+            let dot = 0;
+            for (let j = 0; j < dim; j++) dot += matrix[base + j] * vector[j];
+            out[row] = dot;
+        }
+        return out;
+    }
+
+    // ---------- embeddings ----------
+
+    static normalizeText(text) {
+        return String(text || '').toLowerCase().replace(/\s+/g, ' ').trim();
+    }
+
+    embed(text) {
+        return this.embedMany([text]).then(vectors => vectors[0]);
+    }
+
+    /**
+     * Resolve embeddings from the LRU, then IndexedDB, then the pipeline.
+     * Misses from every caller in the same frame are embedded together.
+     */
+    async embedMany(texts) {
+        const keys = texts.map(SemanticNeuralEngine.normalizeText);
+        const out = new Array(keys.length);
+        const missing = [];
+        keys.forEach((key, i) => {
+            const hit = this._cacheGet(key);
+            if (hit) {
+                this.stats.hits++;
+                out[i] = hit;
+            } else {
+                missing.push(i);
+            }
+        });
+        if (!missing.length) return out;
+
+        const persisted = await this._persistedGetMany(missing.map(i => keys[i]));
+        const pending = [];
+        missing.forEach((i, n) => {
+            if (persisted[n]) {
+                this.stats.persistedHits++;
+                this._cacheSet(keys[i], persisted[n]);
+                out[i] = persisted[n];
+            } else {
+                pending.push(this._enqueue(keys[i]).then(vector => { out[i] = vector; }));
+            }
+        });
+        await Promise.all(pending);
+        return out;
+    }
+
+    _enqueue(key) {
+        return new Promise((resolve, reject) => {
+            if (this.queue.has(key)) {
+                this.queue.get(key).push({ resolve, reject });
+            } else {
+                this.queue.set(key, [{ resolve, reject }]);
+            }
+            this._scheduleFlush();
+        });
+    }
+
+    _scheduleFlush() {
+        if (this.flushScheduled) return;
+        this.flushScheduled = true;
+        const schedule = (typeof requestAnimationFrame === 'function')
+            ? requestAnimationFrame
+            : (fn) => setTimeout(fn, 16);
+        schedule(() => this._flush());
+    }
+
+    async _flush() {
+        this.flushScheduled = false;
+        const batch = this.queue;
+        this.queue = new Map();
+        if (!batch.size) return;
+
+        const texts = [...batch.keys()];
+        this.stats.batches++;
+        try {
+            const { data, dim } = await this._runPipeline(texts);
+            const vectors = texts.map((_, i) => data.slice(i * dim, (i + 1) * dim));
+            this.stats.embedded += texts.length;
+            texts.forEach((key, i) => {
+                this._cacheSet(key, vectors[i]);
+                batch.get(key).forEach(waiter => waiter.resolve(vectors[i]));
+            });
+            this._persistedPutMany(texts, vectors);
+        } catch (err) {
+            batch.forEach(waiters => waiters.forEach(waiter => waiter.reject(err)));
+        }
+    }
+
+    _runPipeline(texts) {
+        if (this.worker) {
+            return new Promise((resolve, reject) => {
+                const id = this.nextRequestId++;
+                this.requests.set(id, { resolve, reject });
+                this.worker.postMessage({ id, type: 'embed', texts });
+            });
+        }
+        if (!this.pipe) return Promise.reject(new Error('Neural pipeline not initialized'));
+        return this.pipe(texts, { pooling: 'mean', normalize: true }).then(output => {
+            const data = output.data instanceof Float32Array ? output.data : Float32Array.from(output.data);
+            return { data, dim: data.length / texts.length };
+        });
+    }
+
+    _cacheGet(key) {
+        const vector = this.cache.get(key);
+        if (!vector) return null;
+        this.cache.delete(key);
+        this.cache.set(key, vector);
+        return vector;
+    }
+
+    _cacheSet(key, vector) {
+        if (this.cache.has(key)) this.cache.delete(key);
+        this.cache.set(key, vector);
+        while (this.cache.size > this.cacheLimit) {
+            this.cache.delete(this.cache.keys().next().value);
+        }
+    }
+
+    // ---------- IndexedDB ----------
+
+    _openDb() {
+        if (!this.persist || typeof indexedDB === 'undefined') return Promise.resolve(null);
+        if (this.dbPromise) return this.dbPromise;
+        this.dbPromise = new Promise((resolve) => {
+            let request;
+            try {
+                request = indexedDB.open(SemanticNeuralEngine.DB_NAME, 1);
+            } catch (err) {
+                resolve(null);
+                return;
+            }
+            request.onupgradeneeded = () => request.result.createObjectStore(SemanticNeuralEngine.DB_STORE);
+            request.onsuccess = () => resolve(request.result);
+            request.onerror = () => {
+                console.warn('[SemanticNeuralEngine] IndexedDB unavailable:', request.error && request.error.message);
+                resolve(null);
+            };
+        });
+        return this.dbPromise;
+    }
+
+    _dbKey(key) {
+        return `${this.modelId}|${key}`;
+    }
+
+    async _persistedGetMany(keys) {
+        const db = await this._openDb();
+        if (!db) return keys.map(() => null);
+        return new Promise((resolve) => {
+            const out = new Array(keys.length).fill(null);
+            try {
+                const tx = db.transaction(SemanticNeuralEngine.DB_STORE, 'readonly');
+                const store = tx.objectStore(SemanticNeuralEngine.DB_STORE);
+                keys.forEach((key, i) => {
+                    const req = store.get(this._dbKey(key));
+                    req.onsuccess = () => {
+                        if (req.result instanceof Float32Array) out[i] = req.result;
+                    };
+                });
+                tx.oncomplete = () => resolve(out);
+                tx.onerror = tx.onabort = () => resolve(out);
+            } catch (err) {
+                resolve(out);
+            }
+        });
+    }
+
+    async _persistedPutMany(keys, vectors) {
+        const db = await this._openDb();
+        if (!db) return;
+        try {
+            const tx = db.transaction(SemanticNeuralEngine.DB_STORE, 'readwrite');
+            const store = tx.objectStore(SemanticNeuralEngine.DB_STORE);
+            keys.forEach((key, i) => store.put(vectors[i], this._dbKey(key)));
+        } catch (err) {
+            console.warn('[SemanticNeuralEngine] Failed to persist embeddings:', err && err.message);
+        }
+    }
+
+    // ---------- anchors ----------
+
+    /**
+     * Anchor phrases: each musical archetype (name + its thesaurus words) and each scale mood
+     */
+    _anchorPhrases() {
+        const phrases = [];
+        const archetypes = (typeof window !== 'undefined' && window.MusicalArchetypes) || {};
+        const thesaurus = (typeof window !== 'undefined' && window.OfflineThesaurus) || null;
+        const wordsByArchetype = {};
+        if (thesaurus && typeof thesaurus.entries === 'function') {
+            for (const [word, archetype] of thesaurus.entries()) {
+                (wordsByArchetype[archetype] = wordsByArchetype[archetype] || []).push(word);
+            }
+        }
+        Object.keys(archetypes).forEach(name => {
+            const words = (wordsByArchetype[name] || []).slice(0, SemanticNeuralEngine.ANCHOR_WORDS);
+            phrases.push({ label: name, kind: 'archetype', text: [name, ...words].join(' ') });
+        });
+        Object.entries(SemanticNeuralEngine.SCALE_ANCHORS).forEach(([scale, text]) => {
+            phrases.push({ label: scale, kind: 'scale', text });
+        });
+        return phrases;
+    }
+
+    async _buildAnchors() {
+        const phrases = this._anchorPhrases();
+        if (!phrases.length) return;
+        const vectors = await this.embedMany(phrases.map(p => p.text));
+        const dim = vectors[0].length;
+        const matrix = new Float32Array(phrases.length * dim);
+        vectors.forEach((vector, row) => {
+            // Phrase means are not unit length; normalize so a dot product is a cosine
+            let norm = 0;
+            for (let j = 0; j < dim; j++) norm += vector[j] * vector[j];
+            const scale = norm > 0 ? 1 / Math.sqrt(norm) : 0;
+            for (let j = 0; j < dim; j++) matrix[row * dim + j] = vector[j] * scale;
+        });
+        this.dim = dim;
+        this.anchors = {
+            labels: phrases.map(p => p.label),
+            kinds: phrases.map(p => p.kind),
+            matrix
+        };
+    }
+
+    getStats() {
+        return { ...this.stats, cached: this.cache.size, worker: !!this.worker, anchors: this.anchors ? this.anchors.labels.length : 0 };
+    }
+}
+
+SemanticNeuralEngine.PIPELINE_OPTIONS = {
+    local_files_only: true, // Force offline
+    model_file_name: 'model_quantized', // Use smaller 30MB version
+};
+SemanticNeuralEngine.DB_NAME = 'semantic-neural-cache';
+SemanticNeuralEngine.DB_STORE = 'embeddings';
+SemanticNeuralEngine.ANCHOR_WORDS = 16;
+// Scale moods matched against the input (same scale names as WordDatabase's emotion map)
+SemanticNeuralEngine.SCALE_ANCHORS = {
+    major: 'joyful happy bright cheerful triumphant celebration',
+    major_pentatonic: 'trust simple open honest warm folk',
+    mixolydian: 'anticipation adventurous bluesy road confident',
+    lydian: 'wonder dreamy magical floating surprise',
+    harmonic_minor: 'fear exotic dramatic suspense danger',
+    aeolian: 'sad melancholy sorrow loss lonely',
+    phrygian_dominant: 'anger fierce intense desert fiery',
+    phrygian: 'disgust dark menacing tense sinister',
+    dorian: 'soulful hopeful bittersweet cool groove'
+};
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = SemanticNeuralEngine;
 }
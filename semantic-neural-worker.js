@@ -0,0 +1,53 @@
+/**
+ * semantic-neural-worker.js
+ *
+ * Runs the MiniLM feature-extraction pipeline off the main thread for SemanticNeuralEngine.
+ * Messages in:  { type: 'init', model, options } | { id, type: 'embed', texts: [...] }
+ * Messages out: { type: 'ready', dim } | { type: 'fatal', error } | { id, data: Float32Array, dim, count } | { id, error }
+ * Embedding rows are returned packed (count x dim) and the buffer is transferred.
+ */
+
+self.window = self;
+
+let pipe = null;
+
+async function init(model, options) {
+    try {
+        importScripts('transformers.min.js');
+    } catch (err) {
+        throw new Error('transformers.min.js not found');
+    }
+    const pipelineFn = self.pipeline || (self.transformers && self.transformers.pipeline);
+    if (typeof pipelineFn !== 'function') throw new Error('Transformers.js pipeline unavailable');
+    pipe = await pipelineFn('feature-extraction', model, options || {});
+    const probe = await pipe(['probe'], { pooling: 'mean', normalize: true });
+    return probe.dims ? probe.dims[probe.dims.length - 1] : probe.data.length;
+}
+
+async function embed(texts) {
+    const output = await pipe(texts, { pooling: 'mean', normalize: true });
+    const data = output.data instanceof Float32Array ? output.data : Float32Array.from(output.data);
+    const dim = data.length / texts.length;
+    // Copy so the transferred buffer is exactly the rows (tensor data may be a view)
+    return { data: data.slice(0, dim * texts.length), dim };
+}
+
+// Batches run one at a time; the client already coalesces texts per frame
+let chain = Promise.resolve();
+
+self.onmessage = (e) => {
+    const msg = e.data || {};
+    if (msg.type === 'init') {
+        chain = chain.then(() => init(msg.model, msg.options))
+            .then(dim => self.postMessage({ type: 'ready', dim }))
+            .catch(err => self.postMessage({ type: 'fatal', error: err && err.message ? err.message : String(err) }));
+        return;
+    }
+    if (msg.type === 'embed') {
+        chain = chain.then(async () => {
+            if (!pipe) throw new Error('Neural pipeline not initialized');
+            const { data, dim } = await embed(msg.texts || []);
+            self.postMessage({ id: msg.id, data, dim, count: (msg.texts || []).length }, [data.buffer]);
+        }).catch(err => self.postMessage({ id: msg.id, error: err && err.message ? err.message : String(err) }));
+    }
+};
@@ -108,6 +108,9 @@ class SheetMusicGenerator {
 		this.controlsContainer = null;
 		this.svgContainer = null;
 		this._lastGoodSvgMarkup = '';
+		// Keyed render model: staff layout memo and per-render patch counts
+		this._layoutCache = null;
+		this.lastPatchStats = null;
 		
 		// Voice leading state: track previous chord voicing
 		this.previousVoicing = null; // array of MIDI note numbers from last chord
@@ -2062,6 +2065,143 @@ class SheetMusicGenerator {
         }
     }
 
+    /**
+     * Staff layout (bar width, header, staff extent, svg size). Memoized until
+     * key, scale, staff type, bar count or label headroom changes.
+     */
+    _getStaffLayout(barCount, baseBarWidth, extraTopSpace) {
+        const cacheKey = [this.state.key, this.state.scale, this.state.staffType, barCount, baseBarWidth, extraTopSpace].join('|');
+        if (this._layoutCache && this._layoutCache.key === cacheKey) return this._layoutCache.layout;
+
+        const barWidth = baseBarWidth;
+        const staffLeft = 20; // left edge of staff lines and header
+        const headerWidth = 130; // reserved for clef + key signature + time signature
+        const firstBarX = staffLeft + headerWidth; // where bar 0 starts
+        const staffRight = firstBarX + barCount * barWidth;
+        const width = staffRight + 20; // right margin
+        const heightSingle = 150; // single staff height
+        const gapBetweenStaves = 60;
+        const heightGrand = heightSingle * 2 + gapBetweenStaves;
+        const baseStaffTopY = 20 + extraTopSpace; // push staff down if needed
+        const svgHeight = (this.state.staffType === 'grand' ? heightGrand : heightSingle) + extraTopSpace;
+
+        const layout = Object.freeze({
+            barWidth, staffLeft, headerWidth, firstBarX, staffRight, width,
+            heightSingle, gapBetweenStaves, heightGrand, baseStaffTopY, svgHeight
+        });
+        this._layoutCache = { key: cacheKey, layout };
+        return layout;
+    }
+
+    /**
+     * Run a bar's draw calls and move everything they appended into that bar's
+     * <g data-sheet-key="bar:N"> group (treble and bass passes share one group).
+     * When the bar on screen was drawn with the same `barKey`, the draw calls are
+     * skipped and an empty placeholder tells _patchSheetSvg to keep the live group.
+     */
+    _collectBarGroup(svg, barIndex, drawFn, barKey = null) {
+        if (!svg.__barGroups) svg.__barGroups = new Map();
+        const live = barKey && this._liveBarGroups ? this._liveBarGroups.get(barIndex) : null;
+        if (live && live.__sheetKey === barKey && !svg.__barGroups.has(barIndex)) {
+            const placeholder = document.createElementNS('http://www.w3.org/2000/svg', 'g');
+            placeholder.setAttribute('data-sheet-key', `bar:${barIndex}`);
+            placeholder.__sheetKey = barKey;
+            svg.appendChild(placeholder);
+            svg.__barGroups.set(barIndex, placeholder);
+            return;
+        }
+        const start = svg.childNodes.length;
+        drawFn();
+        const added = Array.prototype.slice.call(svg.childNodes, start);
+        if (!added.length) return;
+        let group = svg.__barGroups.get(barIndex);
+        if (!group) {
+            group = document.createElementNS('http://www.w3.org/2000/svg', 'g');
+            group.setAttribute('data-sheet-key', `bar:${barIndex}`);
+            group.setAttribute('class', 'sheet-bar');
+            group.__sheetKey = barKey;
+            svg.insertBefore(group, added[0]);
+            svg.__barGroups.set(barIndex, group);
+        }
+        added.forEach(node => group.appendChild(node));
+    }
+
+    /**
+     * Bar groups of the svg currently on screen, by bar index
+     */
+    _indexLiveBarGroups(target) {
+        const groups = new Map();
+        if (!target) return groups;
+        Array.from(target.children).forEach(node => {
+            const key = node.getAttribute('data-sheet-key');
+            if (key && key.indexOf('bar:') === 0) groups.set(parseInt(key.slice(4), 10), node);
+        });
+        return groups;
+    }
+
+    /**
+     * Wrap loose top-level nodes into keyed layers: everything before the first
+     * bar (staff, clefs, signatures) is 'layer:frame', everything after is 'layer:overlay'.
+     */
+    _groupSheetLayers(svg) {
+        const svgNS = 'http://www.w3.org/2000/svg';
+        const frame = document.createElementNS(svgNS, 'g');
+        frame.setAttribute('data-sheet-key', 'layer:frame');
+        const overlay = document.createElementNS(svgNS, 'g');
+        overlay.setAttribute('data-sheet-key', 'layer:overlay');
+
+        let seenBar = false;
+        Array.from(svg.childNodes).forEach(node => {
+            const key = node.getAttribute ? node.getAttribute('data-sheet-key') : null;
+            if (key && key.indexOf('bar:') === 0) { seenBar = true; return; }
+            (seenBar ? overlay : frame).appendChild(node);
+        });
+        svg.insertBefore(frame, svg.firstChild);
+        svg.appendChild(overlay);
+    }
+
+    /**
+     * Patch `target` to match the keyed groups of the off-DOM `fresh` svg.
+     * Bars whose key matches the live group are left untouched, so observers and
+     * DevTools only see the bars that actually changed; the frame and overlay
+     * layers are small and always replaced.
+     * @returns {{kept: number, patched: number, removed: number}}
+     */
+    _patchSheetSvg(target, fresh) {
+        const stats = { kept: 0, patched: 0, removed: 0 };
+        const incoming = Array.from(fresh.children);
+        const freshKeys = new Set(incoming.map(n => n.getAttribute('data-sheet-key')));
+
+        const existing = new Map();
+        Array.from(target.childNodes).forEach(node => {
+            const key = node.getAttribute ? node.getAttribute('data-sheet-key') : null;
+            if (key && freshKeys.has(key) && !existing.has(key)) {
+                existing.set(key, node);
+            } else {
+                target.removeChild(node);
+                stats.removed++;
+            }
+        });
+
+        let prev = null;
+        incoming.forEach(node => {
+            const key = node.getAttribute('data-sheet-key');
+            const old = existing.get(key);
+            let use = node;
+            if (old && node.__sheetKey && old.__sheetKey === node.__sheetKey) {
+                use = old;
+                stats.kept++;
+            } else {
+                if (old) target.replaceChild(node, old);
+                stats.patched++;
+            }
+            const expectedNext = prev ? prev.nextSibling : target.firstChild;
+            if (use !== expectedNext) target.insertBefore(use, expectedNext);
+            prev = use;
+        });
+        return stats;
+    }
+
     render() {
 		// Diagnostic: log render start state
 		try {
@@ -2110,6 +2250,7 @@ class SheetMusicGenerator {
 			try {
 				__targetSvg = this.svgContainer.querySelector('svg');
 			} catch (_) { __targetSvg = null; }
+			try { this._liveBarGroups = this._indexLiveBarGroups(__targetSvg); } catch (_) { this._liveBarGroups = null; }
 
 			// Reset captured voiced chords for MIDI export/playback
 			this.state.lastRenderedChords = [];
@@ -2283,22 +2424,14 @@ class SheetMusicGenerator {
 		const dynamicBarCount = this.state.barMode === 'per-bar'
 			? Math.max(minBars, this.state.barChords.length)
 			: minBars; // single mode still reserves 4 bars for consistent look
-		const barWidth = baseBarWidth;
-		const staffLeft = 20; // left edge of staff lines and header
-		const headerWidth = 130; // reserved for clef + key signature + time signature
-		const firstBarX = staffLeft + headerWidth; // where bar 0 starts
-		const staffRight = firstBarX + dynamicBarCount * barWidth;
-		const width = staffRight + 20; // right margin
-		const heightSingle = 150; // single staff height
-		const gapBetweenStaves = 60;
-		const heightGrand = heightSingle * 2 + gapBetweenStaves;
-		
 		// Add extra vertical space at the top for chord labels that extend above staff.
 		// Clamp to avoid pathological/infinite-scroll layouts if upstream note parsing
 		// ever produces absurd staff positions.
 		const extraTopSpace = Math.max(0, Math.min(260, maxLabelOffset - 8)); // beyond the default 8px
-		const baseStaffTopY = 20 + extraTopSpace; // push staff down if needed
-		const svgHeight = (this.state.staffType === 'grand' ? heightGrand : heightSingle) + extraTopSpace;
+		const {
+			barWidth, staffLeft, headerWidth, firstBarX, staffRight, width,
+			heightSingle, gapBetweenStaves, heightGrand, baseStaffTopY, svgHeight
+		} = this._getStaffLayout(dynamicBarCount, baseBarWidth, extraTopSpace);
 
 		const svgNS = 'http://www.w3.org/2000/svg';
 		let svg = document.createElementNS(svgNS, 'svg');
@@ -3514,9 +3647,17 @@ class SheetMusicGenerator {
 			svg.appendChild(t);
 		};
 
-		// Split the voiced chord across grand staff: lower to bass, upper to treble
-		const drawChordSplitAcrossGrand = (chord, barIndex, trebleMeta, bassMeta) => {
-			if (!chord || !chord.chordNotes || !chord.chordNotes.length) return;
+		// Voicings computed this render, by "barIndex|clef" (or "barIndex|split"). Bar keys
+		// and draw calls share them, so each bar is voiced exactly once per render and the
+		// previousVoicing chain advances the same way whether the bar is redrawn or reused.
+		const barVoicings = new Map();
+
+		// Voice a chord for the grand-staff split and capture it for playback/export
+		const voiceChordSplitAcrossGrand = (chord, barIndex) => {
+			const memoKey = `${barIndex}|split`;
+			if (barVoicings.has(memoKey)) return barVoicings.get(memoKey);
+			barVoicings.set(memoKey, null);
+			if (!chord || !chord.chordNotes || !chord.chordNotes.length) return null;
 
 			let rawNotes = chord.chordNotes;
 			if (chord.diatonicNotes && chord.diatonicNotes.length > 0) {
@@ -3616,6 +3757,43 @@ class SheetMusicGenerator {
 				}
 			}
 
+			const invSuffix = this.state.inversion === 0 ? '' : (this.state.inversion === 1 ? ' (1st inv)' : (this.state.inversion === 2 ? ' (2nd inv)' : ' (3rd inv)'));
+			// Use the original diatonic chord type for label display
+			// Do not reclassify from voiced notes to prevent misidentification
+			// Prefer fullName if available (it may contain specific modifiers like 'add6' or 'no5' from the engine)
+			let displayFull = chord.fullName || '';
+			if (!displayFull) {
+				let displayType = chord.chordType || '';
+				// Special case: G lydian_augmented, degree 1 should display '+maj7' or 'maj7#5' if notes match
+				if (this.state.key === 'G' && this.state.scale === 'lydian_augmented' && barIndex === 0) {
+					// If notes match G B D F#, force label to '+maj7' or 'maj7#5'
+					const notes = (chord.chordNotes && chord.chordNotes.length) ? chord.chordNotes : chord.diatonicNotes;
+					if (Array.isArray(notes) && notes.join(',') === 'G,B,D,F#') {
+						displayType = '+maj7';
+					}
+				}
+				displayFull = `${chord.root || ''}${displayType}`;
+			}
+			const chordLabelStr = displayFull + invSuffix;
+
+			// Capture combined voiced chord and name for this bar
+			try { 
+				this.state.lastRenderedChords.push(voiced.slice());
+				if (!Array.isArray(this.state.lastRenderedChordNames)) this.state.lastRenderedChordNames = [];
+				this.state.lastRenderedChordNames.push(chordLabelStr);
+			} catch(_){ }
+
+			const voicing = { notes: voiced, usedStyle, label: chordLabelStr };
+			barVoicings.set(memoKey, voicing);
+			return voicing;
+		};
+
+		// Split the voiced chord across grand staff: lower to bass, upper to treble
+		const drawChordSplitAcrossGrand = (chord, barIndex, trebleMeta, bassMeta) => {
+			const voicing = voiceChordSplitAcrossGrand(chord, barIndex);
+			if (!voicing) return;
+			const { notes: voiced, usedStyle, label: chordLabelStr } = voicing;
+
 			// Partition by middle C (MIDI 60). Lower -> bass, Higher/Equal -> treble
 			const lower = [];
 			const upper = [];
@@ -3658,24 +3836,6 @@ class SheetMusicGenerator {
 			text.setAttribute('font-weight', 'bold');
 			text.setAttribute('font-family', 'Georgia, "Times New Roman", serif');
 			text.setAttribute('text-anchor', 'middle');
-			const invSuffix = this.state.inversion === 0 ? '' : (this.state.inversion === 1 ? ' (1st inv)' : (this.state.inversion === 2 ? ' (2nd inv)' : ' (3rd inv)'));
-			// Use the original diatonic chord type for label display
-			// Do not reclassify from voiced notes to prevent misidentification
-			// Prefer fullName if available (it may contain specific modifiers like 'add6' or 'no5' from the engine)
-			let displayFull = chord.fullName || '';
-			if (!displayFull) {
-				let displayType = chord.chordType || '';
-				// Special case: G lydian_augmented, degree 1 should display '+maj7' or 'maj7#5' if notes match
-				if (this.state.key === 'G' && this.state.scale === 'lydian_augmented' && barIndex === 0) {
-					// If notes match G B D F#, force label to '+maj7' or 'maj7#5'
-					const notes = (chord.chordNotes && chord.chordNotes.length) ? chord.chordNotes : chord.diatonicNotes;
-					if (Array.isArray(notes) && notes.join(',') === 'G,B,D,F#') {
-						displayType = '+maj7';
-					}
-				}
-				displayFull = `${chord.root || ''}${displayType}`;
-			}
-			const chordLabelStr = displayFull + invSuffix;
 			// Auto-scale font size for long chord names to prevent overlap
 			if (chordLabelStr.length > 15) {
 				text.setAttribute('font-size', '10');
@@ -3886,19 +4046,16 @@ class SheetMusicGenerator {
 					}
 				} catch (_) { /* non-fatal */ }
 			};
-				// Capture combined voiced chord and name for this bar
-				try { 
-					this.state.lastRenderedChords.push(voiced.slice());
-					if (!Array.isArray(this.state.lastRenderedChordNames)) this.state.lastRenderedChordNames = [];
-					this.state.lastRenderedChordNames.push(chordLabelStr);
-				} catch(_){ }
-
 			if (trebleMeta && upper.length) drawSet(upper, trebleMeta);
 			if (bassMeta && lower.length) drawSet(lower, bassMeta);
 		};
 
-		const drawChordInBar = (chord, barIndex, staffMeta) => {
-            if (!chord || !chord.chordNotes || !chord.chordNotes.length) return;
+		// Voice a chord for one staff and capture it for playback/export
+		const voiceChordInBar = (chord, barIndex, clef) => {
+			const memoKey = `${barIndex}|${clef}`;
+			if (barVoicings.has(memoKey)) return barVoicings.get(memoKey);
+			barVoicings.set(memoKey, null);
+            if (!chord || !chord.chordNotes || !chord.chordNotes.length) return null;
             
             // ALWAYS prefer diatonicNotes when available (preserves scale-based stacking)
             // Otherwise fall back to chordNotes from formula
@@ -3947,13 +4104,13 @@ class SheetMusicGenerator {
 			const notesWithSpelling = invNotes.map(note => convertToKeySignatureSpelling(note));
             
 			// Assign octaves in close position so the stack is root→3rd→5th→7th vertically
-			let notes = voiceChordClose(notesWithSpelling, staffMeta.clef, this.state.octaveOffset);
+			let notes = voiceChordClose(notesWithSpelling, clef, this.state.octaveOffset);
 			
 			// Apply voicing: VL Combos first, then auto, then manual.
 			let usedStyle = this.state.voicingStyle;
 			// PRIORITY 1: VL Combos (multi-mode) - check FIRST
 			if (this.state.voiceLeadingMode === 'multi') {
-				const choice = chooseVoiceLeadingCombination.call(this, rawNotes, staffMeta.clef || 'treble');
+				const choice = chooseVoiceLeadingCombination.call(this, rawNotes, clef || 'treble');
 				notes = choice.notes || notes;
 				usedStyle = choice.style || this.state.voicingStyle;
 				// Persist continuity for next bars so movement optimization engages
@@ -3978,7 +4135,7 @@ class SheetMusicGenerator {
 					type: 'sheetVoicingAppliedSingle',
 					details: {
 						barIndex,
-						staffClef: staffMeta.clef,
+						staffClef: clef,
 						usedStyle,
 						voiceLeading: !!this.state.voiceLeading,
 						voiceLeadingMode: this.state.voiceLeadingMode,
@@ -3999,6 +4156,33 @@ class SheetMusicGenerator {
 					notes = [notes[notes.length - 1]];
 				}
 			}
+
+			const invSuffix = maxInv === 0 ? '' : (maxInv === 1 ? ' (1st inv)' : (maxInv === 2 ? ' (2nd inv)' : ' (3rd inv)'));
+			// For single-staff rendering, also trust the stored diatonic chordType
+			// Prefer fullName if available (it may contain specific modifiers like 'add6' or 'no5' from the engine)
+			let displayFullSingle = chord.fullName || '';
+			if (!displayFullSingle) {
+				const displayTypeSingle = chord.chordType || '';
+				displayFullSingle = `${chord.root || ''}${displayTypeSingle}`;
+			}
+			const chordLabelStrSingle = displayFullSingle + invSuffix;
+
+			// Capture voiced chord for this bar (once per chord, not per note)
+			try { 
+				this.state.lastRenderedChords.push(notes.slice()); 
+				if (!Array.isArray(this.state.lastRenderedChordNames)) this.state.lastRenderedChordNames = [];
+				this.state.lastRenderedChordNames.push(chordLabelStrSingle);
+			} catch(_){ }
+
+			const voicing = { notes, usedStyle, label: chordLabelStrSingle };
+			barVoicings.set(memoKey, voicing);
+			return voicing;
+		};
+
+		const drawChordInBar = (chord, barIndex, staffMeta) => {
+			const voicing = voiceChordInBar(chord, barIndex, staffMeta.clef);
+			if (!voicing) return;
+			const { notes, usedStyle, label: chordLabelStrSingle } = voicing;
             
 			const xCenter = firstBarX + (barIndex + 0.5) * barWidth;
 			// Slightly larger noteheads to accommodate internal labels
@@ -4030,15 +4214,6 @@ class SheetMusicGenerator {
             text.setAttribute('font-weight', 'bold');
             text.setAttribute('font-family', 'Georgia, "Times New Roman", serif');
             text.setAttribute('text-anchor', 'middle');
-			const invSuffix = maxInv === 0 ? '' : (maxInv === 1 ? ' (1st inv)' : (maxInv === 2 ? ' (2nd inv)' : ' (3rd inv)'));
-			// For single-staff rendering, also trust the stored diatonic chordType
-			// Prefer fullName if available (it may contain specific modifiers like 'add6' or 'no5' from the engine)
-			let displayFullSingle = chord.fullName || '';
-			if (!displayFullSingle) {
-				const displayTypeSingle = chord.chordType || '';
-				displayFullSingle = `${chord.root || ''}${displayTypeSingle}`;
-			}
-			const chordLabelStrSingle = displayFullSingle + invSuffix;
 			// Auto-scale font size for long chord names
 			if (chordLabelStrSingle.length > 15) {
 				text.setAttribute('font-size', '10');
@@ -4157,12 +4332,7 @@ class SheetMusicGenerator {
 			// Draw pill a bit below the style label
 			const pillY = bottomY + 6;
 			drawVoicingPill(xCenter, pillY, pillText, { fill: '#374151', textColor: '#f3f4f6', fontSize: 10 });
-		} catch (e) { /* non-fatal */ }			// Capture voiced chord for this bar (once per chord, not per note)
-			try { 
-				this.state.lastRenderedChords.push(notes.slice()); 
-				if (!Array.isArray(this.state.lastRenderedChordNames)) this.state.lastRenderedChordNames = [];
-				this.state.lastRenderedChordNames.push(chordLabelStrSingle);
-			} catch(_){ }
+		} catch (e) { /* non-fatal */ }
 
 			// Keep notes in root position (as provided, not sorted)
 			const _smallNoteTexts_local = [];
@@ -4249,7 +4419,33 @@ class SheetMusicGenerator {
 					window.__interactionLog.push({ type: 'sheetSmallNoteLabels', barIndex: barIndex, chordLabel: chord && (chord.fullName || (chord.root || '') + (chord.chordType || '')), smallNoteTexts: _smallNoteTexts_local, timestamp: Date.now() });
 				}
 			} catch (_) { /* non-fatal */ }
-        };		if (chordsToShow.length === 0) {
+        };
+
+		const splitGrand = !!(this.state.staffType === 'grand' && treble && bass && this.state.splitAcrossGrand);
+		// Bar geometry only: adding a bar widens the svg but leaves existing bars where they are
+		const sheetLayoutKey = [this.state.key, this.state.scale, this.state.staffType, firstBarX, barWidth, baseStaffTopY, splitGrand ? 'split' : 'stacked'].join('|');
+
+		// One chord per bar, on whichever staves this layout shows
+		const drawBarChord = (chord, barIndex) => {
+			if (splitGrand) {
+				drawChordSplitAcrossGrand(chord, barIndex, treble, bass);
+			} else {
+				if (treble) drawChordInBar(chord, barIndex, treble);
+				if (bass) drawChordInBar(chord, barIndex, bass);
+			}
+		};
+
+		// A bar's glyphs depend only on its chord, its computed voicing(s) and the layout
+		const barChordKey = (chord, barIndex) => {
+			const voicings = splitGrand
+				? [voiceChordSplitAcrossGrand(chord, barIndex)]
+				: [treble ? voiceChordInBar(chord, barIndex, treble.clef) : null, bass ? voiceChordInBar(chord, barIndex, bass.clef) : null];
+			const base = chord ? (chord.chordNotes || chord.diatonicNotes || null) : null;
+			return JSON.stringify([sheetLayoutKey, barIndex, chord ? chord.root : null, base,
+				voicings.map(v => v ? [v.label, v.usedStyle, v.notes] : null)]);
+		};
+
+		if (chordsToShow.length === 0) {
 			const empty = document.createElementNS(svgNS, 'text');
 			empty.setAttribute('x', String((firstBarX + staffRight) / 2));
 			const emptyY = (treble ? treble.topY : bass.topY) + (treble ? treble.spacing : bass.spacing) * 2;
@@ -4264,12 +4460,7 @@ class SheetMusicGenerator {
 		} else {
 
 			if (this.state.barMode === 'single') {
-				if (this.state.staffType === 'grand' && treble && bass && this.state.splitAcrossGrand) {
-					drawChordSplitAcrossGrand(chordsToShow[0], 0, treble, bass);
-				} else {
-					if (treble) drawChordInBar(chordsToShow[0], 0, treble);
-					if (bass) drawChordInBar(chordsToShow[0], 0, bass);
-				}
+				this._collectBarGroup(svg, 0, () => drawBarChord(chordsToShow[0], 0), barChordKey(chordsToShow[0], 0));
 			} else {
                 // RHYTHMIC RENDER LOOP
                 const phrase = this.state.musicalPhrase;
@@ -4301,12 +4492,7 @@ class SheetMusicGenerator {
 						for (let barIndex = 0; barIndex < barsToRender; barIndex++) {
 							const chord = chordsToShow[barIndex];
 							if (!chord) continue;
-							if (this.state.staffType === 'grand' && treble && bass && this.state.splitAcrossGrand) {
-								drawChordSplitAcrossGrand(chord, barIndex, treble, bass);
-							} else {
-								if (treble) drawChordInBar(chord, barIndex, treble);
-								if (bass) drawChordInBar(chord, barIndex, bass);
-							}
+							this._collectBarGroup(svg, barIndex, () => drawBarChord(chord, barIndex), barChordKey(chord, barIndex));
 						}
 					}
 				} else if (phrase && Array.isArray(phrase.bars)) {
@@ -4321,7 +4507,13 @@ class SheetMusicGenerator {
                     console.log('[Sheet] ** PHRASE RENDERING MODE ** - rendering', phrase.bars.length, 'bars');
                     
                     const phraseBeatsPerBar = phrase.beatsPerBar || 4;
-                    phrase.bars.forEach((bar, barIndex) => {
+                    // Phrase bars carry their own notes, so the events themselves are the voicing
+                    const phraseBarKey = (bar, barIndex) => JSON.stringify([sheetLayoutKey, barIndex, phraseBeatsPerBar,
+                        bar.beats.map(e => [e.isRest ? 1 : 0, e.duration, e.chordDuration, e.chord || null,
+                            e.arcStage ? e.arcStage.absoluteBeat : null,
+                            e.chordObj ? (e.chordObj.diatonicNotes || null) : null,
+                            (e.melodySequence || []).map(m => m ? [m.noteName, m.duration, m.syllable] : null)])]);
+                    phrase.bars.forEach((bar, barIndex) => this._collectBarGroup(svg, barIndex, () => {
                         const barX = firstBarX + barIndex * barWidth;
                         // Space notes by musical time, not array index — quarter note = 1/beatsPerBar of bar width.
                         const beatSlotWidth = barWidth / phraseBeatsPerBar;
@@ -4492,7 +4684,7 @@ class SheetMusicGenerator {
 							mainLabel.textContent = bar.beats[0].chord;
 							svg.appendChild(mainLabel);
 						}
-                    });
+                    }, phraseBarKey(bar, barIndex)));
                     
 					this._drawArcEnergyGuide(svg, phrase, {
 						staffLeft: firstBarX,
@@ -4508,12 +4700,7 @@ class SheetMusicGenerator {
                     // LEGACY MODE: One chord per bar
                     chordsToShow.forEach((chord, idx) => {
                         const barIndex = idx;
-                        if (this.state.staffType === 'grand' && treble && bass && this.state.splitAcrossGrand) {
-                            drawChordSplitAcrossGrand(chord, barIndex, treble, bass);
-                        } else {
-                            if (treble) drawChordInBar(chord, barIndex, treble);
-                            if (bass) drawChordInBar(chord, barIndex, bass);
-                        }
+                        this._collectBarGroup(svg, barIndex, () => drawBarChord(chord, barIndex), barChordKey(chord, barIndex));
                     });
                 }
 			}
@@ -4532,10 +4719,10 @@ class SheetMusicGenerator {
 					__targetSvg.style.background = 'var(--bg-panel, #1a1a1a)';
 				} catch (_) {}
 
-				// Move all rendered children over (fast + keeps namespaces correct)
+				// Patch keyed layers/bars in place; unchanged bars keep their DOM nodes
 				try {
-					while (__targetSvg.firstChild) __targetSvg.removeChild(__targetSvg.firstChild);
-					while (svg.firstChild) __targetSvg.appendChild(svg.firstChild);
+					this._groupSheetLayers(svg);
+					this.lastPatchStats = this._patchSheetSvg(__targetSvg, svg);
 				} catch (_) {
 					// Fallback for older engines
 					try { __targetSvg.innerHTML = svg.innerHTML; } catch (_) {}
@@ -4547,14 +4734,22 @@ class SheetMusicGenerator {
 			} else {
 				// First render: replace any existing SVG and append.
 				try { this.svgContainer.innerHTML = ''; } catch (_) {}
+				try {
+					this._groupSheetLayers(svg);
+					this.lastPatchStats = { kept: 0, patched: svg.children.length, removed: 0 };
+				} catch (_) {}
 				this.svgContainer.appendChild(svg);
 			}
 		} catch (_) {}
+		this._liveBarGroups = null;
 
 		// Attach chord label click listeners for audition + piano popup
 		try {
 			const labels = svg.querySelectorAll('.sheet-chord-label');
 			labels.forEach(lbl => {
+				// Labels inside bars kept by the patch are already bound
+				if (lbl.__sheetBound) return;
+				lbl.__sheetBound = true;
 				lbl.addEventListener('click', (e) => {
 					const idx = parseInt(lbl.getAttribute('data-bar-index'), 10);
 					if (!isNaN(idx)) { 
@@ -7,6 +7,8 @@
  * @feature Improved trajectory visualization
  * @feature Mouse hover interactions
  * @feature Active path highlighting
+ * @feature Starfield, orbits and sun cached in offscreen layers; only moving bodies drawn per frame
+ * @feature Animation pauses while scrolled off screen, in a hidden tab, or the page is hidden
  */
 
 (function(global){
@@ -41,6 +43,11 @@
       this.onMouseLeave = this.onMouseLeave.bind(this);
       this.resizeObserver = null;
       this.tooltip = null;
+      // Cached static layers: { canvas, ctx, key }
+      this.layers = { stars: null, orbits: null };
+      this.inViewport = true;
+      this.intersectionObserver = null;
+      this.onVisibilityChange = this.onVisibilityChange.bind(this);
     }
 
     mount(container){
@@ -116,7 +123,7 @@
         // Force an immediate draw (fallback static sun) and a lightweight interval animation for mini view
         try { this.rebuildPlanets(); this.draw(); } catch(_){}
         if (!this._miniInterval) {
-          this._miniInterval = setInterval(() => { try { this.state.time += 1; this.draw(); } catch(_){} }, 800);
+          this._miniInterval = setInterval(() => { if (!this.canAnimate()) return; try { this.state.time += 1; this.draw(); } catch(_){} }, 800);
         }
       }
 
@@ -125,10 +132,29 @@
         this.resizeObserver.observe(this.container);
       }
 
+      this.observeVisibility();
+
       // Start paused by default for easier exploration
       this.draw();
     }
 
+    observeVisibility(){
+      if (typeof document !== 'undefined') document.addEventListener('visibilitychange', this.onVisibilityChange);
+      if (typeof IntersectionObserver === 'undefined' || !this.container) return;
+      if (this.intersectionObserver) this.intersectionObserver.disconnect();
+      // Hidden workspace tabs (display:none) report as not intersecting too
+      this.intersectionObserver = new IntersectionObserver((entries) => {
+        const entry = entries[entries.length - 1];
+        this.inViewport = !!(entry && entry.isIntersecting);
+        if (this.inViewport) { this.draw(); this.resumeLoop(); }
+      });
+      this.intersectionObserver.observe(this.container);
+    }
+
+    onVisibilityChange(){ if (this.canAnimate()) this.resumeLoop(); }
+
+    canAnimate(){ return this.inViewport && !(typeof document !== 'undefined' && document.hidden); }
+
     unmount(){
       window.removeEventListener('resize', this.handleResize);
       if(this.canvas){
@@ -138,7 +164,10 @@
       }
       if (this.resizeObserver) { this.resizeObserver.disconnect(); this.resizeObserver = null; }
       if (this._ro) { try { this._ro.disconnect(); } catch(_){} this._ro = null; }
+      if (this.intersectionObserver) { this.intersectionObserver.disconnect(); this.intersectionObserver = null; }
+      if (typeof document !== 'undefined') document.removeEventListener('visibilitychange', this.onVisibilityChange);
       this.stop();
+      this.layers = { stars: null, orbits: null };
       if(this.container){ this.container.innerHTML = ''; }
     }
 
@@ -251,7 +280,16 @@
       return sat;
     }
 
-    start(){ if(this.animId) return; const loop = () => { this.state.time += 1; this.draw(); this.animId = requestAnimationFrame(loop); }; this.animId = requestAnimationFrame(loop); this.isPlaying = true; this.syncPlayButton(); }
+    start(){ if(this.animId) return; this.isPlaying = true; this.syncPlayButton(); this.resumeLoop(); }
+    // The loop parks itself while not visible; visibility callbacks resume it if still playing
+    resumeLoop(){
+      if (this.animId || !this.isPlaying || !this.canAnimate()) return;
+      const loop = () => {
+        if (!this.canAnimate()) { this.animId = null; return; }
+        this.state.time += 1; this.draw(); this.animId = requestAnimationFrame(loop);
+      };
+      this.animId = requestAnimationFrame(loop);
+    }
     stop(){ if(this.animId){ cancelAnimationFrame(this.animId); this.animId = null; } if (this._miniInterval) { clearInterval(this._miniInterval); this._miniInterval = null; } this.isPlaying = false; this.syncPlayButton(); }
 
     syncPlayButton(){
@@ -271,12 +309,14 @@
       this.canvas.width = Math.floor(width * dpr);
       this.canvas.height = Math.floor(height * dpr);
       this.ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+      this.layers = { stars: null, orbits: null };
     }
 
     makeStars(){
       const rect = this.container.getBoundingClientRect();
       const count = Math.floor((rect.width * rect.height) / 8000);
       this.stars = Array.from({length: count}, () => ({ x: Math.random() * rect.width, y: Math.random() * rect.height, r: Math.random() * 1.2 + 0.3, a: Math.random() * 0.35 + 0.15 }));
+      this.layers.stars = null;
     }
 
     onClick(e){
@@ -339,15 +379,73 @@
       const ctx = this.ctx; if(!ctx) return;
       const rect = this.canvas.getBoundingClientRect(); const w = rect.width, h = rect.height;
       ctx.clearRect(0, 0, w, h);
-      this.drawStars(ctx);
-      const cx = w/2, cy = h/2; const sunR = Math.min(cx, cy) * 0.18; this.drawSun(ctx, cx, cy, sunR);
-      this.drawPlanets(ctx, cx, cy, sunR);
+      const cx = w/2, cy = h/2; const sunR = Math.min(cx, cy) * 0.18;
+      this.drawStaticLayers(ctx, w, h, cx, cy, sunR);
+      this.drawPlanets(ctx, cx, cy, sunR, { skipOrbits: true });
       if (this.state.showTrajectories && this.state.activePath.length > 1) {
         this.drawPathTrajectories(ctx, cx, cy, this.state.activePath);
       }
       // this.drawHeader(ctx, w); // Header is now part of the HTML controls overlay
     }
 
+    /**
+     * Blit the cached starfield and orbit/sun layers, re-rendering a layer only when its key changes.
+     * Star twinkle is slow (~300 frame period), so the starfield is refreshed every few frames.
+     */
+    drawStaticLayers(ctx, w, h, cx, cy, sunR){
+      const starKey = `${w}x${h}:${Math.floor(this.state.time / SolarSystemVisualizer.STAR_REFRESH_FRAMES)}`;
+      const stars = this.getLayer('stars', starKey, (lctx) => {
+        const time = this.state.time;
+        this.state.time = Math.floor(time / SolarSystemVisualizer.STAR_REFRESH_FRAMES) * SolarSystemVisualizer.STAR_REFRESH_FRAMES;
+        try { this.drawStars(lctx); } finally { this.state.time = time; }
+      });
+      const expanded = this.state.expandedPlanets;
+      const anyExpanded = expanded.length > 0;
+      const orbitKey = `${w}x${h}:${this.state.key}:${this.state.planets.map(p => `${p.note}@${p.orbitRadius}`).join(',')}:${expanded.join(',')}`;
+      const orbits = this.getLayer('orbits', orbitKey, (lctx) => {
+        this.drawSun(lctx, cx, cy, sunR);
+        this.state.planets.forEach(p => {
+          const isExpanded = expanded.includes(p.note);
+          const orbitAlpha = isExpanded ? 0.6 : (anyExpanded ? 0.15 : 0.25);
+          const orbitWidth = isExpanded ? 2 : 1;
+          lctx.save(); lctx.beginPath(); lctx.arc(cx, cy, p.orbitRadius, 0, Math.PI*2); lctx.strokeStyle = `rgba(100, 116, 139, ${orbitAlpha})`; lctx.lineWidth = orbitWidth; lctx.stroke(); lctx.restore();
+        });
+      });
+      // Layers share the main canvas' pixel size and transform, so blit them 1:1 in device pixels
+      ctx.save(); ctx.setTransform(1, 0, 0, 1, 0, 0);
+      if (stars) ctx.drawImage(stars, 0, 0);
+      if (orbits) ctx.drawImage(orbits, 0, 0);
+      ctx.restore();
+      if (!stars) this.drawStars(ctx);
+      if (!orbits) {
+        // No offscreen canvas support: fall back to drawing in place
+        this.drawSun(ctx, cx, cy, sunR);
+        this.drawPlanets(ctx, cx, cy, sunR, { orbitsOnly: true });
+      }
+    }
+
+    getLayer(name, key, render){
+      const width = this.canvas.width, height = this.canvas.height;
+      let layer = this.layers[name];
+      if (!layer || layer.canvas.width !== width || layer.canvas.height !== height){
+        let canvas = null;
+        if (typeof OffscreenCanvas !== 'undefined') canvas = new OffscreenCanvas(width, height);
+        else if (typeof document !== 'undefined') { canvas = document.createElement('canvas'); canvas.width = width; canvas.height = height; }
+        const lctx = canvas && canvas.getContext('2d');
+        if (!lctx) return null;
+        layer = this.layers[name] = { canvas, ctx: lctx, key: null };
+      }
+      if (layer.key !== key){
+        layer.ctx.setTransform(1, 0, 0, 1, 0, 0);
+        layer.ctx.clearRect(0, 0, width, height);
+        const dpr = window.devicePixelRatio || 1; // same transform resizeCanvas() gives the main context
+        layer.ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+        render(layer.ctx);
+        layer.key = key;
+      }
+      return layer.canvas;
+    }
+
     drawStars(ctx){ ctx.save(); this.stars.forEach(s => { const f = 0.6 + 0.4*Math.sin((this.state.time*0.02) + s.x*0.1 + s.y*0.1); ctx.beginPath(); ctx.arc(s.x, s.y, s.r, 0, Math.PI*2); ctx.fillStyle = `rgba(255,255,255,${(s.a*f).toFixed(3)})`; ctx.fill(); }); ctx.restore(); }
 
     drawPathTrajectories(ctx, cx, cy, pathNotes){
@@ -383,15 +481,18 @@
       ctx.save(); ctx.fillStyle = '#0b1220'; ctx.font = 'bold 18px Segoe UI, Arial'; ctx.textAlign = 'center'; ctx.fillText(this.state.key, cx, cy+6); ctx.restore();
     }
 
-    drawPlanets(ctx, cx, cy, sunR){
+    drawPlanets(ctx, cx, cy, sunR, options = {}){
       const planets = this.state.planets;
       const anyExpanded = this.state.expandedPlanets && this.state.expandedPlanets.length > 0;
       planets.forEach((p, i) => {
-        p.angle += p.angularSpeed * this.state.speedScale;
         const isExpanded = this.state.expandedPlanets.includes(p.note);
-        const orbitAlpha = isExpanded ? 0.6 : (anyExpanded ? 0.15 : 0.25);
-        const orbitWidth = isExpanded ? 2 : 1;
-        ctx.save(); ctx.beginPath(); ctx.arc(cx, cy, p.orbitRadius, 0, Math.PI*2); ctx.strokeStyle = `rgba(100, 116, 139, ${orbitAlpha})`; ctx.lineWidth = orbitWidth; ctx.stroke(); ctx.restore();
+        if (!options.skipOrbits){
+          const orbitAlpha = isExpanded ? 0.6 : (anyExpanded ? 0.15 : 0.25);
+          const orbitWidth = isExpanded ? 2 : 1;
+          ctx.save(); ctx.beginPath(); ctx.arc(cx, cy, p.orbitRadius, 0, Math.PI*2); ctx.strokeStyle = `rgba(100, 116, 139, ${orbitAlpha})`; ctx.lineWidth = orbitWidth; ctx.stroke(); ctx.restore();
+        }
+        if (options.orbitsOnly) return;
+        p.angle += p.angularSpeed * this.state.speedScale;
         const px = cx + p.orbitRadius * Math.cos(p.angle - Math.PI/2); const py = cy + p.orbitRadius * Math.sin(p.angle - Math.PI/2);
         const color = this.colorForIndex(i);
         const dispSize = isExpanded ? Math.min(p.size * 1.6, p.size + 12) : p.size;
@@ -665,6 +766,9 @@
     onMouseLeave(){ if (this.tooltip){ this.tooltip.style.opacity = '0'; } }
   }
 
+  // Frames between starfield layer refreshes
+  SolarSystemVisualizer.STAR_REFRESH_FRAMES = 6;
+
   if(typeof module !== 'undefined' && module.exports){ module.exports = SolarSystemVisualizer; }
   if(typeof window !== 'undefined'){ window.SolarSystemVisualizer = SolarSystemVisualizer; }
 })(this);
@@ -12,7 +12,11 @@
  */
 
 class UnifiedChordExplorer {
-    constructor(musicTheoryEngine) {
+    /**
+     * @param {MusicTheoryEngine} musicTheoryEngine
+     * @param {Object} options - { headless } skips the grading subscription (AnalysisService uses this to host substitution logic)
+     */
+    constructor(musicTheoryEngine, options = {}) {
         if (!musicTheoryEngine) {
             throw new Error('UnifiedChordExplorer requires MusicTheoryEngine');
         }
@@ -37,7 +41,13 @@ class UnifiedChordExplorer {
         // Tracks non-diatonic substitutions applied to progression slots
         this.state.progressionOverlays = [];
 
+        // key|scale -> base I-VII rows before token overrides (see _getScaleChordTable)
+        this._scaleChordTables = new Map();
+        this._scaleChordTablesVersion = null;
+        this._scaleChordTablesRestored = false;
+
         this.listeners = new Map();
+        this.analysisService = null;
         this.containerElement = null;
         this.radialMenu = null;
         this.numberGenerator = null;
@@ -56,7 +66,7 @@ class UnifiedChordExplorer {
         };
 
         // Subscribe to shared grading mode changes
-        if (this.musicTheory.subscribe) {
+        if (this.musicTheory.subscribe && !options.headless) {
             this.musicTheory.subscribe((event, data) => {
                 if (event === 'gradingModeChanged') {
                     this.render();
@@ -75,6 +85,13 @@ class UnifiedChordExplorer {
         try { console.log('[UnifiedChordExplorer]', ...args); } catch(_) {}
     }
 
+    /**
+     * Route substitution generation through an AnalysisService (worker-backed when available)
+     */
+    connectAnalysisService(service) {
+        this.analysisService = service || null;
+    }
+
     /**
      * Connect to ScaleLibrary so the explorer updates when the global key/scale changes
      */
@@ -457,8 +474,10 @@ class UnifiedChordExplorer {
         const scaleNotes = this.musicTheory.getScaleNotes(this.state.currentKey, this.state.currentScale);
         const chords = [];
 
+        const table = this._getScaleChordTable(this.state.currentKey, this.state.currentScale);
+
         for (let degree = 1; degree <= 7; degree++) {
-            const diatonicChord = this.musicTheory.getDiatonicChord(degree, this.state.currentKey, this.state.currentScale);
+            const diatonicChord = table[degree - 1];
             if (diatonicChord) {
                 // Manual override logic (preview OR committed tokens):
                 // If user types viidim / vii° -> force dim7. If user types viihalfdim / viiø / vii m7b5 -> force m7b5.
@@ -509,7 +528,9 @@ class UnifiedChordExplorer {
                 }
                 const finalChordType = chordTypeOverride || diatonicChord.chordType;
                 const finalFullName = diatonicChord.root + finalChordType;
-                const finalNotes = this.musicTheory.getChordNotes(diatonicChord.root, finalChordType);
+                const finalNotes = finalChordType === diatonicChord.chordType
+                    ? diatonicChord.notes
+                    : this.musicTheory.getChordNotes(diatonicChord.root, finalChordType);
                 chords.push({
                     degree,
                     root: diatonicChord.root,
@@ -517,7 +538,7 @@ class UnifiedChordExplorer {
                     fullName: finalFullName,
                     notes: finalNotes,
                     inProgression: this.state.progressionDegrees.includes(degree),
-                    functions: this.getFunctionalHarmonyTags(degree, this.state.currentScale)
+                    functions: diatonicChord.functions.slice()
                 });
             }
         }
@@ -544,6 +565,111 @@ class UnifiedChordExplorer {
         this.state.scaleChords = chords;
     }
 
+    /**
+     * Engine-default I-VII rows for a key/scale: { degree, root, chordType, notes, functions },
+     * indexed by degree - 1 (null where the engine has no chord).
+     * Tables are dropped when the engine's gradingVersion moves (its scale catalog may have
+     * changed) and persisted through the derived-index snapshot for the next visit.
+     */
+    _getScaleChordTable(key, scale) {
+        const version = this.musicTheory.gradingVersion;
+        if (this._scaleChordTablesVersion !== version) {
+            this._scaleChordTables.clear();
+            this._scaleChordTablesVersion = version;
+        }
+        const snapshot = (typeof window !== 'undefined' && window.derivedIndexSnapshot) || null;
+        if (snapshot && snapshot.loaded && !this._scaleChordTablesRestored) {
+            this._scaleChordTablesRestored = true;
+            this._restoreScaleChordTables(snapshot.take('scaleChordTables', UnifiedChordExplorer.SCALE_CHORD_TABLE_SIGNATURE));
+        }
+
+        const id = `${key}|${scale}`;
+        let table = this._scaleChordTables.get(id);
+        if (table) {
+            // Refresh LRU position
+            this._scaleChordTables.delete(id);
+            this._scaleChordTables.set(id, table);
+            return table;
+        }
+
+        table = [];
+        for (let degree = 1; degree <= 7; degree++) {
+            const diatonicChord = this.musicTheory.getDiatonicChord(degree, key, scale);
+            if (!diatonicChord) { table.push(null); continue; }
+            table.push(Object.freeze({
+                degree,
+                root: diatonicChord.root,
+                chordType: diatonicChord.chordType,
+                notes: this.musicTheory.getChordNotes(diatonicChord.root, diatonicChord.chordType),
+                functions: Object.freeze(this.getFunctionalHarmonyTags(degree, scale))
+            }));
+        }
+        this._scaleChordTables.set(id, table);
+        if (this._scaleChordTables.size > UnifiedChordExplorer.SCALE_CHORD_TABLE_LIMIT) {
+            this._scaleChordTables.delete(this._scaleChordTables.keys().next().value);
+        }
+        if (snapshot) {
+            snapshot.put('scaleChordTables', UnifiedChordExplorer.SCALE_CHORD_TABLE_SIGNATURE, () => this._encodeScaleChordTables());
+        }
+        return table;
+    }
+
+    /**
+     * Snapshot form: one string pool plus five Uint16 columns per row
+     * (degree, root, chordType, notes, functions) and each table's row offset.
+     */
+    _encodeScaleChordTables() {
+        const pool = DerivedIndexSnapshot.createStringPool();
+        const keys = [];
+        const offsets = [0];
+        const rows = [];
+        this._scaleChordTables.forEach((table, id) => {
+            keys.push(id);
+            table.forEach(row => {
+                if (row) {
+                    rows.push(row.degree, pool.id(row.root), pool.id(row.chordType),
+                        pool.id(row.notes.join(',')), pool.id(row.functions.join(',')));
+                } else {
+                    rows.push(0, 0, 0, 0, 0); // degree 0 marks a missing chord
+                }
+            });
+            offsets.push(rows.length / 5);
+        });
+        return {
+            keys: DerivedIndexSnapshot.joinStrings(keys),
+            offsets: Uint16Array.from(offsets),
+            rows: Uint16Array.from(rows),
+            strings: pool.text()
+        };
+    }
+
+    _restoreScaleChordTables(payload) {
+        if (!payload) return;
+        try {
+            const strings = DerivedIndexSnapshot.splitStrings(payload.strings);
+            DerivedIndexSnapshot.splitStrings(payload.keys).forEach((id, t) => {
+                if (this._scaleChordTables.has(id)) return;
+                const table = [];
+                for (let r = payload.offsets[t]; r < payload.offsets[t + 1]; r++) {
+                    const at = r * 5;
+                    if (!payload.rows[at]) { table.push(null); continue; }
+                    const notes = strings[payload.rows[at + 3]];
+                    const functions = strings[payload.rows[at + 4]];
+                    table.push(Object.freeze({
+                        degree: payload.rows[at],
+                        root: strings[payload.rows[at + 1]],
+                        chordType: strings[payload.rows[at + 2]],
+                        notes: Object.freeze(notes ? notes.split(',') : []),
+                        functions: Object.freeze(functions ? functions.split(',') : [])
+                    }));
+                }
+                this._scaleChordTables.set(id, table);
+            });
+        } catch (e) {
+            console.warn('[UnifiedChordExplorer] stored chord tables unreadable, rebuilding', e);
+        }
+    }
+
     /**
      * Generate different voicings/inversions for duplicate chords in progression
      */
@@ -1414,7 +1540,7 @@ class UnifiedChordExplorer {
         this._log('containers', `[findContainerChords] scale`, scaleNotes);
         
         // Use engine's container chord finder
-        const allContainers = this.musicTheory.findAllContainerChords(targetNotes, scaleNotes);
+        const allContainers = this.musicTheory.findAllContainerChords(targetNotes, scaleNotes, { match: 'all' });
         this._log('containers', `[findContainerChords] engineReturned=${allContainers.length}`);
         
         // Grade and filter
@@ -1558,15 +1684,41 @@ class UnifiedChordExplorer {
             };
         }
 
-        // Generate substitutions
-        const allSubs = this.generateSubstitutions(chord);
-        
-        // Apply filter based on current filter mode
-        this.state.substitutions = this._applyRadialFilter(allSubs);
-        this._log('radial', '[openRadialMenu] substitutions', this.state.substitutions.length, 'filter=', this.state.radialFilterMode);
-        
-        this.renderRadialMenu();
-        this.emit('radialMenuOpened', { chord, substitutions: this.state.substitutions });
+        // Generate substitutions (off-thread when the analysis service is connected)
+        this._requestSubstitutions(chord, allSubs => {
+            // Apply filter based on current filter mode
+            this.state.substitutions = this._applyRadialFilter(allSubs);
+            this._log('radial', '[openRadialMenu] substitutions', this.state.substitutions.length, 'filter=', this.state.radialFilterMode);
+
+            this.renderRadialMenu();
+            this.emit('radialMenuOpened', { chord, substitutions: this.state.substitutions });
+        });
+    }
+
+    /**
+     * Compute substitutions for `chord` and hand them to `apply`. With an analysis service
+     * the exhaustive search runs in the worker; a newer radial request cancels this one, and
+     * `apply` is skipped if the menu was closed or moved to another chord meanwhile.
+     */
+    _requestSubstitutions(chord, apply) {
+        if (!this.analysisService) {
+            apply(this.generateSubstitutions(chord));
+            return;
+        }
+        const stillWanted = () => this.state.radialMenuOpen && this.state.selectedChord === chord;
+        this.analysisService.request('generateSubstitutions', {
+            chord,
+            key: this.state.currentKey,
+            scale: this.state.currentScale,
+            exhaustive: !!this.state.exhaustiveMode,
+            gradingMode: this.musicTheory.gradingMode
+        }, { channel: 'chord-explorer-substitutions' })
+            .then(subs => { if (stillWanted()) apply(subs || []); })
+            .catch(err => {
+                if (err && err.cancelled) return;
+                console.warn('[UnifiedChordExplorer] Analysis service failed, generating locally:', err && err.message);
+                if (stillWanted()) apply(this.generateSubstitutions(chord));
+            });
     }
 
     /**
@@ -1643,9 +1795,10 @@ class UnifiedChordExplorer {
             
             // If menu is open, regenerate filtered substitutions
             if (this.state.radialMenuOpen && this.state.selectedChord) {
-                const allSubs = this.generateSubstitutions(this.state.selectedChord);
-                this.state.substitutions = this._applyRadialFilter(allSubs);
-                this.renderRadialMenu();
+                this._requestSubstitutions(this.state.selectedChord, allSubs => {
+                    this.state.substitutions = this._applyRadialFilter(allSubs);
+                    this.renderRadialMenu();
+                });
             }
         }
     }
@@ -3568,9 +3721,6 @@ class UnifiedChordExplorer {
         // store insertion context so selection handler can access it
     this.insertionContext = { degree: targetDegree, position, seqIndex: (typeof seqIndex === 'number') ? seqIndex : null };
 
-        // Generate substitutions (reuse same rich logic)
-        this.state.substitutions = this.generateSubstitutions(originalChord);
-
         // Use the same menu rendering flow but use a slightly different click handler
         // Compute menu position: anchor element center or centered in viewport
         // Always center insertion radial menu in the viewport (consistent with substitution radial menu)
@@ -3588,9 +3738,13 @@ class UnifiedChordExplorer {
         this.state.selectedChord = originalChord;
         this.state.radialMenuOpen = true;
 
-        // Render a menu specialized for insertion (nodes will call selectInsertionSubstitution)
-        this.renderInsertionRadialMenu();
-        this.emit('radialMenuOpened', { mode: 'insertion', original: originalChord, substitutions: this.state.substitutions });
+        // Generate substitutions (reuse same rich logic)
+        this._requestSubstitutions(originalChord, subs => {
+            this.state.substitutions = subs;
+            // Render a menu specialized for insertion (nodes will call selectInsertionSubstitution)
+            this.renderInsertionRadialMenu();
+            this.emit('radialMenuOpened', { mode: 'insertion', original: originalChord, substitutions: this.state.substitutions });
+        });
     }
 
     /**
@@ -3967,6 +4121,9 @@ class UnifiedChordExplorer {
     }
 }
 
+UnifiedChordExplorer.SCALE_CHORD_TABLE_LIMIT = 48;
+UnifiedChordExplorer.SCALE_CHORD_TABLE_SIGNATURE = 'scale-chords-v1';
+
 // Export for both browser and Node.js
 if (typeof module !== 'undefined' && module.exports) {
     module.exports = UnifiedChordExplorer;
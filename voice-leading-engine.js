@@ -39,6 +39,12 @@ class VoiceLeadingEngine {
             commonTone: -2       // Bonus for keeping common tone
         };
 
+        // Spacing limits used by the pruned/viterbi searches (semitones between adjacent voices)
+        this.spacing = {
+            upper: 12,           // soprano-alto and alto-tenor within an octave
+            tenorBass: 24        // tenor-bass within two octaves
+        };
+
         this.debug = true;
     }
 
@@ -49,14 +55,21 @@ class VoiceLeadingEngine {
     /**
      * Generate voice leading for chord progression
      * @param {Array} chordSymbols - Array of chord symbols (e.g., ['Cmaj7', 'Fmaj7', 'G7', 'Cmaj7'])
-     * @param {Object} options - { voicing: 'close'|'spread', register: 'low'|'mid'|'high' }
+     * @param {Object} options - { voicing: 'close'|'spread', register: 'low'|'mid'|'high',
+     *   search: 'greedy'|'pruned'|'viterbi' }
+     *   - greedy (default): best voicing for each chord given the previous one, full enumeration
+     *   - pruned: same chord-by-chord choice, but rejects crossed/over-spaced voices and
+     *     bounds on partial cost
+     *   - viterbi: cheapest total path over the whole progression (same constraints as pruned)
      * @returns {Array} Array of voicings with actual pitches
      */
     generateVoiceLeading(chordSymbols, options = {}) {
         const voicing = options.voicing || 'close';
         const register = options.register || 'mid';
+        const search = options.search || 'greedy';
         
         this._log('Generating voice leading for:', chordSymbols);
+        if (!Array.isArray(chordSymbols) || chordSymbols.length === 0) return [];
 
         // Convert chord symbols to pitch collections
         const chordPitches = chordSymbols.map(symbol => 
@@ -64,17 +77,24 @@ class VoiceLeadingEngine {
         );
 
         // Generate initial voicing for first chord
-        const voicings = [];
         const firstVoicing = this._generateInitialVoicing(chordPitches[0], voicing, register);
-        voicings.push(firstVoicing);
+        let voicings;
 
-        // Voice lead to each subsequent chord
-        for (let i = 1; i < chordPitches.length; i++) {
-            const prevVoicing = voicings[i - 1];
-            const nextChordPitches = chordPitches[i];
-            
-            const nextVoicing = this._voiceLeadToChord(prevVoicing, nextChordPitches, voicing);
-            voicings.push(nextVoicing);
+        if (search === 'viterbi') {
+            voicings = this._viterbiVoiceLeading(firstVoicing, chordPitches);
+        } else {
+            voicings = [firstVoicing];
+
+            // Voice lead to each subsequent chord
+            for (let i = 1; i < chordPitches.length; i++) {
+                const prevVoicing = voicings[i - 1];
+                const nextChordPitches = chordPitches[i];
+                
+                const nextVoicing = search === 'pruned'
+                    ? this._findPrunedVoicing(prevVoicing, this._generatePitchOptions(nextChordPitches))
+                    : this._voiceLeadToChord(prevVoicing, nextChordPitches, voicing);
+                voicings.push(nextVoicing);
+            }
         }
 
         return voicings.map((voicing, i) => ({
@@ -311,6 +331,198 @@ class VoiceLeadingEngine {
         return bestVoicing || prevVoicing; // Fallback
     }
 
+    /**
+     * Cost of moving a single voice by `interval` semitones (absolute)
+     */
+    _motionCost(interval) {
+        if (interval === 0) return this.costs.commonTone;
+        if (interval <= 2) return this.costs.stepwise;
+        if (interval <= 4) return this.costs.third;
+        if (interval <= 5) return this.costs.fourth;
+        if (interval === 7) return this.costs.fifth;
+        return this.costs.sixthOrLarger;
+    }
+
+    /**
+     * Parallel 5th/octave penalty between two voices across a chord change
+     */
+    _parallelCost(prevHigh, prevLow, nextHigh, nextLow) {
+        const prevInterval = Math.abs(prevHigh - prevLow) % 12;
+        const nextInterval = Math.abs(nextHigh - nextLow) % 12;
+        let cost = 0;
+        if (prevInterval === 7 && nextInterval === 7 && (prevHigh > prevLow) === (nextHigh > nextLow)) {
+            cost += this.costs.parallel5th;
+        }
+        if (prevInterval === 0 && nextInterval === 0) {
+            cost += this.costs.parallel8ve;
+        }
+        return cost;
+    }
+
+    /**
+     * Unrolled equivalent of _calculateVoicingCost for the inner loops of the searches
+     */
+    _transitionCost(p, n) {
+        return this._motionCost(Math.abs(n.soprano - p.soprano))
+            + this._motionCost(Math.abs(n.alto - p.alto))
+            + this._motionCost(Math.abs(n.tenor - p.tenor))
+            + this._motionCost(Math.abs(n.bass - p.bass))
+            + this._parallelCost(p.soprano, p.alto, n.soprano, n.alto)
+            + this._parallelCost(p.soprano, p.tenor, n.soprano, n.tenor)
+            + this._parallelCost(p.soprano, p.bass, n.soprano, n.bass)
+            + this._parallelCost(p.alto, p.tenor, n.alto, n.tenor)
+            + this._parallelCost(p.alto, p.bass, n.alto, n.bass)
+            + this._parallelCost(p.tenor, p.bass, n.tenor, n.bass);
+    }
+
+    /**
+     * Sorted, de-duplicated copy of generated pitch options (duplicates arise when
+     * extensions above the octave land on the same pitch as a lower chord tone)
+     */
+    _uniquePitchOptions(pitchOptions) {
+        const uniq = (list) => Array.from(new Set(list)).sort((a, b) => a - b);
+        return {
+            soprano: uniq(pitchOptions.soprano),
+            alto: uniq(pitchOptions.alto),
+            tenor: uniq(pitchOptions.tenor),
+            bass: uniq(pitchOptions.bass)
+        };
+    }
+
+    /**
+     * Enumerate voicings with no voice crossing and within this.spacing.
+     * Built bass-up so each rejected partial assignment discards its whole subtree.
+     */
+    _enumerateValidVoicings(pitchOptions) {
+        const opts = this._uniquePitchOptions(pitchOptions);
+        const out = [];
+        for (const bass of opts.bass) {
+            for (const tenor of opts.tenor) {
+                if (tenor < bass) continue;
+                if (tenor - bass > this.spacing.tenorBass) break;
+                for (const alto of opts.alto) {
+                    if (alto < tenor) continue;
+                    if (alto - tenor > this.spacing.upper) break;
+                    for (const soprano of opts.soprano) {
+                        if (soprano < alto) continue;
+                        if (soprano - alto > this.spacing.upper) break;
+                        out.push({ soprano, alto, tenor, bass });
+                    }
+                }
+            }
+        }
+        return out;
+    }
+
+    /**
+     * Branch-and-bound search for the next voicing.
+     * Voices are assigned bass → tenor → alto → soprano; crossed or over-spaced partial
+     * voicings are rejected immediately, and a branch is abandoned once its partial cost
+     * plus the best possible cost of the unassigned voices cannot beat the incumbent.
+     * Falls back to the unconstrained search when no voicing satisfies the constraints.
+     */
+    _findPrunedVoicing(prevVoicing, pitchOptions) {
+        const opts = this._uniquePitchOptions(pitchOptions);
+        const minMotion = Math.min(this.costs.commonTone, this.costs.stepwise);
+        const p = prevVoicing;
+        let bestVoicing = null;
+        let bestCost = Infinity;
+
+        for (const bass of opts.bass) {
+            const cB = this._motionCost(Math.abs(bass - p.bass));
+            if (cB + 3 * minMotion >= bestCost) continue;
+            for (const tenor of opts.tenor) {
+                if (tenor < bass) continue;
+                if (tenor - bass > this.spacing.tenorBass) break;
+                const cT = cB + this._motionCost(Math.abs(tenor - p.tenor))
+                    + this._parallelCost(p.tenor, p.bass, tenor, bass);
+                if (cT + 2 * minMotion >= bestCost) continue;
+                for (const alto of opts.alto) {
+                    if (alto < tenor) continue;
+                    if (alto - tenor > this.spacing.upper) break;
+                    const cA = cT + this._motionCost(Math.abs(alto - p.alto))
+                        + this._parallelCost(p.alto, p.tenor, alto, tenor)
+                        + this._parallelCost(p.alto, p.bass, alto, bass);
+                    if (cA + minMotion >= bestCost) continue;
+                    for (const soprano of opts.soprano) {
+                        if (soprano < alto) continue;
+                        if (soprano - alto > this.spacing.upper) break;
+                        const cost = cA + this._motionCost(Math.abs(soprano - p.soprano))
+                            + this._parallelCost(p.soprano, p.alto, soprano, alto)
+                            + this._parallelCost(p.soprano, p.tenor, soprano, tenor)
+                            + this._parallelCost(p.soprano, p.bass, soprano, bass);
+                        if (cost < bestCost) {
+                            bestCost = cost;
+                            bestVoicing = { soprano, alto, tenor, bass };
+                        }
+                    }
+                }
+            }
+        }
+
+        return bestVoicing || this._findOptimalVoicing(prevVoicing, pitchOptions);
+    }
+
+    /**
+     * Viterbi search over the whole progression: the first voicing is fixed, then for
+     * every chord each valid voicing keeps the cheapest predecessor. Predecessors are
+     * visited in ascending accumulated cost so the scan stops once no remaining
+     * predecessor can beat the current best (transition cost is bounded below by
+     * four common tones).
+     */
+    _viterbiVoiceLeading(firstVoicing, chordPitches) {
+        const transitionFloor = 4 * Math.min(this.costs.commonTone, this.costs.stepwise);
+        let layer = [{ voicing: firstVoicing, cost: 0, back: null }];
+
+        for (let i = 1; i < chordPitches.length; i++) {
+            const pitchOptions = this._generatePitchOptions(chordPitches[i]);
+            let states = this._enumerateValidVoicings(pitchOptions);
+            if (states.length === 0) {
+                // Constraints too strict for this chord: keep the greedy choice from each predecessor
+                states = layer.map(prev => this._findOptimalVoicing(prev.voicing, pitchOptions));
+            }
+
+            layer.sort((a, b) => a.cost - b.cost);
+            const next = [];
+            for (const voicing of states) {
+                let best = null;
+                let bestCost = Infinity;
+                for (const prev of layer) {
+                    if (prev.cost + transitionFloor >= bestCost) break;
+                    const cost = prev.cost + this._transitionCost(prev.voicing, voicing);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        best = prev;
+                    }
+                }
+                next.push({ voicing, cost: bestCost, back: best });
+            }
+            layer = next;
+        }
+
+        let end = layer[0];
+        for (const node of layer) {
+            if (node.cost < end.cost) end = node;
+        }
+
+        const path = [];
+        for (let node = end; node; node = node.back) path.push(node.voicing);
+        return path.reverse();
+    }
+
+    /**
+     * Total voice-leading cost of a sequence of voicings (sum of transition costs)
+     */
+    calculatePathCost(voicings) {
+        let total = 0;
+        for (let i = 1; i < voicings.length; i++) {
+            const prev = voicings[i - 1].voices || voicings[i - 1];
+            const next = voicings[i].voices || voicings[i];
+            total += this._calculateVoicingCost(prev, next);
+        }
+        return total;
+    }
+
     /**
      * Calculate cost of voice leading
      */
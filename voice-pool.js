@@ -0,0 +1,128 @@
+/**
+ * @module VoicePool
+ * @description Fixed-size voice slots with stealing, shared by EnhancedAudioEngine and PianoSampleEngine
+ * @exports class VoicePool
+ * @feature Slots keep their gain/filter nodes for the life of the engine; only sources are per-note
+ * @feature Configurable polyphony cap; steals releasing voices first, then the oldest/quietest
+ * @feature Reports active and stolen voice counts
+ *
+ * The engine supplies createSlotNodes() (persistent per-slot nodes) and
+ * silence(slot, when) (fast fade + stop of whatever the slot is playing).
+ */
+
+class VoicePool {
+    /**
+     * @param {Object} options - { polyphony, createSlotNodes, silence, now }
+     */
+    constructor(options = {}) {
+        this.polyphony = Math.max(1, options.polyphony || 32);
+        this.createSlotNodes = options.createSlotNodes;
+        this.silence = options.silence || (() => {});
+        this.now = options.now || (() => 0);
+        this.slots = [];
+        this.stats = { allocated: 0, stolen: 0, peakActive: 0 };
+    }
+
+    /**
+     * Get a slot for a note starting at `startTime`. Sets slot.stolen when it
+     * had to cut another voice short.
+     */
+    acquire(midi, velocity = 1, startTime = this.now()) {
+        let slot = null;
+        const cap = Math.min(this.polyphony, this.slots.length);
+        for (let i = 0; i < cap; i++) {
+            if (!this.slots[i].busy) { slot = this.slots[i]; break; }
+        }
+
+        let stolen = false;
+        if (!slot && this.slots.length < this.polyphony) {
+            slot = { index: this.slots.length, busy: false, nodes: this.createSlotNodes() };
+            this.slots.push(slot);
+        }
+        if (!slot) {
+            slot = this._pickVictim();
+            this.silence(slot, this.now());
+            this.stats.stolen++;
+            stolen = true;
+        }
+
+        slot.busy = true;
+        slot.stolen = stolen;
+        slot.midi = midi;
+        slot.velocity = velocity;
+        slot.startTime = startTime;
+        slot.releasing = false;
+        slot.voice = null;
+        slot.generation = (slot.generation || 0) + 1;
+        this.stats.allocated++;
+        const active = this.activeCount();
+        if (active > this.stats.peakActive) this.stats.peakActive = active;
+        return slot;
+    }
+
+    /**
+     * Prefer voices already in release, then sounding voices scored by age and
+     * softness; notes still waiting to start are taken last.
+     */
+    _pickVictim() {
+        const now = this.now();
+        let best = null;
+        let bestScore = -Infinity;
+        const cap = Math.min(this.polyphony, this.slots.length);
+        for (let i = 0; i < cap; i++) {
+            const slot = this.slots[i];
+            const age = now - slot.startTime;
+            let score;
+            if (slot.startTime > now) score = -1e6 - slot.startTime; // scheduled: latest start goes first
+            else score = age * (1.5 - Math.min(1, slot.velocity || 0)) + (slot.releasing ? 1e6 : 0);
+            if (score > bestScore) { bestScore = score; best = slot; }
+        }
+        return best || this.slots[0];
+    }
+
+    /** Mark the slot's voice as releasing (first in line to be stolen) */
+    markReleasing(slot, generation) {
+        if (slot && slot.generation === generation) slot.releasing = true;
+    }
+
+    /** Free the slot if it still belongs to the note that was started as `generation` */
+    release(slot, generation) {
+        if (!slot || slot.generation !== generation) return;
+        slot.busy = false;
+        slot.releasing = false;
+        slot.voice = null;
+    }
+
+    activeCount() {
+        let n = 0;
+        for (let i = 0; i < this.slots.length; i++) if (this.slots[i].busy) n++;
+        return n;
+    }
+
+    setPolyphony(n) {
+        this.polyphony = Math.max(1, parseInt(n, 10) || this.polyphony);
+    }
+
+    forEachActive(fn) {
+        this.slots.forEach(slot => { if (slot.busy) fn(slot); });
+    }
+
+    getStats() {
+        return {
+            active: this.activeCount(),
+            stolen: this.stats.stolen,
+            allocated: this.stats.allocated,
+            peakActive: this.stats.peakActive,
+            polyphony: this.polyphony,
+            slots: this.slots.length
+        };
+    }
+}
+
+// Seconds a stolen voice takes to fade before its slot is reused
+VoicePool.STEAL_FADE = 0.005;
+
+// Export for module systems
+if (typeof module !== 'undefined' && module.exports) {
+    module.exports = VoicePool;
+}
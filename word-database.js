@@ -2,6 +2,8 @@
  * word-database.js
  * WordDatabase — converts NRC lexicon bitmasks to VAD scores.
  * Fills the WordDatabase slot expected by context-engine.js.
+ * Lookups go through a LexiconIndex (lexicon-index.js) when it is loaded: stems and
+ * decoded VAD values are precomputed once; lookupMany() serves a whole sentence.
  */
 
 class WordDatabase {
@@ -22,6 +24,62 @@ class WordDatabase {
             anger:        'phrygian_dominant',
             disgust:      'phrygian'
         };
+
+        this._index = null;
+        this._indexSources = null;
+    }
+
+    /**
+     * Combined NRC + thesaurus index, built on first use (after every lexicon
+     * script has loaded) and rebuilt if one of the sources is replaced.
+     */
+    getIndex() {
+        if (typeof LexiconIndex === 'undefined') return null;
+        const g = typeof window !== 'undefined' ? window : {};
+        const thesaurus = g.OfflineThesaurus || null;
+        const archetypes = g.MusicalArchetypes || null;
+        const current = this._indexSources;
+        if (this._index && current.data === this._data && current.thesaurus === thesaurus && current.archetypes === archetypes) {
+            return this._index;
+        }
+
+        this._index = new LexiconIndex({
+            nrc: this._data,
+            suffixes: this._suffixes,
+            decodeMask: (mask) => ({ ...this._maskToVAD(mask), category: this._dominantEmotion(mask) }),
+            emotionScales: this._emotionScales,
+            thesaurus: thesaurus && typeof thesaurus.entries === 'function' ? thesaurus.entries() : null,
+            thesaurusLookup: thesaurus && typeof thesaurus.lookup === 'function' ? (w) => thesaurus.lookup(w) : null,
+            archetypes: archetypes || {}
+        });
+        this._indexSources = { data: this._data, thesaurus, archetypes };
+        return this._index;
+    }
+
+    /**
+     * Resolve a sentence's tokens in one pass; result is aligned with `tokens`.
+     * Each entry: { word, stem, mask, valence, arousal, dominance, category, scale, archetype, archetypeInfo }
+     * or null when no lexicon knows the token.
+     */
+    lookupMany(tokens) {
+        const list = (tokens || []).map(t => String(t || '').toLowerCase().trim());
+        const index = this.getIndex();
+        if (index) return index.lookupMany(list);
+        return list.map(token => {
+            const mask = token ? this._lookup(token) : null;
+            if (mask === null) return null;
+            const vad = this._maskToVAD(mask);
+            const category = this._dominantEmotion(mask);
+            return { word: token, stem: token, mask, ...vad, category, scale: this._emotionScales[category] || null, archetype: null, archetypeInfo: null };
+        });
+    }
+
+    _emotionEntry(word) {
+        const token = String(word).toLowerCase().trim();
+        const index = this.getIndex();
+        if (!index) return null;
+        const entry = index.lookup(token);
+        return entry && entry.mask !== null ? entry : null;
     }
 
     /**
@@ -30,6 +88,17 @@ class WordDatabase {
      */
     getEmotionalValence(word) {
         if (!word) return null;
+        if (typeof LexiconIndex !== 'undefined') {
+            const entry = this._emotionEntry(word);
+            if (!entry) return null;
+            return {
+                valence:   entry.valence,
+                arousal:   entry.arousal,
+                dominance: entry.dominance,
+                category:  entry.category,
+                scale:     entry.scale
+            };
+        }
         const mask = this._lookup(String(word).toLowerCase().trim());
         if (mask === null) return null;
         const vad = this._maskToVAD(mask);
@@ -48,6 +117,11 @@ class WordDatabase {
      */
     getSemanticCategory(word) {
         if (!word) return null;
+        if (typeof LexiconIndex !== 'undefined') {
+            const entry = this._emotionEntry(word);
+            if (!entry) return null;
+            return { name: entry.category, scales: entry.scale ? [entry.scale] : [] };
+        }
         const mask = this._lookup(String(word).toLowerCase().trim());
         if (mask === null) return null;
         const dominant = this._dominantEmotion(mask);